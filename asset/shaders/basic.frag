@@ -7,56 +7,169 @@ in vec3 Normal;
 in vec3 FragPos;
 
 //Light
-uniform vec3 lightPos;
-uniform vec3 lightColor;
-uniform vec3 viewPos;
-uniform float ambientStrength;
-uniform float diffuseStrength;
-uniform float specularStrength;
-uniform int shininess;
-uniform bool isPointLight;
+// 카메라마다 한 번 갱신되는 유니폼 버퍼 (RenderManager의 CameraUniforms와 같은 std140 배치)
+layout(std140, binding = 1) uniform CameraData
+{
+    mat4 view;
+    mat4 projection;
+    vec4 cameraPosition; // xyz = 카메라 월드 위치
+};
+#ifdef MULTI_LIGHT
+// 모든 조명을 한 패스에서 계산 (RenderManager의 GPULight와 같은 배치)
+struct LightData
+{
+    vec4 positionType; // xyz = 점광원 위치 또는 방향광 방향, w = 1 점광원 / 0 방향광
+    vec4 color;        // rgb = 색상
+    vec4 intensity;    // x = ambient, y = diffuse, z = specular, w = shininess
+    vec4 params;       // x = 점광원 영향 반경 (0이면 무한)
+};
+layout(std430, binding = 0) readonly buffer LightBuffer
+{
+    ivec4 lightCount; // x = 조명 개수, y = 반경이 있는 점광원 개수 (배열 앞쪽에 위치)
+    LightData lights[];
+};
+#ifdef CLUSTERED
+// 클러스터(화면 타일 x 깊이 슬라이스)마다 배정된 점광원 목록 (RenderManager::UploadClusterBuffers와 같은 배치)
+layout(std430, binding = 1) readonly buffer ClusterBuffer
+{
+    ivec4 clusterDims;     // xyz = 클러스터 개수
+    vec4 clusterDepth;     // x = near, y = far, z = 슬라이스 스케일, w = 슬라이스 바이어스 (slice = log(깊이) * z + w)
+    vec4 clusterViewport;  // 뷰포트 (x, y, 너비, 높이, 픽셀 단위)
+    uvec2 clusterRanges[]; // x = 인덱스 시작 위치, y = 개수
+};
+layout(std430, binding = 2) readonly buffer ClusterIndexBuffer
+{
+    uint clusterLightIndices[];
+};
+
+// 현재 프래그먼트가 속한 클러스터 번호 (x + dimX * (y + dimY * z))
+int GetClusterIndex()
+{
+    vec2 tile = (gl_FragCoord.xy - clusterViewport.xy) / clusterViewport.zw * vec2(clusterDims.xy);
+    float ndcDepth = gl_FragCoord.z * 2.0 - 1.0;
+    float viewDepth = 2.0 * clusterDepth.x * clusterDepth.y / (clusterDepth.y + clusterDepth.x - ndcDepth * (clusterDepth.y - clusterDepth.x));
+    int slice = int(floor(log(viewDepth) * clusterDepth.z + clusterDepth.w));
+    ivec3 cluster = clamp(ivec3(ivec2(tile), slice), ivec3(0), clusterDims.xyz - 1);
+    return cluster.x + clusterDims.x * (cluster.y + clusterDims.y * cluster.z);
+}
+#endif
+#else
+// 조명마다 다시 그리는 경로에서 현재 패스의 조명 (RenderManager의 GPULight와 같은 std140 배치)
+layout(std140, binding = 2) uniform PassLightData
+{
+    vec4 passLightPositionType; // xyz = 점광원 위치 또는 방향광 방향, w = 1 점광원 / 0 방향광
+    vec4 passLightColor;
+    vec4 passLightIntensity;    // x = ambient, y = diffuse, z = specular, w = shininess
+    vec4 passLightParams;       // x = 점광원 영향 반경 (0이면 무한)
+};
+#endif
 //Light
 
 uniform sampler2D Texture; 
 uniform bool useTexture;
+#ifdef INSTANCED
+flat in vec4 instanceColor;
+vec4 color;
+#else
 uniform vec4 color;
+#endif
 
-void main() {
-    vec4 baseColor = vec4(ourColor, 1.0) * color;
-    if (useTexture)
-    {
-        baseColor = texture(Texture, TexCoord);
-    }
-
-    vec3 norm = normalize(Normal);
+// 조명 하나의 기여도 (점광원이면 lightVector는 위치, 방향광이면 방향)
+vec3 CalculateLight(vec3 lightVector, bool isPoint, vec3 lightColor_, float ambientStrength_, float diffuseStrength_,
+    float specularStrength_, float shininess_, vec3 norm, vec3 viewDir, vec3 baseColor)
+{
     vec3 lightDir;
 
-    if (isPointLight)
+    if (isPoint)
     {
         // 점광원: 프래그먼트 위치를 기준으로 빛의 방향 계산
-        lightDir = normalize(lightPos - FragPos);
+        lightDir = normalize(lightVector - FragPos);
     }
     else
     {
         // 방향광: 모든 프래그먼트에서 빛의 방향이 동일 (lightPos에 방향 벡터가 들어옴)
-        lightDir = normalize(-lightPos);
+        lightDir = normalize(-lightVector);
     }
 
     // 주변광 (Ambient)
-    vec3 ambient = ambientStrength * lightColor;
+    vec3 ambient = ambientStrength_ * lightColor_;
 
     // 난반사 (Diffuse)
     float diff = max(dot(norm, lightDir), 0.0);
-    vec3 diffuse = diffuseStrength * diff * lightColor;
+    vec3 diffuse = diffuseStrength_ * diff * lightColor_;
 
     // 정반사 (Specular)
-    vec3 viewDir = normalize(viewPos - FragPos);
     vec3 reflectDir = reflect(-lightDir, norm);
-    float spec = pow(max(dot(viewDir, reflectDir), 0.0), shininess);
-    vec3 specular = specularStrength * spec * lightColor;
-    
-    // 최종 색상 조합
+    float spec = pow(max(dot(viewDir, reflectDir), 0.0), shininess_);
+    vec3 specular = specularStrength_ * spec * lightColor_;
+
     // 주변광과 난반사는 물체 고유의 색에 영향을 주고, 정반사는 하이라이트로 더해짐
-    vec3 result = (ambient + diffuse) * baseColor.rgb + specular;
+    return (ambient + diffuse) * baseColor + specular;
+}
+
+// 영향 반경에서 0이 되도록 줄어드는 감쇠 (반경이 0이면 감쇠 없음)
+float RangeAttenuation(float distance, float range)
+{
+    if (range <= 0.0)
+    {
+        return 1.0;
+    }
+    float ratio = distance / range;
+    float window = clamp(1.0 - ratio * ratio * ratio * ratio, 0.0, 1.0);
+    return window * window;
+}
+
+#ifdef MULTI_LIGHT
+// 라이트 버퍼의 index번째 조명 기여도
+vec3 ShadeLight(int index, vec3 norm, vec3 viewDir, vec3 baseColor)
+{
+    LightData light = lights[index];
+    bool isPoint = light.positionType.w > 0.5;
+    float attenuation = isPoint ? RangeAttenuation(length(light.positionType.xyz - FragPos), light.params.x) : 1.0;
+    return attenuation * CalculateLight(light.positionType.xyz, isPoint, light.color.rgb,
+        light.intensity.x, light.intensity.y, light.intensity.z, light.intensity.w, norm, viewDir, baseColor);
+}
+#endif
+
+void main() {
+#ifdef INSTANCED
+    color = instanceColor;
+#endif
+    vec4 baseColor = vec4(ourColor, 1.0) * color;
+    if (useTexture)
+    {
+        baseColor = texture(Texture, TexCoord);
+    }
+
+    vec3 norm = normalize(Normal);
+    vec3 viewDir = normalize(cameraPosition.xyz - FragPos);
+
+#if defined(CLUSTERED)
+    // 이 프래그먼트의 클러스터에 배정된 점광원 + 반경이 없는 조명(방향광 등)만 계산
+    vec3 result = vec3(0.0);
+    uvec2 clusterRange = clusterRanges[GetClusterIndex()];
+    for (uint i = 0u; i < clusterRange.y; ++i)
+    {
+        result += ShadeLight(int(clusterLightIndices[clusterRange.x + i]), norm, viewDir, baseColor.rgb);
+    }
+    for (int i = lightCount.y; i < lightCount.x; ++i)
+    {
+        result += ShadeLight(i, norm, viewDir, baseColor.rgb);
+    }
+#elif defined(MULTI_LIGHT)
+    vec3 result = vec3(0.0);
+    for (int i = 0; i < lightCount.x; ++i)
+    {
+        result += ShadeLight(i, norm, viewDir, baseColor.rgb);
+    }
+#else
+    bool isPointLight = passLightPositionType.w > 0.5;
+    vec3 result = CalculateLight(passLightPositionType.xyz, isPointLight, passLightColor.rgb,
+        passLightIntensity.x, passLightIntensity.y, passLightIntensity.z, passLightIntensity.w, norm, viewDir, baseColor.rgb);
+    if (isPointLight)
+    {
+        result *= RangeAttenuation(length(passLightPositionType.xyz - FragPos), passLightParams.x);
+    }
+#endif
     FragColor = vec4(result, baseColor.a);
 }
\ No newline at end of file
@@ -1,25 +1,58 @@
 #version 430 core
 
 const int MAX_BONES = 128;
-uniform mat4 finalBonesMatrices[MAX_BONES];
+// 드로우마다 스트리밍 링 버퍼에 기록한 뼈 행렬 구간을 연결 (RenderManager::BindBonePalette)
+layout(std140, binding = 3) uniform BonePalette
+{
+    mat4 finalBonesMatrices[MAX_BONES];
+};
 
 layout (location = 0) in vec3 aPos;
-layout (location = 1) in vec3 aNormal;  
+layout (location = 1) in vec2 aNormalOct; // 팔면체 사상 snorm16x2
 layout (location = 2) in vec3 aColor;     
 layout (location = 3) in vec2 aTexCoord;
-layout (location = 4) in ivec4 aBoneIDs;
-layout (location = 5) in vec4 aWeights;
+layout (location = 4) in ivec4 aBoneIDs; // uint8, 스키닝 스트림이 없는 메시는 0
+layout (location = 5) in vec4 aWeights;  // unorm8, 쓰지 않는 칸은 0
 
 out vec3 ourColor;
 out vec2 TexCoord;
 out vec3 Normal;
 out vec3 FragPos;
 
+#ifdef INSTANCED
+// 인스턴싱 변형: 오브젝트별 값을 인스턴스 속성으로 받음 (RenderManager의 InstanceData와 같은 배치)
+layout (location = 6) in mat4 aInstanceModel;    // 6 ~ 9
+layout (location = 10) in vec4 aInstanceColor;
+layout (location = 11) in vec4 aInstanceMaterial; // x = metallic, y = roughness
+flat out vec4 instanceColor;
+flat out vec2 instanceMaterial;
+#else
 uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
+#endif
+// 카메라마다 한 번 갱신되는 유니폼 버퍼 (RenderManager의 CameraUniforms와 같은 std140 배치)
+layout(std140, binding = 1) uniform CameraData
+{
+    mat4 view;
+    mat4 projection;
+    vec4 cameraPosition; // xyz = 카메라 월드 위치
+};
+
+// 팔면체 사상으로 압축한 법선 복원 (VertexFormat.cpp의 EncodeOctahedralNormal과 대응)
+vec3 DecodeOctahedralNormal(vec2 encoded)
+{
+    vec3 n = vec3(encoded, 1.0 - abs(encoded.x) - abs(encoded.y));
+    float fold = max(-n.z, 0.0);
+    n.x += n.x >= 0.0 ? -fold : fold;
+    n.y += n.y >= 0.0 ? -fold : fold;
+    return normalize(n);
+}
 
 void main() {
+#ifdef INSTANCED
+    mat4 model = aInstanceModel;
+    instanceColor = aInstanceColor;
+    instanceMaterial = aInstanceMaterial.xy;
+#endif
 mat4 finalTransform; // 최종 변환 행렬을 담을 변수
 
     // 뼈 가중치가 있는 애니메이션 정점의 경우
@@ -28,7 +61,7 @@ mat4 finalTransform; // 최종 변환 행렬을 담을 변수
         mat4 skinningTransform = mat4(0.0f);
         for(int i = 0; i < 4; i++)
         {
-            if(aBoneIDs[i] != -1)
+            if(aWeights[i] > 0.0)
             {
                 skinningTransform += finalBonesMatrices[aBoneIDs[i]] * aWeights[i];
             }
@@ -46,7 +79,7 @@ mat4 finalTransform; // 최종 변환 행렬을 담을 변수
     
     vec3 worldPos = vec3(finalTransform * vec4(aPos, 1.0));
     FragPos = worldPos;
-    Normal = mat3(transpose(inverse(finalTransform))) * aNormal; 
+    Normal = mat3(transpose(inverse(finalTransform))) * DecodeOctahedralNormal(aNormalOct); 
     
     TexCoord = aTexCoord;
     ourColor = aColor;
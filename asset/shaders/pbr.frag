@@ -7,20 +7,84 @@ in vec3 Normal;
 in vec3 FragPos;
 // 월드 공간 위치
 
+// 카메라마다 한 번 갱신되는 유니폼 버퍼 (RenderManager의 CameraUniforms와 같은 std140 배치)
+layout(std140, binding = 1) uniform CameraData
+{
+    mat4 view;
+    mat4 projection;
+    vec4 cameraPosition; // xyz = 카메라 월드 위치
+};
+// 프레임마다 한 번 갱신되는 유니폼 버퍼 (RenderManager의 FrameUniforms와 같은 std140 배치)
+layout(std140, binding = 0) uniform FrameData
+{
+    vec4 frameTime;   // x = 경과 시간(초), y = 프레임 시간(초)
+    vec4 frameParams; // x = exposure
+};
 // Light (기존 직접 조명용)
-uniform vec3 lightPos;
-uniform vec3 lightColor;
-uniform vec3 viewPos;
-// 카메라(뷰)의 월드 공간 위치
-uniform bool isPointLight;
+#ifdef MULTI_LIGHT
+// 모든 조명을 한 패스에서 계산 (RenderManager의 GPULight와 같은 배치)
+struct LightData
+{
+    vec4 positionType; // xyz = 점광원 위치 또는 방향광 방향, w = 1 점광원 / 0 방향광
+    vec4 color;        // rgb = 색상
+    vec4 intensity;    // x = ambient, y = diffuse, z = specular, w = shininess (PBR에서는 사용하지 않음)
+    vec4 params;       // x = 점광원 영향 반경 (0이면 무한)
+};
+layout(std430, binding = 0) readonly buffer LightBuffer
+{
+    ivec4 lightCount; // x = 조명 개수, y = 반경이 있는 점광원 개수 (배열 앞쪽에 위치)
+    LightData lights[];
+};
+#ifdef CLUSTERED
+// 클러스터(화면 타일 x 깊이 슬라이스)마다 배정된 점광원 목록 (RenderManager::UploadClusterBuffers와 같은 배치)
+layout(std430, binding = 1) readonly buffer ClusterBuffer
+{
+    ivec4 clusterDims;     // xyz = 클러스터 개수
+    vec4 clusterDepth;     // x = near, y = far, z = 슬라이스 스케일, w = 슬라이스 바이어스 (slice = log(깊이) * z + w)
+    vec4 clusterViewport;  // 뷰포트 (x, y, 너비, 높이, 픽셀 단위)
+    uvec2 clusterRanges[]; // x = 인덱스 시작 위치, y = 개수
+};
+layout(std430, binding = 2) readonly buffer ClusterIndexBuffer
+{
+    uint clusterLightIndices[];
+};
+
+// 현재 프래그먼트가 속한 클러스터 번호 (x + dimX * (y + dimY * z))
+int GetClusterIndex()
+{
+    vec2 tile = (gl_FragCoord.xy - clusterViewport.xy) / clusterViewport.zw * vec2(clusterDims.xy);
+    float ndcDepth = gl_FragCoord.z * 2.0 - 1.0;
+    float viewDepth = 2.0 * clusterDepth.x * clusterDepth.y / (clusterDepth.y + clusterDepth.x - ndcDepth * (clusterDepth.y - clusterDepth.x));
+    int slice = int(floor(log(viewDepth) * clusterDepth.z + clusterDepth.w));
+    ivec3 cluster = clamp(ivec3(ivec2(tile), slice), ivec3(0), clusterDims.xyz - 1);
+    return cluster.x + clusterDims.x * (cluster.y + clusterDims.y * cluster.z);
+}
+#endif
+#else
+// 조명마다 다시 그리는 경로에서 현재 패스의 조명 (RenderManager의 GPULight와 같은 std140 배치)
+layout(std140, binding = 2) uniform PassLightData
+{
+    vec4 passLightPositionType; // xyz = 점광원 위치 또는 방향광 방향, w = 1 점광원 / 0 방향광
+    vec4 passLightColor;
+    vec4 passLightIntensity;    // x = ambient, y = diffuse, z = specular, w = shininess
+    vec4 passLightParams;       // x = 점광원 영향 반경 (0이면 무한)
+};
+#endif
 
 // Material
 layout(binding = 0) uniform sampler2D Texture; 
 uniform bool useTexture;
+#ifdef INSTANCED
+flat in vec4 instanceColor;
+flat in vec2 instanceMaterial;
+vec4 color;
+float metallic;
+float roughness;
+#else
 uniform vec4 color;
 uniform float metallic;
 uniform float roughness;
-uniform float exposure;
+#endif
 
 // 간접 조명 맵
 layout(binding = 1) uniform samplerCube irradianceMap; // 확산광용 (Diffuse)
@@ -79,8 +143,83 @@ vec3 fresnelSchlickRoughness(float cosTheta, vec3 F0, float roughness)
     return F0 + (max(vec3(1.0 - roughness), F0) - F0) * pow(clamp(1.0 - cosTheta, 0.0, 1.0), 5.0);
 }
 
+// 조명 하나의 직접광 기여도 (점광원이면 lightVector는 위치, 방향광이면 방향)
+vec3 CalculateDirectLight(vec3 lightVector, bool isPoint, vec3 lightColor_, vec3 N, vec3 V, vec3 albedo, vec3 F0)
+{
+    vec3 L;
+    // Light
+    if (isPoint) {
+        L = normalize(lightVector - FragPos);
+    } else {
+        L = normalize(-lightVector); // 방향광
+    }
+    vec3 H = normalize(V + L); // Halfway
+    float NdotL = max(dot(N, L), 0.0);
+
+    if (NdotL <= 0.0) // 빛을 받는 면만 계산
+    {
+        return vec3(0.0);
+    }
+
+    // D, G, F 계산
+    float D = DistributionGGX(N, H, roughness);
+    float G = GeometrySmith(N, V, L, roughness);
+    vec3 F = fresnelSchlick(max(dot(H, V), 0.0), F0);
+
+    // Specular BRDF 분모
+    float denominator = 4.0 * max(dot(N, V), 0.0) * NdotL + 0.0001;
+    vec3 specular = D * G * F / denominator;
+
+    // kS (Specular 비율) = Fresnel
+    vec3 kS = F;
+    // kD (Diffuse 비율) = (1 - kS) * (1 - metallic)
+    vec3 kD = vec3(1.0) - kS;
+    kD *= (1.0 - metallic); // 금속은 Diffuse가 0
+
+    vec3 radiance = lightColor_;
+
+    if (isPoint)
+    {
+        float distance = length(lightVector - FragPos);
+        // 거리가 멀어질수록 빛이 약해짐 (거리의 제곱 반비례)
+        float attenuation = 1.0 / (distance * distance);
+        radiance *= attenuation;
+    }
+
+    return (kD * albedo / PI + specular) * radiance * NdotL;
+}
+
+// 영향 반경에서 0이 되도록 줄어드는 감쇠 (반경이 0이면 감쇠 없음)
+float RangeAttenuation(float distance, float range)
+{
+    if (range <= 0.0)
+    {
+        return 1.0;
+    }
+    float ratio = distance / range;
+    float window = clamp(1.0 - ratio * ratio * ratio * ratio, 0.0, 1.0);
+    return window * window;
+}
+
+#ifdef MULTI_LIGHT
+// 라이트 버퍼의 index번째 조명의 직접광 기여도
+vec3 ShadeLight(int index, vec3 N, vec3 V, vec3 albedo, vec3 F0)
+{
+    LightData light = lights[index];
+    bool isPoint = light.positionType.w > 0.5;
+    float attenuation = isPoint ? RangeAttenuation(length(light.positionType.xyz - FragPos), light.params.x) : 1.0;
+    return attenuation * CalculateDirectLight(light.positionType.xyz, isPoint, light.color.rgb, N, V, albedo, F0);
+}
+#endif
+
 void main()
 {
+#ifdef INSTANCED
+    color = instanceColor;
+    metallic = instanceMaterial.x;
+    roughness = instanceMaterial.y;
+#endif
+
     // 재질 속성 준비
     vec4 albedoTex = vec4(ourColor, 1.0) * color;
     if (useTexture) {
@@ -95,52 +234,36 @@ void main()
 
     // 입력 벡터 준비
     vec3 N = normalize(Normal);
-    vec3 V = normalize(viewPos - FragPos); // View
+    vec3 V = normalize(cameraPosition.xyz - FragPos); // View
     vec3 R = reflect(-V, N); // 반사 벡터 (IBL Specular용)
     
     // 1. 직접 조명 계산
+#if defined(CLUSTERED)
+    // 이 프래그먼트의 클러스터에 배정된 점광원 + 반경이 없는 조명(방향광 등)만 계산
     vec3 Lo = vec3(0.0);
-    
-    vec3 L;
-    // Light
-    if (isPointLight) {
-        L = normalize(lightPos - FragPos);
-    } else {
-        L = normalize(-lightPos); // 방향광
+    uvec2 clusterRange = clusterRanges[GetClusterIndex()];
+    for (uint i = 0u; i < clusterRange.y; ++i)
+    {
+        Lo += ShadeLight(int(clusterLightIndices[clusterRange.x + i]), N, V, albedo, F0);
     }
-    vec3 H = normalize(V + L); // Halfway
-    float NdotL = max(dot(N, L), 0.0);
-
-    if(NdotL > 0.0) // 빛을 받는 면만 계산
+    for (int i = lightCount.y; i < lightCount.x; ++i)
+    {
+        Lo += ShadeLight(i, N, V, albedo, F0);
+    }
+#elif defined(MULTI_LIGHT)
+    vec3 Lo = vec3(0.0);
+    for (int i = 0; i < lightCount.x; ++i)
+    {
+        Lo += ShadeLight(i, N, V, albedo, F0);
+    }
+#else
+    bool isPointLight = passLightPositionType.w > 0.5;
+    vec3 Lo = CalculateDirectLight(passLightPositionType.xyz, isPointLight, passLightColor.rgb, N, V, albedo, F0);
+    if (isPointLight)
     {
-        // D, G, F 계산
-        float D = DistributionGGX(N, H, roughness);
-        float G = GeometrySmith(N, V, L, roughness);
-        vec3 F = fresnelSchlick(max(dot(H, V), 0.0), F0);
-        
-        // Specular BRDF 분모
-        float denominator = 4.0 * max(dot(N, V), 0.0) * NdotL + 0.0001;
-        vec3 specular = D * G * F / denominator;
-        
-        // kS (Specular 비율) = Fresnel
-        vec3 kS = F;
-        // kD (Diffuse 비율) = (1 - kS) * (1 - metallic)
-        vec3 kD = vec3(1.0) - kS;
-        kD *= (1.0 - metallic); // 금속은 Diffuse가 0
-        
-        vec3 radiance = lightColor;
-        
-        if (isPointLight)
-        {
-            float distance = length(lightPos - FragPos);
-            // 거리가 멀어질수록 빛이 약해짐 (거리의 제곱 반비례)
-            float attenuation = 1.0 / (distance * distance); 
-            radiance *= attenuation;
-        }
-
-        // 최종 합산
-        Lo += (kD * albedo / PI + specular) * radiance * NdotL;
+        Lo *= RangeAttenuation(length(passLightPositionType.xyz - FragPos), passLightParams.x);
     }
+#endif
 
     // 2. IBL (환경 조명) 계산
     // 2-1. 확산광 (Diffuse)
@@ -170,7 +293,7 @@ void main()
     vec3 colorResult = ambient + Lo;
 
     // 노출(Exposure) 적용
-    colorResult *= exposure; 
+    colorResult *= frameParams.x; 
 
     // HDR 톤 매핑 (Reinhard)
     colorResult = colorResult / (colorResult + vec3(1.0));
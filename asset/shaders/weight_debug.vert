@@ -1,18 +1,27 @@
 #version 430 core
 
 layout (location = 0) in vec3 aPos;
-layout (location = 1) in vec3 aNormal;
+layout (location = 1) in vec2 aNormalOct; // 팔면체 사상 snorm16x2
 layout (location = 2) in vec3 aColor;
 layout (location = 3) in vec2 aTexCoord;
-layout (location = 4) in ivec4 aBoneIDs;
-layout (location = 5) in vec4 aWeights;
+layout (location = 4) in ivec4 aBoneIDs; // uint8, 스키닝 스트림이 없는 메시는 0
+layout (location = 5) in vec4 aWeights;  // unorm8, 쓰지 않는 칸은 0
 
 uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
+// 카메라마다 한 번 갱신되는 유니폼 버퍼 (RenderManager의 CameraUniforms와 같은 std140 배치)
+layout(std140, binding = 1) uniform CameraData
+{
+    mat4 view;
+    mat4 projection;
+    vec4 cameraPosition; // xyz = 카메라 월드 위치
+};
 
 const int MAX_BONES = 256;
-uniform mat4 finalBonesMatrices[MAX_BONES];
+// 드로우마다 스트리밍 링 버퍼에 기록한 뼈 행렬 구간을 연결 (RenderManager::BindBonePalette)
+layout(std140, binding = 3) uniform BonePalette
+{
+    mat4 finalBonesMatrices[MAX_BONES];
+};
 
 out vec4 vertWeights;
 
@@ -26,7 +35,7 @@ void main()
         mat4 skinningTransform = mat4(0.0f);
         for(int i = 0; i < 4; i++)
         {
-            if(aBoneIDs[i] != -1)
+            if(aWeights[i] > 0.0)
             {
                 skinningTransform += finalBonesMatrices[aBoneIDs[i]] * aWeights[i];
             }
@@ -2,6 +2,7 @@
 #include "Scene.hpp"
 #include <memory>
 #include "Skybox.hpp"
+#include "ObjectHandle.hpp"
 
 class Object;
 
@@ -40,7 +41,7 @@ private:
     float rotationSpeed = 10.0f;    // ȸ ӵ (Slerp  ӵ)
     
     //  
-    std::vector<Object*> coins; // Ȱȭ  
+    std::vector<ObjectHandle> coins; // Ȱȭ  
     int score = 0;              //  
     int totalCoins = 0;         // ü  
 };
\ No newline at end of file
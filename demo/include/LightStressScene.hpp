@@ -0,0 +1,35 @@
+﻿#pragma once
+#include "Scene.hpp"
+#include "ObjectHandle.hpp"
+#include "glm.hpp"
+#include <vector>
+
+// 반경이 있는 점광원 1000개를 움직이며 클러스터 단위 조명 배정 성능을 확인하는 씬
+class LightStressScene : public Scene
+{
+public:
+    LightStressScene();
+    virtual ~LightStressScene();
+
+    void Init() override;
+    void Update(float dt) override;
+    void Restart() override;
+    void End() override;
+    void PostRender(Camera* camera) override;
+    void RenderImGui() override;
+
+private:
+    // 조명마다 원을 그리며 움직일 궤도
+    struct LightOrbit
+    {
+        ObjectHandle handle;
+        glm::vec3 center;
+        float radius;
+        float speed;
+        float phase;
+    };
+
+    std::vector<LightOrbit> lightOrbits;
+    float elapsedTime = 0.0f;
+    bool animateLights = true;
+};
@@ -29,8 +29,7 @@ void AnimationDemoScene::Init()
     skybox->Init("asset/hdr/modern_evening_street_4k.hdr");
 
     // ٴ (Plane) 
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(0), [&](Object* object) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* object) {
         object->SetName("Ground");
         auto renderer = object->AddComponent<MeshRenderer>();
         renderer->CreatePlane();
@@ -42,8 +41,7 @@ void AnimationDemoScene::Init()
     });
 
     //  (Directional Light) - ĳ͸ ߱ 
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(1), [&](Object* object) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* object) {
         object->SetName("Sun Light");
         auto lightComp = object->AddComponent<Light>();
         lightComp->SetColor({ 1.0f, 0.95f, 0.8f }); // ణ  ޺ 
@@ -52,8 +50,7 @@ void AnimationDemoScene::Init()
     });
 
     // ߴ ĳ (DancingObject)
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(2), [](Object* object) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [](Object* object) {
         object->SetName("Michael"); // ̸ 
         object->transform.SetPosition(0.0f, 1.f, 0.0f); // ߾ ġ
         object->transform.SetRotationY(180.f); // ī޶ ٶ󺸰 ȸ
@@ -82,8 +79,7 @@ void AnimationDemoScene::Init()
     });
 
     //  ڸ ִϸ̼ ĳ (Punching Guy)
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(3), [](Object* object) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [](Object* object) {
         object->SetName("PunchingGuy");
         object->transform.SetPosition(-2.0f, 0.0f, 0.0f); // X = -2.0 ()
         object->transform.SetRotationY(180.f);
@@ -32,8 +32,7 @@ void GameScene::Init()
     skybox = std::make_unique<Skybox>();
     skybox->Init("asset/hdr/modern_evening_street_4k.hdr");
 
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(0), [&](Object* obj) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* obj) {
         obj->SetName("Ground");
         auto renderer = obj->AddComponent<MeshRenderer>();
         renderer->CreatePlane();
@@ -41,12 +40,12 @@ void GameScene::Init()
         renderer->SetColor({ 0.2f, 0.2f, 0.2f, 1.0f });
         renderer->SetMetallic(0.2f);
         renderer->SetRoughness(0.8f);
+        renderer->SetOccluder(true);
         obj->transform.SetScale(20.0f, 1.0f, 20.0f);
         obj->transform.SetPosition(0.0f, 0.0f, 0.0f);
     });
 
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(1), [&](Object* obj) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* obj) {
         obj->SetName("Player");
         obj->transform.SetPosition(0.0f, 0.0f, 0.0f);
         obj->transform.SetScale(0.01f, 0.01f, 0.01f);
@@ -65,8 +64,7 @@ void GameScene::Init()
         playerObject = obj;
     });
 
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(2), [&](Object* obj) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* obj) {
         obj->SetName("Sun Light");
         auto light = obj->AddComponent<Light>();
         light->SetType(LightType::Directional);
@@ -118,8 +116,12 @@ void GameScene::Update(float dt)
     }
 
     //  ִϸ̼ (ۺ )
-    for (Object* coin : coins)
+    ObjectManager* objectManager = Engine::GetInstance().GetObjectManager();
+    for (ObjectHandle coinHandle : coins)
     {
+        Object* coin = objectManager->FindObject(coinHandle);
+        if (!coin) continue;
+
         float currentRotY = coin->transform.GetRotation().y;
         coin->transform.SetRotationY(currentRotY + 180.0f * dt);
     }
@@ -259,11 +261,9 @@ void GameScene::CreateCoin(glm::vec3 position)
 {
     ObjectManager* objectManager = Engine::GetInstance().GetObjectManager();
 
-    objectManager->AddObject<Object>();
-    auto& objList = objectManager->GetObjectList();
-    Object* coinObj = objList.back().get();
+    ObjectHandle coinHandle = objectManager->AddObject<Object>();
 
-    objectManager->QueueObjectFunction(coinObj, [position](Object* obj) {
+    objectManager->QueueObjectFunction(coinHandle, [position](Object* obj) {
         obj->SetName("Coin");
         auto renderer = obj->AddComponent<MeshRenderer>();
         renderer->CreateCylinder();
@@ -277,7 +277,7 @@ void GameScene::CreateCoin(glm::vec3 position)
         obj->transform.SetScale(0.5f, 0.05f, 0.5f);
         obj->transform.SetRotationX(90.0f);
     });
-    coins.push_back(coinObj);
+    coins.push_back(coinHandle);
 }
 
 void GameScene::CheckCoinCollisions()
@@ -287,10 +287,19 @@ void GameScene::CheckCoinCollisions()
     glm::vec3 playerPos = playerObject->transform.GetPosition();
     float collisionDistance = 1.5f;
 
-    auto it = coins.begin();
-    while (it != coins.end())
+    ObjectManager* objectManager = Engine::GetInstance().GetObjectManager();
+
+    //  ʿ Ƿ swap-and-pop 
+    size_t i = 0;
+    while (i < coins.size())
     {
-        Object* coin = *it;
+        Object* coin = objectManager->FindObject(coins[i]);
+        if (!coin)
+        {
+            coins[i] = coins.back();
+            coins.pop_back();
+            continue;
+        }
         glm::vec3 coinPos = coin->transform.GetPosition();
         float distXZ = glm::distance(glm::vec2(playerPos.x, playerPos.z), glm::vec2(coinPos.x, coinPos.z));
 
@@ -298,12 +307,13 @@ void GameScene::CheckCoinCollisions()
         {
             std::cout << "Collected!" << std::endl;
             score++;
-            Engine::GetInstance().GetObjectManager()->DestroyObject(coin);
-            it = coins.erase(it);
+            objectManager->DestroyObject(coins[i]);
+            coins[i] = coins.back();
+            coins.pop_back();
         }
         else
         {
-            ++it;
+            ++i;
         }
     }
 }
@@ -0,0 +1,185 @@
+﻿#include "LightStressScene.hpp"
+#include "Engine.hpp"
+#include "ObjectManager.hpp"
+#include "RenderManager.hpp"
+#include "CameraManager.hpp"
+#include "MeshRenderer.hpp"
+#include "Light.hpp"
+#include "InputManager.hpp"
+#include "imgui.h"
+#include <random>
+#include <cmath>
+
+namespace
+{
+    constexpr int LIGHT_COUNT = 1000;
+    constexpr int PILLAR_GRID = 20;
+    constexpr float FIELD_SIZE = 60.0f;
+}
+
+LightStressScene::LightStressScene() {}
+LightStressScene::~LightStressScene() {}
+
+void LightStressScene::Init()
+{
+    ObjectManager* objectManager = Engine::GetInstance().GetObjectManager();
+    RenderManager* renderManager = Engine::GetInstance().GetRenderManager();
+
+    renderManager->LoadShader("basic", "asset/shaders/basic.vert", "asset/shaders/basic.frag");
+    renderManager->SetClearColor({ 0.02f, 0.02f, 0.03f, 1.0f });
+
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [](Object* object) {
+        object->SetName("Ground");
+        auto renderer = object->AddComponent<MeshRenderer>();
+        renderer->CreatePlane();
+        renderer->SetShader("basic");
+        renderer->SetColor({ 0.6f, 0.6f, 0.6f, 1.0f });
+        renderer->SetOccluder(true);
+        object->transform.SetScale(FIELD_SIZE, 1.0f, FIELD_SIZE);
+        object->transform.SetPosition(0.0f, 0.0f, 0.0f);
+    });
+
+    // 같은 지오메트리의 기둥을 격자로 배치 (인스턴싱으로 묶임)
+    float spacing = FIELD_SIZE / static_cast<float>(PILLAR_GRID);
+    for (int row = 0; row < PILLAR_GRID; ++row)
+    {
+        for (int col = 0; col < PILLAR_GRID; ++col)
+        {
+            float x = (static_cast<float>(col) + 0.5f) * spacing - FIELD_SIZE * 0.5f;
+            float z = (static_cast<float>(row) + 0.5f) * spacing - FIELD_SIZE * 0.5f;
+            objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [=](Object* object) {
+                object->SetName("Pillar " + std::to_string(row) + "_" + std::to_string(col));
+                auto renderer = object->AddComponent<MeshRenderer>();
+                renderer->CreateCube();
+                renderer->SetShader("basic");
+                renderer->SetColor({ 0.8f, 0.8f, 0.8f, 1.0f });
+                renderer->SetOccluder(true);
+                object->transform.SetScale(0.6f, 2.0f, 0.6f);
+                object->transform.SetPosition(x, 1.0f, z);
+            });
+        }
+    }
+
+    // 반경이 있는 점광원 (고정 시드로 매번 같은 배치)
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> position(-FIELD_SIZE * 0.5f, FIELD_SIZE * 0.5f);
+    std::uniform_real_distribution<float> height(0.3f, 2.5f);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    lightOrbits.clear();
+    lightOrbits.reserve(LIGHT_COUNT);
+    for (int i = 0; i < LIGHT_COUNT; ++i)
+    {
+        LightOrbit orbit;
+        orbit.center = { position(random), height(random), position(random) };
+        orbit.radius = 0.5f + unit(random) * 2.0f;
+        orbit.speed = 0.3f + unit(random) * 1.5f;
+        orbit.phase = unit(random) * 6.2831853f;
+        orbit.handle = objectManager->AddObject<Object>();
+
+        glm::vec3 color = glm::vec3(unit(random), unit(random), unit(random));
+        color /= std::max(color.r, std::max(color.g, color.b)) + 0.001f;
+        float range = 2.0f + unit(random) * 3.0f;
+        glm::vec3 start = orbit.center;
+
+        objectManager->QueueObjectFunction(orbit.handle, [=](Object* object) {
+            object->SetName("Light " + std::to_string(i));
+            object->transform.SetPosition(start);
+
+            auto light = object->AddComponent<Light>();
+            light->SetType(LightType::Point);
+            light->SetColor(color);
+            light->SetRange(range);
+            light->SetAmbientIntensity(0.0f);
+            light->SetDiffuseIntensity(1.0f);
+            light->SetSpecularIntensity(0.5f);
+        });
+        lightOrbits.push_back(orbit);
+    }
+
+    // 전체를 어둡게 비추는 방향광 (클러스터와 무관하게 모든 프래그먼트에서 계산됨)
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [](Object* object) {
+        object->SetName("Moon Light");
+        auto light = object->AddComponent<Light>();
+        light->SetType(LightType::Directional);
+        light->SetDirection({ -0.3f, -1.0f, -0.2f });
+        light->SetColor({ 0.3f, 0.35f, 0.5f });
+        light->SetAmbientIntensity(0.1f);
+        light->SetDiffuseIntensity(0.2f);
+        light->SetSpecularIntensity(0.0f);
+    });
+
+    CameraManager* camManager = Engine::GetInstance().GetCameraManager();
+    camManager->ClearCameras();
+
+    int camIdx = camManager->CreateCamera();
+    Camera* mainCam = camManager->GetCamera(camIdx);
+    mainCam->SetCameraPosition({ 0.0f, 18.0f, 40.0f });
+    mainCam->SetYaw(270.f);
+    mainCam->SetPitch(-25.f);
+    camManager->SetMainCamera(camIdx);
+
+    elapsedTime = 0.0f;
+    objectManager->Init();
+}
+
+void LightStressScene::Update(float dt)
+{
+    elapsedTime += dt;
+
+    if (animateLights)
+    {
+        ObjectManager* objectManager = Engine::GetInstance().GetObjectManager();
+        for (const LightOrbit& orbit : lightOrbits)
+        {
+            Object* object = objectManager->FindObject(orbit.handle);
+            if (!object) continue;
+
+            float angle = orbit.phase + elapsedTime * orbit.speed;
+            object->transform.SetPosition(orbit.center + glm::vec3(std::cos(angle), 0.0f, std::sin(angle)) * orbit.radius);
+        }
+    }
+
+    Camera* mainCam = Engine::GetInstance().GetCameraManager()->GetMainCamera();
+    InputManager* input = Engine::GetInstance().GetInputManager();
+
+    if (mainCam && input)
+    {
+        float speed = 15.0f * dt;
+        if (input->IsKeyPressed(KEYBOARDKEYS::W)) mainCam->MoveCameraPos(CameraMoveDir::FORWARD, speed);
+        if (input->IsKeyPressed(KEYBOARDKEYS::S)) mainCam->MoveCameraPos(CameraMoveDir::BACKWARD, speed);
+        if (input->IsKeyPressed(KEYBOARDKEYS::A)) mainCam->MoveCameraPos(CameraMoveDir::LEFT, speed);
+        if (input->IsKeyPressed(KEYBOARDKEYS::D)) mainCam->MoveCameraPos(CameraMoveDir::RIGHT, speed);
+        if (input->IsKeyPressed(KEYBOARDKEYS::SPACE)) mainCam->MoveCameraPos(CameraMoveDir::UP, speed);
+        if (input->IsKeyPressed(KEYBOARDKEYS::LSHIFT)) mainCam->MoveCameraPos(CameraMoveDir::DOWN, speed);
+
+        if (input->GetRelativeMouseMode()) mainCam->UpdateCameraDirection(input->GetRelativeMouseMotion());
+
+        if (input->IsMouseButtonPressOnce(MOUSEBUTTON::RIGHT)) input->SetRelativeMouseMode(true);
+        if (input->IsMouseButtonReleasedOnce(MOUSEBUTTON::RIGHT)) input->SetRelativeMouseMode(false);
+    }
+}
+
+void LightStressScene::PostRender(Camera* /*camera*/) {}
+
+void LightStressScene::Restart() {}
+void LightStressScene::End()
+{
+    lightOrbits.clear();
+    Engine::GetInstance().GetObjectManager()->DestroyAllObjects();
+    Engine::GetInstance().GetRenderManager()->ResetAllResources();
+    Engine::GetInstance().GetRenderManager()->SetClearColor({ 0.1f, 0.1f, 0.15f, 1.0f });
+    Engine::GetInstance().GetCameraManager()->ClearCameras();
+}
+
+void LightStressScene::RenderImGui()
+{
+    Engine::GetInstance().GetCameraManager()->CameraControllerForImGui();
+
+    ImGui::Begin("Light Stress");
+    ImGui::Text("Point Lights: %zu", lightOrbits.size());
+    ImGui::Text("Frame: %.2f ms (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
+    ImGui::Checkbox("Animate Lights", &animateLights);
+    ImGui::TextWrapped("Debug > Render Queue shows cluster statistics and the clustered / single-pass toggles.");
+    ImGui::End();
+}
@@ -33,20 +33,19 @@ void MeshesScene::Init()
     renderManager->LoadTexture("backpack", "asset/models/backpack/diffuse.jpg");
 
     // 
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(0), [&](Object* object) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* object) {
         object->SetName("Plane");
         auto renderer = object->AddComponent<MeshRenderer>();
         renderer->CreatePlane();
         renderer->SetShader("basic");
         renderer->SetTexture("wall");
+        renderer->SetOccluder(true);
         object->transform.SetPosition(0.0f, -0.75f, 0.0f);
         object->transform.SetScale(10.0f, 1.0f, 10.0f);
     });
 
     // 
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(1), [&](Object* object) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* object) {
         object->SetName("Cylinder");
         auto renderer = object->AddComponent<MeshRenderer>();
         renderer->CreateCylinder();
@@ -57,8 +56,7 @@ void MeshesScene::Init()
     });
 
     //  (Pbr ׽Ʈ)
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(2), [&](Object* object) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* object) {
         object->SetName("Sphere");
         auto renderer = object->AddComponent<MeshRenderer>();
         renderer->CreateSphere();
@@ -68,8 +66,7 @@ void MeshesScene::Init()
     });
 
     // ť
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(3), [&](Object* object) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* object) {
         object->SetName("Cube");
         auto renderer = object->AddComponent<MeshRenderer>();
         renderer->CreateCube();
@@ -79,8 +76,7 @@ void MeshesScene::Init()
     });
 
     // ̾Ƹ
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(4), [&](Object* object) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* object) {
         object->SetName("Diamond");
         auto renderer = object->AddComponent<MeshRenderer>();
         renderer->CreateDiamond();
@@ -110,10 +106,9 @@ void MeshesScene::Init()
         3, 4, 0    //  
     };
 
-    objectManager->AddObject<Object>();
         // [&] -> [=] Ǵ [, 1....] => ٰ  纻 
-    objectManager->QueueObjectFunction(objectManager->FindObject(5),
-        [pyramidVertices, pyramidIndices](Object* object) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(),
+        [pyramidVertices = std::move(pyramidVertices), pyramidIndices = std::move(pyramidIndices)](Object* object) {
         object->SetName("Pyramid");
         auto renderer = object->AddComponent<MeshRenderer>();
         renderer->CreateFromData(pyramidVertices, pyramidIndices, PrimitivePattern::Triangles);
@@ -123,8 +118,7 @@ void MeshesScene::Init()
     });
 
     // ҷ
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(6), [&](Object* object) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* object) {
         object->SetName("Backpack");
         auto renderer = object->AddComponent<MeshRenderer>();
         renderer->LoadModel("asset/models/backpack/backpack.obj");
@@ -135,8 +129,7 @@ void MeshesScene::Init()
     });
 
     //  
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(7), [&](Object* object) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* object) {
         object->SetName("Red Light");
         object->transform.SetPosition({ -2.0f, 1.0f, 2.0f });
 
@@ -152,8 +145,7 @@ void MeshesScene::Init()
     });
 
     // Ǫ 
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(8), [&](Object* object) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* object) {
         object->SetName("Blue Light");
         object->transform.SetPosition({ 2.0f, 1.0f, 2.0f });
 
@@ -169,8 +161,7 @@ void MeshesScene::Init()
     });
 
     // ʷϻ 
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(9), [&](Object* object) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* object) {
         object->SetName("Green Light");
         object->transform.SetPosition({ 0.0f, 1.0f, -2.0f });
 
@@ -186,8 +177,7 @@ void MeshesScene::Init()
     });
 
     //  
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(10), [&](Object* object) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* object) {
         object->SetName("Direction Light");
         object->transform.SetPosition({ 0.0f, 1.0f, -2.0f });
 
@@ -15,8 +15,7 @@ void MeshesScene_MultiCameraSample::Init()
     renderManager->LoadTexture("container", "asset/container.jpg");
 
     // 
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(0), [&](Object* object) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* object) {
         auto renderer = object->AddComponent<MeshRenderer>();
         renderer->CreatePlane();
         renderer->SetShader("basic");
@@ -26,8 +25,7 @@ void MeshesScene_MultiCameraSample::Init()
     });
 
     // 
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(1), [&](Object* object) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* object) {
         auto renderer = object->AddComponent<MeshRenderer>();
         renderer->CreateCylinder();
         renderer->SetShader("basic");
@@ -37,8 +35,7 @@ void MeshesScene_MultiCameraSample::Init()
     });
 
     // 
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(2), [&](Object* object) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* object) {
         auto renderer = object->AddComponent<MeshRenderer>();
         renderer->CreateSphere();
         renderer->SetShader("basic");
@@ -48,8 +45,7 @@ void MeshesScene_MultiCameraSample::Init()
     });
 
     // ť
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(3), [&](Object* object) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* object) {
         auto renderer = object->AddComponent<MeshRenderer>();
         renderer->CreateCube();
         renderer->SetShader("basic");
@@ -58,8 +54,7 @@ void MeshesScene_MultiCameraSample::Init()
     });
 
     // ̾Ƹ
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(4), [&](Object* object) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* object) {
         auto renderer = object->AddComponent<MeshRenderer>();
         renderer->CreateDiamond();
         renderer->SetShader("basic");
@@ -69,13 +64,14 @@ void MeshesScene_MultiCameraSample::Init()
 
     // CreateFromData ׽Ʈ Ƕ̵ 
     std::vector<Vertex> pyramidVertices = {
+        // ġ,                     ,                    ,                   ؽó ǥ
         // ظ
-        { {-0.5f, -0.5f, -0.5f}, {0.2f, 0.3f, 0.8f}, {0.0f, 0.0f} },
-        { { 0.5f, -0.5f, -0.5f}, {0.2f, 0.3f, 0.8f}, {1.0f, 0.0f} },
-        { { 0.5f, -0.5f,  0.5f}, {0.2f, 0.3f, 0.8f}, {1.0f, 1.0f} },
-        { {-0.5f, -0.5f,  0.5f}, {0.2f, 0.3f, 0.8f}, {0.0f, 1.0f} },
+        Vertex{ {-0.5f, -0.5f, -0.5f}, {-0.5f, -0.5f, -0.5f}, {0.2f, 0.3f, 0.8f}, {0.0f, 0.0f} }, // 0
+        Vertex{ { 0.5f, -0.5f, -0.5f}, { 0.5f, -0.5f, -0.5f}, {0.2f, 0.3f, 0.8f}, {1.0f, 0.0f} }, // 1
+        Vertex{ { 0.5f, -0.5f,  0.5f}, { 0.5f, -0.5f,  0.5f}, {0.2f, 0.3f, 0.8f}, {1.0f, 1.0f} }, // 2
+        Vertex{ {-0.5f, -0.5f,  0.5f}, {-0.5f, -0.5f,  0.5f}, {0.2f, 0.3f, 0.8f}, {0.0f, 1.0f} }, // 3
         // 
-        { { 0.0f,  0.5f,  0.0f}, {1.0f, 1.0f, 0.2f}, {0.5f, 0.5f} }
+        Vertex{ { 0.0f,  0.5f,  0.0f}, { 0.0f,  1.0f,  0.0f}, {1.0f, 1.0f, 0.2f}, {0.5f, 0.5f} }  // 4
     };
 
     std::vector<unsigned int> pyramidIndices = {
@@ -88,9 +84,8 @@ void MeshesScene_MultiCameraSample::Init()
         3, 4, 0    //  
     };
 
-    objectManager->AddObject<Object>();
     // [&] -> [=] Ǵ [, 1....] => ٰ  纻 
-    objectManager->QueueObjectFunction(objectManager->FindObject(5),
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(),
         [pyramidVertices, pyramidIndices](Object* object) {
         auto renderer = object->AddComponent<MeshRenderer>();
         renderer->CreateFromData(pyramidVertices, pyramidIndices, PrimitivePattern::Triangles);
@@ -100,8 +95,7 @@ void MeshesScene_MultiCameraSample::Init()
     });
 
     // ī޶ 1
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(6), [&](Object* object) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* object) {
         object->SetName("Cameraman 1");
         auto renderer = object->AddComponent<MeshRenderer>();
         renderer->CreateCapsule();
@@ -112,8 +106,7 @@ void MeshesScene_MultiCameraSample::Init()
     });
 
     // ī޶ 2
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(7), [&](Object* object) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* object) {
         object->SetName("Cameraman 2");
         auto renderer = object->AddComponent<MeshRenderer>();
         renderer->CreateSphere();
@@ -50,8 +50,7 @@ void MoCapScene::Init()
     CreateBones();
 
     //  ߰
-    objectManager->AddObject<Object>();
-    objectManager->QueueObjectFunction(objectManager->FindObject(0), [&](Object* obj) {
+    objectManager->QueueObjectFunction(objectManager->AddObject<Object>(), [&](Object* obj) {
         obj->SetName("Sun Light");
         auto light = obj->AddComponent<Light>();
         light->SetType(LightType::Directional);
@@ -83,11 +82,9 @@ void MoCapScene::CreateJoints()
     // BlazePose 33 帶ũ ȯ
     for (int i = 0; i < 33; ++i)
     {
-        objectManager->AddObject<Object>();
-        auto& objList = objectManager->GetObjectList();
-        Object* jointObj = objList.back().get();
+        ObjectHandle jointHandle = objectManager->AddObject<Object>();
 
-        objectManager->QueueObjectFunction(jointObj, [i, this](Object* obj) {
+        objectManager->QueueObjectFunction(jointHandle, [i, this](Object* obj) {
             std::string name = "Joint_" + std::to_string(i);
             obj->SetName(name);
 
@@ -112,10 +109,9 @@ void MoCapScene::CreateBones()
 
     for (const auto& pair : boneConnections)
     {
-        objectManager->AddObject<Object>();
-        Object* boneObj = objectManager->GetObjectList().back().get();
+        ObjectHandle boneHandle = objectManager->AddObject<Object>();
 
-        objectManager->QueueObjectFunction(boneObj, [this](Object* obj) {
+        objectManager->QueueObjectFunction(boneHandle, [this](Object* obj) {
             obj->SetName("Bone");
             auto renderer = obj->AddComponent<MeshRenderer>();
             renderer->CreateCylinder();
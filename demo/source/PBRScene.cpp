@@ -33,10 +33,9 @@ void PBRScene::Init()
         {
             float roughness = glm::clamp((float)col / (float)(cols - 1), 0.05f, 1.0f);
 
-            objectManager->AddObject<Object>();
-            auto lastObjPtr = objectManager->GetObjectList().back().get();
+            ObjectHandle sphereHandle = objectManager->AddObject<Object>();
 
-            objectManager->QueueObjectFunction(lastObjPtr, [=](Object* obj) {
+            objectManager->QueueObjectFunction(sphereHandle, [=](Object* obj) {
                 obj->SetName("Sphere_M" + std::to_string((int)(metallic * 10)) + "_R" + std::to_string((int)(roughness * 10)));
 
                 auto renderer = obj->AddComponent<MeshRenderer>();
@@ -69,10 +68,9 @@ void PBRScene::Init()
 
     for (int i = 0; i < 4; ++i)
     {
-        objectManager->AddObject<Object>();
-        auto lightObj = objectManager->GetObjectList().back().get();
+        ObjectHandle lightHandle = objectManager->AddObject<Object>();
 
-        objectManager->QueueObjectFunction(lightObj, [=](Object* obj) {
+        objectManager->QueueObjectFunction(lightHandle, [=](Object* obj) {
             obj->SetName("Light " + std::to_string(i));
             obj->transform.SetPosition(lightPositions[i]);
 
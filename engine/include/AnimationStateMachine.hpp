@@ -12,6 +12,11 @@ class Animator;
 class AnimationStateMachine : public Component
 {
 public:
+    static constexpr ComponentTypes StaticType = ComponentTypes::ANIMATION_STATE_MACHINE;
+    static constexpr UpdatePhase Phase = UpdatePhase::PreAnimation;
+    static constexpr bool ParallelUpdate = false;
+    static constexpr bool HasUpdate = false; // Update  
+
     AnimationStateMachine();
 
     void Init() override;
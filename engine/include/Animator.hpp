@@ -29,6 +29,12 @@ struct RootMotionBakeOptions
 class Animator : public Component
 {
 public:
+    static constexpr ComponentTypes StaticType = ComponentTypes::ANIMATOR;
+    // ڱ Ʈ Transform(Ʈ )  ĸ ϹǷ   
+    //   Transform ĳø  ʴ ComputeModelMatrix 
+    static constexpr UpdatePhase Phase = UpdatePhase::Animation;
+    static constexpr bool ParallelUpdate = true;
+
     Animator();
 
     void Init() override;
@@ -0,0 +1,121 @@
+﻿#pragma once
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include <type_traits>
+
+// 타입이 지워진 명령(람다)을 선형 아레나에 그대로 저장하는 버퍼
+// 블록은 Reset 후에도 재사용되므로, 한 번 크기가 잡히면 명령 추가 시 힙 할당이 발생하지 않음
+class CommandBuffer
+{
+public:
+    struct Command
+    {
+        void (*invoke)(Command*) = nullptr;
+        void (*destroy)(Command*) = nullptr;
+        uint64_t sortKey = 0;
+        uint32_t sequence = 0;  // 기록 순서 (정렬 시 같은 키끼리 순서 유지)
+        uint32_t bufferIndex = 0;
+    };
+
+    explicit CommandBuffer(size_t blockSize_ = 64 * 1024) : blockSize(blockSize_) {}
+    ~CommandBuffer() { Reset(); }
+    CommandBuffer(const CommandBuffer&) = delete;
+    CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+    template <typename Func>
+    void Record(uint64_t sortKey, Func&& func)
+    {
+        using Callable = std::decay_t<Func>;
+        struct CommandImpl : Command
+        {
+            explicit CommandImpl(Func&& f) : callable(std::forward<Func>(f)) {}
+            Callable callable;
+        };
+
+        void* memory = Allocate(sizeof(CommandImpl), alignof(CommandImpl));
+        CommandImpl* command = new (memory) CommandImpl(std::forward<Func>(func));
+        command->invoke = [](Command* base) { static_cast<CommandImpl*>(base)->callable(); };
+        command->destroy = [](Command* base) { static_cast<CommandImpl*>(base)->~CommandImpl(); };
+        command->sortKey = sortKey;
+        command->sequence = static_cast<uint32_t>(commands.size());
+        commands.push_back(command);
+    }
+
+    // 기록된 명령을 소멸시키고 아레나를 처음으로 되돌림 (블록 메모리는 유지)
+    void Reset();
+
+    const std::vector<Command*>& GetCommands() const { return commands; }
+    size_t GetCount() const { return commands.size(); }
+    size_t GetBytesUsed() const;
+    size_t GetBlockCount() const { return blocks.size(); }
+
+private:
+    struct Block
+    {
+        std::unique_ptr<std::byte[]> data;
+        size_t size = 0;
+    };
+
+    void* Allocate(size_t size, size_t alignment);
+
+    size_t blockSize;
+    std::vector<Block> blocks;
+    size_t currentBlock = 0;
+    size_t offset = 0;
+    std::vector<Command*> commands;
+};
+
+// 스레드별 CommandBuffer를 더블 버퍼로 관리하는 큐
+// 각 스레드는 자기 버퍼에만 기록하고, Execute(메인 스레드)가 버퍼를 교체한 뒤 모아서 실행함
+// 실행 도중 기록된 명령은 다른 버퍼에 쌓여 다음 Execute에서 실행됨
+class CommandQueue
+{
+public:
+    CommandQueue();
+    ~CommandQueue() = default;
+    CommandQueue(const CommandQueue&) = delete;
+    CommandQueue& operator=(const CommandQueue&) = delete;
+
+    template <typename Func>
+    void Push(uint64_t sortKey, Func&& func)
+    {
+        ThreadBuffers& buffers = GetThreadBuffers();
+        std::lock_guard<std::mutex> lock(buffers.mutex);
+        buffers.buffers[buffers.recordIndex].Record(sortKey, std::forward<Func>(func));
+    }
+
+    // sortByKey가 true면 sortKey(오브젝트) 순으로, 아니면 스레드별 기록 순서대로 실행
+    void Execute(bool sortByKey);
+    void Clear();
+
+    size_t GetLastExecutedCount() const { return lastExecutedCount; }
+    size_t GetBytesUsed() const { return lastBytesUsed; }
+    size_t GetBlockCount() const;
+    size_t GetThreadBufferCount() const { return threadBuffers.size(); }
+
+private:
+    struct ThreadBuffers
+    {
+        std::mutex mutex;
+        CommandBuffer buffers[2];
+        int recordIndex = 0;
+        std::thread::id threadId;
+    };
+
+    ThreadBuffers& GetThreadBuffers();
+
+    uint64_t queueId;
+    mutable std::mutex registryMutex;
+    std::vector<std::unique_ptr<ThreadBuffers>> threadBuffers;
+    std::vector<CommandBuffer::Command*> mergedCommands;
+    std::vector<CommandBuffer*> executingBuffers;
+
+    size_t lastExecutedCount = 0;
+    size_t lastBytesUsed = 0;
+};
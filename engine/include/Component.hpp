@@ -1,11 +1,24 @@
 #pragma once
 #include "ComponentTypes.hpp"
+#include "UpdatePhase.hpp"
+#include <cstddef>
 
 class Object;
+class ComponentPoolBase;
+class ComponentStorage;
 class Component
 {
 public:
     friend class Object;
+    friend class ComponentStorage;
+    template <typename T, size_t ChunkSize> friend class ComponentPool;
+
+    // 파생 클래스에서 다시 선언하여 업데이트 단계와 병렬 실행 여부를 지정
+    // ParallelUpdate = true 인 컴포넌트는 Update에서 자기 오브젝트의 상태만 수정해야 함
+    // HasUpdate = false 인 컴포넌트는 Update가 비어 있으므로 풀 전체를 순회하지 않음
+    static constexpr UpdatePhase Phase = UpdatePhase::PostAnimation;
+    static constexpr bool ParallelUpdate = false;
+    static constexpr bool HasUpdate = true;
 
     Component(ComponentTypes type) : componentType(type) {};
     virtual ~Component() { };
@@ -21,4 +34,8 @@ public:
 private:
     Object* owner = nullptr;
     ComponentTypes componentType;
+
+    // 컴포넌트 풀 내 위치 (풀에서 생성되지 않았다면 nullptr)
+    ComponentPoolBase* pool = nullptr;
+    unsigned int poolSlot = 0;
 };
\ No newline at end of file
@@ -0,0 +1,284 @@
+﻿#pragma once
+#include "Component.hpp"
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <typeindex>
+#include <cstddef>
+#include <new>
+
+class Object;
+class ThreadManager;
+
+// 타입별 컴포넌트 풀의 공통 인터페이스
+class ComponentPoolBase
+{
+public:
+    virtual ~ComponentPoolBase() = default;
+
+    virtual void UpdateAll(float dt) = 0;
+    // 밀집 배열의 [begin, end) 구간만 업데이트 (병렬 분할용)
+    virtual void UpdateRange(size_t begin, size_t end, float dt) = 0;
+    virtual void Release(Component* component) = 0;
+    virtual size_t GetCount() const = 0;
+    virtual size_t GetCapacity() const = 0;
+
+    ComponentTypes GetComponentType() const { return componentType; }
+    UpdatePhase GetPhase() const { return phase; }
+    bool IsParallel() const { return parallel; }
+    bool HasUpdate() const { return hasUpdate; }
+
+protected:
+    ComponentTypes componentType = ComponentTypes::INVALID;
+    UpdatePhase phase = UpdatePhase::PostAnimation;
+    bool parallel = false;
+    bool hasUpdate = true;
+};
+
+// 같은 타입의 컴포넌트를 고정 크기 청크에 연속으로 배치하는 풀
+// 청크는 재할당되지 않으므로 한 번 생성된 컴포넌트의 주소는 해제 전까지 유지됨
+template <typename T, size_t ChunkSize = 256>
+class ComponentPool : public ComponentPoolBase
+{
+public:
+    ComponentPool()
+    {
+        phase = T::Phase;
+        parallel = T::ParallelUpdate;
+        hasUpdate = T::HasUpdate;
+    }
+    ~ComponentPool() override
+    {
+        // 남아있는 컴포넌트 소멸 (정상 종료 시에는 Object 소멸자에서 이미 반환됨)
+        while (!dense.empty())
+        {
+            Release(dense.back());
+        }
+    }
+
+    ComponentPool(const ComponentPool&) = delete;
+    ComponentPool& operator=(const ComponentPool&) = delete;
+
+    template <typename... Args>
+    T* Create(Args&&... args)
+    {
+        if (freeSlots.empty())
+        {
+            AddChunk();
+        }
+        unsigned int slot = freeSlots.back();
+        freeSlots.pop_back();
+
+        T* component = new (SlotAddress(slot)) T(std::forward<Args>(args)...);
+        component->pool = this;
+        component->poolSlot = slot;
+        componentType = component->Component::GetType();
+
+        denseIndex[slot] = static_cast<unsigned int>(dense.size());
+        dense.push_back(component);
+        return component;
+    }
+
+    // 풀 밖(힙)에서 생성된 컴포넌트를 옮기지 않고 밀집 배열에만 추가 (이미 다른 곳에 주소가 등록되어 있을 수 있음)
+    void Adopt(T* component)
+    {
+        unsigned int external = 0;
+        if (freeExternalSlots.empty())
+        {
+            external = static_cast<unsigned int>(externalDenseIndex.size());
+            externalDenseIndex.push_back(0);
+        }
+        else
+        {
+            external = freeExternalSlots.back();
+            freeExternalSlots.pop_back();
+        }
+        component->pool = this;
+        component->poolSlot = EXTERNAL_SLOT | external;
+        componentType = component->Component::GetType();
+
+        DenseIndex(component->poolSlot) = static_cast<unsigned int>(dense.size());
+        dense.push_back(component);
+    }
+
+    void Release(Component* component) override
+    {
+        T* target = static_cast<T*>(component);
+        unsigned int slot = target->poolSlot;
+
+        // 밀집 배열에서 swap-and-pop으로 제거
+        unsigned int index = DenseIndex(slot);
+        T* last = dense.back();
+        dense[index] = last;
+        DenseIndex(last->poolSlot) = index;
+        dense.pop_back();
+
+        if (slot & EXTERNAL_SLOT)
+        {
+            delete target;
+            freeExternalSlots.push_back(slot & ~EXTERNAL_SLOT);
+        }
+        else
+        {
+            target->~T();
+            freeSlots.push_back(slot);
+        }
+    }
+
+    // 밀집 배열을 순서대로 순회하며 가상 호출 없이 Update를 실행
+    void UpdateAll(float dt) override
+    {
+        // Update 도중 추가된 컴포넌트는 다음 프레임부터 업데이트 (UpdateRange는 인덱스 기반으로 순회)
+        UpdateRange(0, dense.size(), dt);
+    }
+
+    void UpdateRange(size_t begin, size_t end, float dt) override
+    {
+        if (UpdateWriteGuard::IsEnabled() && parallel)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                UpdateWriteGuard::Begin(dense[i]);
+                dense[i]->T::Update(dt);
+                UpdateWriteGuard::End();
+            }
+            return;
+        }
+        for (size_t i = begin; i < end; ++i)
+        {
+            dense[i]->T::Update(dt);
+        }
+    }
+
+    size_t GetCount() const override { return dense.size(); }
+    size_t GetCapacity() const override { return chunks.size() * ChunkSize; }
+    const std::vector<T*>& GetComponents() const { return dense; }
+
+private:
+    static constexpr unsigned int EXTERNAL_SLOT = 0x80000000u; // poolSlot 최상위 비트: Adopt로 편입된 컴포넌트
+
+    struct Chunk
+    {
+        alignas(T) std::byte storage[sizeof(T) * ChunkSize];
+    };
+
+    void AddChunk()
+    {
+        chunks.push_back(std::make_unique<Chunk>());
+        unsigned int base = static_cast<unsigned int>((chunks.size() - 1) * ChunkSize);
+        denseIndex.resize(chunks.size() * ChunkSize, 0);
+
+        // 낮은 슬롯부터 꺼내도록 역순으로 넣어 청크 앞쪽부터 채움
+        for (size_t i = ChunkSize; i > 0; --i)
+        {
+            freeSlots.push_back(base + static_cast<unsigned int>(i - 1));
+        }
+    }
+
+    unsigned int& DenseIndex(unsigned int slot)
+    {
+        return (slot & EXTERNAL_SLOT) ? externalDenseIndex[slot & ~EXTERNAL_SLOT] : denseIndex[slot];
+    }
+
+    void* SlotAddress(unsigned int slot)
+    {
+        Chunk* chunk = chunks[slot / ChunkSize].get();
+        return chunk->storage + sizeof(T) * (slot % ChunkSize);
+    }
+
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    std::vector<unsigned int> freeSlots;
+    std::vector<unsigned int> denseIndex; // 슬롯 -> 밀집 배열 인덱스
+    std::vector<unsigned int> externalDenseIndex; // Adopt된 컴포넌트의 슬롯 -> 밀집 배열 인덱스
+    std::vector<unsigned int> freeExternalSlots;
+    std::vector<T*> dense;                // 살아있는 컴포넌트 (순회용)
+};
+
+// 모든 컴포넌트 풀과 아키타입(컴포넌트 조합) 테이블을 관리
+class ComponentStorage
+{
+public:
+    ComponentStorage() = default;
+    ~ComponentStorage() = default;
+    ComponentStorage(const ComponentStorage&) = delete;
+    ComponentStorage& operator=(const ComponentStorage&) = delete;
+
+    template <typename T, typename... Args>
+    T* Create(Args&&... args)
+    {
+        return GetOrCreatePool<T>()->Create(std::forward<Args>(args)...);
+    }
+
+    template <typename T>
+    ComponentPool<T>* GetPool()
+    {
+        auto it = poolLookup.find(std::type_index(typeid(T)));
+        if (it == poolLookup.end())
+        {
+            return nullptr;
+        }
+        return static_cast<ComponentPool<T>*>(it->second);
+    }
+
+    // 등록 전에 힙에 생성된 컴포넌트를 해당 타입의 풀에 편입 (Attach에서 호출)
+    template <typename T>
+    void Adopt(T* component)
+    {
+        GetOrCreatePool<T>()->Adopt(component);
+    }
+
+    // 컴포넌트를 생성한 풀로 반환 (풀 밖에서 생성된 경우 delete)
+    static void Destroy(Component* component);
+
+    // 단계 순서대로 풀을 업데이트, 병렬 컴포넌트는 threadManager의 워커에 나눠서 실행
+    void UpdateAll(float dt, ThreadManager* threadManager = nullptr);
+
+    void SetParallelUpdate(bool enable) { parallelUpdate = enable; }
+    bool IsParallelUpdate() const { return parallelUpdate; }
+
+    // 아키타입: 같은 컴포넌트 시그니처를 가진 오브젝트끼리 묶어서 보관
+    // Attach는 등록 전에 추가된 컴포넌트도 풀에 편입해 UpdateAll에서 업데이트되게 함
+    void Attach(Object* object);
+    void Detach(Object* object);
+    void ChangeSignature(Object* object, ComponentSignature newSignature);
+
+    // required 컴포넌트를 모두 가진 아키타입의 오브젝트 목록마다 func를 호출
+    template <typename Func>
+    void ForEachArchetype(ComponentSignature required, Func&& func) const
+    {
+        for (const auto& pair : archetypes)
+        {
+            if ((pair.first & required) == required && !pair.second.empty())
+            {
+                func(pair.second);
+            }
+        }
+    }
+
+    const std::vector<std::unique_ptr<ComponentPoolBase>>& GetPools() const { return pools; }
+    const std::unordered_map<ComponentSignature, std::vector<Object*>>& GetArchetypes() const { return archetypes; }
+
+private:
+    template <typename T>
+    ComponentPool<T>* GetOrCreatePool()
+    {
+        ComponentPool<T>* pool = GetPool<T>();
+        if (pool == nullptr)
+        {
+            auto newPool = std::make_unique<ComponentPool<T>>();
+            pool = newPool.get();
+            poolLookup.emplace(std::type_index(typeid(T)), pool);
+            phasePools[static_cast<size_t>(T::Phase)].push_back(pool);
+            pools.push_back(std::move(newPool));
+        }
+        return pool;
+    }
+
+    void RemoveFromArchetype(Object* object);
+
+    std::vector<std::unique_ptr<ComponentPoolBase>> pools; // 등록 순서대로 업데이트
+    std::unordered_map<std::type_index, ComponentPoolBase*> poolLookup;
+    std::vector<ComponentPoolBase*> phasePools[static_cast<size_t>(UpdatePhase::Count)]; // 단계별 풀 (등록 순서)
+    bool parallelUpdate = true;
+    std::unordered_map<ComponentSignature, std::vector<Object*>> archetypes;
+};
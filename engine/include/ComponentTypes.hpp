@@ -1,5 +1,7 @@
 #pragma once
 #include <string>
+#include <cstddef>
+#include <concepts>
 
 enum class ComponentTypes
 {
@@ -10,10 +12,35 @@ enum class ComponentTypes
     INVALID 
 };
 
+// 실제 컴포넌트 타입 개수 (INVALID 제외), 오브젝트별 슬롯 테이블 크기로 사용
+constexpr size_t COMPONENT_TYPE_COUNT = static_cast<size_t>(ComponentTypes::INVALID);
+
+// 클래스 안에 static constexpr ComponentTypes StaticType 을 선언한 컴포넌트는
+// 컴파일 타임에 타입 ID가 정해지므로 dynamic_cast 없이 슬롯으로 바로 조회 가능
+// (이런 컴포넌트를 상속하는 클래스는 자신의 StaticType을 다시 선언해야 함)
+template <typename T>
+concept StaticComponentType = requires { { T::StaticType } -> std::convertible_to<ComponentTypes>; };
+
+// 오브젝트가 가진 컴포넌트 조합을 비트로 표현 (아키타입 키)
+using ComponentSignature = unsigned int;
+
+constexpr ComponentSignature ToSignatureBit(ComponentTypes type)
+{
+    if (type == ComponentTypes::INVALID)
+        return 0u;
+    return 1u << static_cast<unsigned int>(type);
+}
+
 inline ComponentTypes StringToComponent(const std::string& string)
 {
     if (string == "MESHRENDERER")
        return ComponentTypes::MESHRENDERER;
+    if (string == "LIGHT")
+        return ComponentTypes::LIGHT;
+    if (string == "ANIMATOR")
+        return ComponentTypes::ANIMATOR;
+    if (string == "ANIMATION_STATE_MACHINE")
+        return ComponentTypes::ANIMATION_STATE_MACHINE;
     return ComponentTypes::INVALID;
 }
 
@@ -21,5 +48,11 @@ inline std::string ComponentToString(ComponentTypes type)
 {
     if (type == ComponentTypes::MESHRENDERER)
         return "MESHRENDERER";
+    if (type == ComponentTypes::LIGHT)
+        return "LIGHT";
+    if (type == ComponentTypes::ANIMATOR)
+        return "ANIMATOR";
+    if (type == ComponentTypes::ANIMATION_STATE_MACHINE)
+        return "ANIMATION_STATE_MACHINE";
     return "INVALID";
 }
\ No newline at end of file
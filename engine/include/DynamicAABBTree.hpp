@@ -0,0 +1,229 @@
+﻿#pragma once
+#include "Bounds.hpp"
+#include <vector>
+#include <cstdint>
+
+// 삽입/삭제/이동이 가능한 AABB 트리 (잎 = 프록시 하나, 내부 노드 = 두 자식을 감싸는 상자)
+// 잎은 실제 경계보다 여유(margin)를 둔 상자를 저장하므로, 조금 움직인 프록시는 트리를 건드리지 않음
+// 삽입 위치는 표면적 증가량(SAH)이 가장 작은 쪽으로 내려가며 고르고, 갱신된 조상마다 표면적이 줄어드는 회전을 적용
+class DynamicAABBTree
+{
+public:
+    static constexpr int NULL_NODE = -1;
+
+    // 여유 = 상자 반폭 * ratio + minimum (축마다)
+    void SetMargin(float ratio, float minimum) { marginRatio = ratio; marginMinimum = minimum; }
+
+    int CreateProxy(const AABB& bounds, uint32_t userData);
+    void DestroyProxy(int proxyId);
+    // 새 경계가 여유 상자 안이면 그대로 두고 false, 벗어났으면 빼서 다시 삽입하고 true
+    bool MoveProxy(int proxyId, const AABB& bounds);
+    void Clear();
+
+    uint32_t GetUserData(int proxyId) const { return nodes[proxyId].userData; }
+    const AABB& GetFatBounds(int proxyId) const { return nodes[proxyId].bounds; }
+    int GetProxyCount() const { return proxyCount; }
+    int GetHeight() const { return root == NULL_NODE ? 0 : nodes[root].height; }
+    // 내부 노드 표면적 합 / 루트 표면적 (작을수록 순회 비용이 낮음)
+    float GetAreaRatio() const;
+
+    // func(userData): 겹치는 모든 프록시에 대해 호출 (여유 상자 기준이므로 호출된 쪽에서 실제 경계로 다시 판정 가능)
+    template <typename Func>
+    void QueryAABB(const AABB& bounds, Func&& func) const
+    {
+        Traverse([&](const Node& node) { return node.bounds.Overlaps(bounds); }, func);
+    }
+
+    template <typename Func>
+    void QuerySphere(const glm::vec3& center, float radius, Func&& func) const
+    {
+        Traverse([&](const Node& node) { return node.bounds.OverlapsSphere(center, radius); }, func);
+    }
+
+    // 절두체 안에 완전히 들어온 노드는 아래 잎들을 판정 없이 모두 보고
+    // 부모가 이미 완전히 안쪽에 있는 평면은 자식에서 다시 판정하지 않음
+    template <typename Func>
+    void QueryFrustum(const Frustum& frustum, Func&& func) const
+    {
+        struct Entry
+        {
+            int index;
+            uint8_t planeMask;
+        };
+        TraversalStack<Entry> stack;
+        if (root != NULL_NODE) stack.Push({ root, Frustum::ALL_PLANES });
+        while (!stack.IsEmpty())
+        {
+            Entry entry = stack.Pop();
+            const Node& node = nodes[entry.index];
+            FrustumTest test = frustum.ClassifyAABB(node.bounds, entry.planeMask);
+            if (test == FrustumTest::Outside)
+            {
+                continue;
+            }
+            if (node.IsLeaf())
+            {
+                func(node.userData);
+            }
+            else if (test == FrustumTest::Inside)
+            {
+                ReportLeaves(node, func);
+            }
+            else
+            {
+                stack.Push({ node.child1, entry.planeMask });
+                stack.Push({ node.child2, entry.planeMask });
+            }
+        }
+    }
+
+    // func(userData, maxDistance) -> 새 maxDistance (맞았으면 맞은 거리, 아니면 그대로)
+    // 반환값이 줄어들면 그보다 먼 노드는 건너뜀 -> 가장 가까운 물체를 찾을 때 사용
+    template <typename Func>
+    void RayCast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, Func&& func) const
+    {
+        glm::vec3 inverseDirection = 1.0f / direction;
+        TraversalStack<> stack;
+        if (root != NULL_NODE) stack.Push(root);
+        while (!stack.IsEmpty())
+        {
+            const Node& node = nodes[stack.Pop()];
+            float hitDistance;
+            if (!node.bounds.IntersectRay(origin, inverseDirection, maxDistance, hitDistance))
+            {
+                continue;
+            }
+            if (node.IsLeaf())
+            {
+                maxDistance = func(node.userData, maxDistance);
+            }
+            else
+            {
+                stack.Push(node.child1);
+                stack.Push(node.child2);
+            }
+        }
+    }
+
+private:
+    struct Node
+    {
+        AABB bounds;
+        int parent = NULL_NODE; // 빈 노드면 다음 빈 노드
+        int child1 = NULL_NODE;
+        int child2 = NULL_NODE;
+        int height = 0;         // 잎 = 0, 빈 노드 = -1
+        uint32_t userData = 0;
+
+        bool IsLeaf() const { return child1 == NULL_NODE; }
+    };
+
+    // 앞쪽 64칸은 스택 배열을 쓰고 넘치면 힙으로 옮기는 순회용 스택 (회전으로 트리가 깊어질 수 있음)
+    template <typename T = int>
+    class TraversalStack
+    {
+    public:
+        void Push(const T& item)
+        {
+            if (count < INLINE_CAPACITY) inlineItems[count] = item;
+            else overflow.push_back(item);
+            ++count;
+        }
+        T Pop()
+        {
+            --count;
+            if (count < INLINE_CAPACITY) return inlineItems[count];
+            T item = overflow.back();
+            overflow.pop_back();
+            return item;
+        }
+        bool IsEmpty() const { return count == 0; }
+    private:
+        static constexpr int INLINE_CAPACITY = 64;
+        T inlineItems[INLINE_CAPACITY];
+        std::vector<T> overflow;
+        int count = 0;
+    };
+
+    template <typename Predicate, typename Func>
+    void Traverse(Predicate&& overlaps, Func&& func) const
+    {
+        TraversalStack<> stack;
+        if (root != NULL_NODE) stack.Push(root);
+        while (!stack.IsEmpty())
+        {
+            const Node& node = nodes[stack.Pop()];
+            if (!overlaps(node))
+            {
+                continue;
+            }
+            if (node.IsLeaf())
+            {
+                func(node.userData);
+            }
+            else
+            {
+                stack.Push(node.child1);
+                stack.Push(node.child2);
+            }
+        }
+    }
+
+    template <typename Func>
+    void ReportLeaves(const Node& subtreeRoot, Func&& func) const
+    {
+        TraversalStack<> subtree;
+        subtree.Push(subtreeRoot.child1);
+        subtree.Push(subtreeRoot.child2);
+        while (!subtree.IsEmpty())
+        {
+            const Node& node = nodes[subtree.Pop()];
+            if (node.IsLeaf())
+            {
+                func(node.userData);
+            }
+            else
+            {
+                subtree.Push(node.child1);
+                subtree.Push(node.child2);
+            }
+        }
+    }
+
+    int AllocateNode();
+    void FreeNode(int index);
+    AABB MakeFatBounds(const AABB& bounds) const;
+    void InsertLeaf(int leaf);
+    void RemoveLeaf(int leaf);
+    // index부터 루트까지 경계/높이를 다시 계산하고 각 노드에서 회전 시도
+    void RefitAncestors(int index);
+    void RotateNodes(int index);
+
+    std::vector<Node> nodes;
+    int root = NULL_NODE;
+    int freeList = NULL_NODE;
+    int proxyCount = 0;
+    float marginRatio = 0.1f;
+    float marginMinimum = 0.05f;
+};
+
+// 무작위 상자 objectCount개로 트리 구축/이동/질의 시간을 측정하고 전수 검사 결과와 비교
+struct SpatialTreeBenchmarkResult
+{
+    int objectCount = 0;
+    float buildMs = 0.0f;
+    float moveMs = 0.0f;          // 1%를 조금, 1%를 멀리 이동
+    int reinsertedProxies = 0;    // 이동 중 여유 상자를 벗어나 다시 삽입된 수
+    float frustumTreeMs = 0.0f;
+    float frustumLinearMs = 0.0f; // SIMD 선형 컬링 (Frustum::CullBoxes)
+    int frustumVisible = 0;
+    float rayTreeMs = 0.0f;       // 광선 1000개
+    float rayLinearMs = 0.0f;
+    float overlapTreeMs = 0.0f;   // 상자/구 겹침 질의 각 500개
+    float overlapLinearMs = 0.0f;
+    int treeHeight = 0;
+    float areaRatio = 0.0f;
+    bool matchesBruteForce = false;
+};
+
+SpatialTreeBenchmarkResult RunSpatialTreeBenchmark(int objectCount);
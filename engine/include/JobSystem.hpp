@@ -0,0 +1,96 @@
+﻿#pragma once
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+class ThreadManager;
+
+// 잡 그룹의 남은 개수를 세는 카운터
+// Wait로 완료를 기다리거나, 다른 잡의 의존성으로 사용 (0이 되면 대기 중인 잡이 큐에 들어감)
+class JobCounter
+{
+public:
+    JobCounter() = default;
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    bool IsDone() const { return pending.load(std::memory_order_acquire) == 0; }
+    int GetPending() const { return pending.load(std::memory_order_acquire); }
+
+private:
+    friend class ThreadManager;
+
+    struct Continuation
+    {
+        std::function<void()> func;
+        JobCounter* counter = nullptr;
+    };
+
+    std::atomic<int> pending{ 0 };
+    std::mutex continuationMutex;
+    std::vector<Continuation> continuations; // 이 카운터가 0이 되기를 기다리는 잡
+};
+
+struct Job
+{
+    std::function<void()> func;
+    JobCounter* counter = nullptr; // 완료 시 감소시킬 카운터 (없으면 nullptr)
+};
+
+// 워커별 잡 덱
+// 소유 스레드는 뒤에서 넣고 빼며(LIFO, 캐시 친화적), 다른 스레드는 앞에서 훔쳐감(FIFO)
+class JobQueue
+{
+public:
+    void Push(Job&& job)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push_back(std::move(job));
+    }
+
+    bool Pop(Job& outJob)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (jobs.empty())
+        {
+            return false;
+        }
+        outJob = std::move(jobs.back());
+        jobs.pop_back();
+        return true;
+    }
+
+    bool Steal(Job& outJob)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (jobs.empty())
+        {
+            return false;
+        }
+        outJob = std::move(jobs.front());
+        jobs.pop_front();
+        return true;
+    }
+
+private:
+    std::mutex mutex;
+    std::deque<Job> jobs;
+};
+
+// 잡 시스템 통계 (ImGui 표시용)
+struct JobSystemStats
+{
+    unsigned long long executedJobs = 0;
+    unsigned long long stolenJobs = 0;
+};
+
+// std::async 대비 스케줄링 오버헤드 측정 결과
+struct JobBenchmarkResult
+{
+    int jobCount = 0;
+    float jobSystemMs = 0.0f;
+    float parallelForMs = 0.0f;
+    float asyncMs = 0.0f;
+};
@@ -0,0 +1,114 @@
+﻿#pragma once
+#include <glm.hpp>
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+// [0, count)를 나눠 func(begin, end)로 실행하는 병렬 실행기 (비어 있으면 현재 스레드에서 순차 실행)
+using ClusterParallelFor = std::function<void(int count, const std::function<void(int, int)>& func)>;
+
+struct LightClusterStats
+{
+    int clusteredLights = 0;       // 절두체와 겹쳐 하나 이상의 클러스터에 배정된 조명 수
+    int assignments = 0;           // 클러스터-조명 배정 총 개수
+    int maxLightsInCluster = 0;
+    int overflowedAssignments = 0; // 클러스터당 최대 개수를 넘어 버려진 배정
+    float buildMs = 0.0f;
+};
+
+// 카메라 절두체를 [x, y, z] 격자로 나누고(z는 깊이에 대해 지수 분할) 점광원 구를 겹치는 클러스터에 배정
+// 결과는 클러스터마다 (시작 위치, 개수) + 조명 번호 목록이며, GL 없이 동작하므로 따로 검사할 수 있음
+// 클러스터 번호 = x + dimX * (y + dimY * z), 타일 y = 0은 화면 아래쪽 (gl_FragCoord와 같음)
+class LightClusterGrid
+{
+public:
+    void SetDimensions(int x, int y, int z, int maxLightsPerCluster_);
+    void SetUseSimd(bool use) { useSimd = use; }
+    bool GetUseSimd() const { return useSimd; }
+
+    // lightSpheres: xyz = 월드 위치, w = 영향 반경, 결과의 조명 번호는 이 배열의 인덱스
+    // projection은 원근 투영이어야 함 (glm::perspective)
+    void Build(const glm::mat4& view, const glm::mat4& projection, float nearClip, float farClip,
+        const std::vector<glm::vec4>& lightSpheres, const ClusterParallelFor& parallelFor = {});
+
+    glm::ivec3 GetDimensions() const { return { dimX, dimY, dimZ }; }
+    int GetClusterCount() const { return dimX * dimY * dimZ; }
+    int GetMaxLightsPerCluster() const { return maxLightsPerCluster; }
+    // 셰이더에서 slice = log(깊이) * scale + bias로 z 슬라이스를 구함
+    float GetSliceScale() const { return sliceScale; }
+    float GetSliceBias() const { return sliceBias; }
+
+    // 마지막 Build 기준 월드 위치가 속한 클러스터 (절두체 밖이면 -1)
+    int FindCluster(const glm::vec3& worldPosition) const;
+
+    const std::vector<glm::uvec2>& GetClusterRanges() const { return clusterRanges; } // x = 시작 위치, y = 개수
+    const std::vector<uint32_t>& GetLightIndices() const { return lightIndices; }
+    const LightClusterStats& GetStats() const { return stats; }
+
+    // 모든 클러스터 x 조명 쌍을 같은 판정식으로 전수 검사 (결과 검증용, 느림)
+    void BuildReference(const glm::mat4& view, const glm::mat4& projection, float nearClip, float farClip,
+        const std::vector<glm::vec4>& lightSpheres);
+
+private:
+    // 뷰 공간(z는 카메라 앞쪽이 양수)으로 옮긴 조명
+    struct ViewLight
+    {
+        glm::vec3 center;
+        float radiusSq;
+        uint32_t index;
+    };
+
+    void UpdateFrustum(const glm::mat4& projection, float nearClip, float farClip);
+    void CullLights(const glm::mat4& view, const std::vector<glm::vec4>& lightSpheres);
+    void ResetClusters();
+    // 슬라이스 -> 행 -> 타일 순으로 구와 클러스터 AABB의 거리를 누적하며 판정 (BuildReference와 같은 식)
+    void AssignSlices(int beginSlice, int endSlice);
+    void AssignRowScalar(const ViewLight& light, int z, int y, float remainingSq);
+    void AssignRowSimd(const ViewLight& light, int z, int y, float remainingSq);
+    void AddToCluster(int cluster, uint32_t lightIndex);
+    void Compact(float buildMs);
+
+    int dimX = 16;
+    int dimY = 9;
+    int dimZ = 24;
+    int maxLightsPerCluster = 128;
+    bool useSimd = true;
+
+    // 절두체 (UpdateFrustum에서 바뀐 경우에만 클러스터 경계를 다시 계산)
+    float tanHalfX = 0.0f;
+    float tanHalfY = 0.0f;
+    float nearPlane = 0.0f;
+    float farPlane = 0.0f;
+    float sliceScale = 0.0f;
+    float sliceBias = 0.0f;
+    bool boundsDirty = true;
+    glm::mat4 lastView = glm::mat4(1.0f);
+
+    // 클러스터 경계 (뷰 공간 AABB): x 범위는 (슬라이스, 타일 x), y 범위는 (슬라이스, 타일 y), z 범위는 슬라이스에만 의존
+    std::vector<float> tileMinX, tileMaxX; // [z * dimX + x]
+    std::vector<float> tileMinY, tileMaxY; // [z * dimY + y]
+    std::vector<float> sliceNear, sliceFar; // [z]
+
+    std::vector<ViewLight> viewLights;
+    std::vector<uint32_t> clusterCounts;
+    std::vector<uint32_t> clusterSlots;     // 클러스터마다 maxLightsPerCluster칸
+    std::vector<int> sliceOverflow;         // 슬라이스별 버려진 배정 수 (슬라이스마다 한 스레드만 씀)
+
+    std::vector<glm::uvec2> clusterRanges;
+    std::vector<uint32_t> lightIndices;
+    LightClusterStats stats;
+};
+
+// 전수 검사 결과와 비교 + 스칼라/SIMD/멀티스레드 배정 시간 측정
+struct LightClusterBenchmarkResult
+{
+    int lightCount = 0;
+    float scalarMs = 0.0f;
+    float simdMs = 0.0f;
+    float parallelMs = 0.0f;
+    float referenceMs = 0.0f;
+    int assignments = 0;
+    bool matchesReference = false;
+};
+
+LightClusterBenchmarkResult RunLightClusterBenchmark(int lightCount, const ClusterParallelFor& parallelFor);
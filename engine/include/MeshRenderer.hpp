@@ -2,26 +2,62 @@
 #include "Component.hpp"
 #include "Mesh.hpp"
 #include <memory>
+#include <vector>
 
 class Shader;
 class Texture;
 class Camera;
 class Model;
 class Light;
+class RenderQueue;
+class OcclusionCuller;
+struct InstanceData;
 
 enum class RenderMode { Fill, Wireframe }; 
 enum class MeshShape { Cube, Sphere, Cylinder, Plane, None };
 
+// ȭ ũ  LOD  
+// ȭ ũ =     / ȭ   (1̸ ȭ ̸  ä)
+struct LodSelectionSettings
+{
+    bool enabled = true;
+    // ȭ ũⰡ screenThresholds[i] ۾ i + 1 ܰ  ()
+    float screenThresholds[Mesh::MAX_LOD_LEVELS - 1] = { 0.3f, 0.15f, 0.075f };
+    //  ó ܰ谡   ٲ ʵ   (1 - h), ö  (1 + h)踦 Ѿ ٲ
+    float hysteresis = 0.1f;
+    int forcedLevel = -1; // 0 ̸̻  ޽ø  ܰ (޽ð  ܰ  )
+};
+
 class MeshRenderer : public Component
 {
 public:
-    MeshRenderer() : Component(ComponentTypes::MESHRENDERER) {}
+    static constexpr ComponentTypes StaticType = ComponentTypes::MESHRENDERER;
+    static constexpr UpdatePhase Phase = UpdatePhase::LateUpdate;
+    static constexpr bool ParallelUpdate = false;
+    static constexpr bool HasUpdate = false; // Update  
+
+    MeshRenderer() : Component(StaticType) {}
 
     void Init() override;
     void Update(float dt) override;
     void End() override;
 
-    void Render(Camera* camera, Light* light);
+    //   ο (̸ ޽ø ϳ)  ť ߰
+    // ī޶󸶴 ȭ ũ LOD ܰ踦   ޽ð  ܰ  ȿ 
+    void CollectDrawItems(RenderQueue& queue, const Camera* camera, const LodSelectionSettings& lodSettings = {});
+    // ο츶 ޶ ( , , , PBR ) 
+    void ApplyDrawUniforms(Shader* activeShader) const;
+    // νϽ   ִ (   Ű ޽ô  ο)
+    bool CanInstance() const;
+    void FillInstanceData(InstanceData& instance) const;
+    // ø   (Ű ޽ô      )
+    // 踦    false (ٸ Ʈ      ) -> ׻ ׸
+    bool ComputeWorldBounds(AABB& worldBounds) const;
+    //  ϸ CPU  ۿ ׷  ü  (ٴ, ó ũ  ޽)
+    void SetOccluder(bool occluder_) { occluder = occluder_; }
+    bool IsOccluder() const { return occluder; }
+    // ޽(̸  ޽) ﰢ   (̾//Ű ޽ô  Ƿ )
+    void SubmitOccluder(OcclusionCuller& culler) const;
 
     void CreatePlane();
     void CreateCube();
@@ -30,6 +66,7 @@ public:
     void CreateCylinder();
     void CreateCapsule();
     void CreateFromData(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, PrimitivePattern pattern);
+    // currentShape stacks/slices ´  ޽÷ ü (MeshShape::None̸ ޽ø )
     void RebuildMesh();
 
     void SetShader(const std::string& name);
@@ -42,16 +79,17 @@ public:
     Model* GetModel() const { return model.get(); }
 
     void SetRenderMode(RenderMode mode) { renderMode = mode; }
+    RenderMode GetRenderMode() const { return renderMode; }
 
     void SetColor(const glm::vec4& color_) { color = color_; }
     const glm::vec4& GetColor() const { return color; }
+    // İ 1   Ͽ  ü ڿ  ͺ ׸
+    bool IsTransparent() const { return color.a < 1.0f; }
 
     void SetMetallic(float metallic_) { metallic = metallic_; }
     float GetMetallic() { return metallic; }
     void SetRoughness(float roughness_) { roughness = roughness_; }
     float GetRoughness() { return roughness; }
-    void SetExposure(float exp) { exposure = exp; }
-    float GetExposure() const { return exposure; }
 
     void SetStacks(int amount) { stacks = amount; }
     int GetStacks() const { return stacks; }
@@ -61,8 +99,17 @@ public:
     void SetMeshShape(MeshShape shape) { currentShape = shape; }
     MeshShape GetMeshShape() const { return currentShape; }
 private:
+    friend class RenderManager;
+    // ޽  Ŀ ´ RenderManager Ʈ Ǯ ø
+    static void UploadMesh(Mesh& target);
+    void SetProceduralMesh(ProceduralShape shape, int param0 = 0, int param1 = 0);
+    // ޽//̴ ٲ -> ġ ״ο  ε 踦 ٽ ϵ ObjectManager ˸
+    void InvalidateBounds();
+    int renderIndex = -1; // RenderManager::renderers  ġ (-1̸ ̵)
+    bool occluder = false;
+
     std::shared_ptr<Model> model; //   ε
-    std::unique_ptr<Mesh> mesh;   // CreateCube   
+    std::shared_ptr<const Mesh> mesh; // CreateCube    (RenderManager  ޽) Ǵ CreateFromData   ޽
     std::shared_ptr<Shader> shader;
     std::shared_ptr<Texture> texture;
     RenderMode renderMode = RenderMode::Fill;
@@ -71,8 +118,32 @@ private:
     int stacks = 18;
     int slices = 36;
 
+    // ī޶󸶴   LOD ܰ (׸ý , Camera::GetId )
+    struct LodState
+    {
+        uint32_t cameraId = 0;
+        int level = 0;
+    };
+    std::vector<LodState> lodStates;
+    int SelectLod(const Camera* camera, const LodSelectionSettings& settings);
+    //  ī޶ LOD   (RenderManager::RemoveCameraState)
+    void RemoveLodState(uint32_t cameraId);
+
     glm::vec4 color = glm::vec4(1.0f);
     float metallic = 0.5f;
     float roughness = 0.5f; 
-    float exposure = 0.5f;
+
+    //  ׸ ̴  ġ (̴ ٲ  ٽ ã, -1̸ ̴  )
+    struct UniformLocations
+    {
+        uint32_t shaderSerial = 0;
+        int model = -1;
+        int bonePaletteSize = 0; // BonePalette   ũ (0̸ Ű ʴ ̴)
+        int useTexture = -1;
+        int texture = -1;
+        int color = -1;
+        int metallic = -1;
+        int roughness = -1;
+    };
+    mutable UniformLocations uniformLocations;
 };
@@ -1,70 +1,146 @@
 #pragma once
 
 #include <vector>
+#include <array>
 #include <memory>
 #include <string>
+#include <string_view>
 #include "ObjectType.hpp"
+#include "ObjectHandle.hpp"
 #include "Transform.hpp"
 #include "Component.hpp"
+#include "ComponentStorage.hpp"
+#include "StringHash.hpp"
 
+class ObjectManager;
 class Object
 {
 public:
+    friend class ObjectManager;
+    friend class ComponentStorage;
+
     Object() = default;
     ~Object();
- 
-    virtual void Update(float dt);
+    Object(const Object&) = delete;
+    Object& operator=(const Object&) = delete;
 
     void SetType(ObjectType newType){ type = newType; }
     ObjectType GetType() const { return type; }
 
-    void SetName(const std::string& newName) { name = newName; }
+    // ObjectManager에 등록된 오브젝트는 이름/태그 변경 시 해시 인덱스도 함께 갱신됨
+    void SetName(const std::string& newName);
     const std::string& GetName() const { return name; }
+    uint64_t GetNameHash() const { return nameHash; }
+
+    void AddTag(std::string_view tag);
+    void RemoveTag(std::string_view tag);
+    bool HasTag(std::string_view tag) const;
+    const std::vector<uint64_t>& GetTags() const { return tags; }
+
+    ObjectHandle GetHandle() const { return handle; }
+    bool IsPendingDestroy() const { return pendingDestroy; }
 
     template <typename T, typename... Args>
     T* AddComponent(Args&&... args)
     {
-        auto newComponent = std::make_unique<T>(std::forward<Args>(args)...);
-        newComponent->SetOwner(this);
-        newComponent->Init();
+        // ObjectManager에 등록된 오브젝트는 타입별 컴포넌트 풀에 연속으로 생성
+        T* componentPtr = nullptr;
+        if (storage)
+        {
+            componentPtr = storage->Create<T>(std::forward<Args>(args)...);
+        }
+        else
+        {
+            // 등록 전(파생 오브젝트의 생성자 등)에 추가된 컴포넌트는 힙에 만들고 Attach 때 풀에 편입
+            componentPtr = new T(std::forward<Args>(args)...);
+            unpooledComponents.emplace_back(componentPtr, [](ComponentStorage& target, Component* component)
+            {
+                target.Adopt(static_cast<T*>(component));
+            });
+        }
+        componentPtr->SetOwner(this);
+        componentPtr->Init();
+
+        components.push_back(componentPtr);
 
-        T* componentPtr = newComponent.get();
-        components.push_back(std::move(newComponent));
+        // 같은 타입이 여러 개면 GetComponent는 처음 추가된 것을 반환
+        ComponentTypes componentType = componentPtr->Component::GetType();
+        if (componentType != ComponentTypes::INVALID && componentSlots[static_cast<size_t>(componentType)] == nullptr)
+        {
+            componentSlots[static_cast<size_t>(componentType)] = componentPtr;
+        }
+        SetSignature(signature | ToSignatureBit(componentType));
         return componentPtr;
     }
 
     template <typename T>
     T* GetComponent()
     {
-        for (const auto& component : components)
+        if constexpr (StaticComponentType<T>)
         {
-            T* target = dynamic_cast<T*>(component.get());
-            if (target)
+            // 타입 ID로 슬롯 테이블을 바로 조회
+            return static_cast<T*>(componentSlots[static_cast<size_t>(T::StaticType)]);
+        }
+        else
+        {
+            for (Component* component : components)
             {
-                return target;
+                T* target = dynamic_cast<T*>(component);
+                if (target)
+                {
+                    return target;
+                }
             }
+            return nullptr;
         }
-        return nullptr;
     }
 
     template <typename T>
     bool HasComponent()
     {
-        for (const auto& component : components)
+        if constexpr (StaticComponentType<T>)
         {
-            if (dynamic_cast<T*>(component.get()))
+            // 시그니처 비트 검사
+            return (signature & ToSignatureBit(T::StaticType)) != 0;
+        }
+        else
+        {
+            for (Component* component : components)
             {
-                return true;
+                if (dynamic_cast<T*>(component))
+                {
+                    return true;
+                }
             }
+            return false;
         }
-        return false;
     }
 
+    ComponentSignature GetSignature() const { return signature; }
+
 public:
     Transform transform;
 
 private:
-    std::vector<std::unique_ptr<Component>> components;
+    void SetSignature(ComponentSignature newSignature);
+    void EndComponents();
+
+    // 컴포넌트 본체는 ComponentStorage의 풀이 소유하고, 오브젝트는 포인터만 보관
+    std::vector<Component*> components;
+    std::array<Component*, COMPONENT_TYPE_COUNT> componentSlots{}; // 타입 ID -> 컴포넌트
+    // storage 없이 생성되어 아직 풀에 들어가지 않은 컴포넌트와 해당 타입의 편입 함수
+    std::vector<std::pair<Component*, void (*)(ComponentStorage&, Component*)>> unpooledComponents;
     ObjectType type = ObjectType::NONE;
     std::string name = "";
+    uint64_t nameHash = HashString("");
+    std::vector<uint64_t> tags; // 태그 문자열의 해시
+    ObjectHandle handle;
+    ObjectManager* manager = nullptr;
+    uint32_t objectIndex = 0;       // ObjectManager::objects 내 위치 (swap-and-pop 제거용)
+    bool pendingDestroy = false;    // 삭제 예약 표시 (중복 예약 방지)
+    bool componentsEnded = false;
+
+    ComponentStorage* storage = nullptr;
+    ComponentSignature signature = 0;
+    unsigned int archetypeIndex = 0;
 };
@@ -0,0 +1,17 @@
+﻿#pragma once
+#include <cstdint>
+
+// ObjectManager의 슬롯 테이블을 가리키는 핸들
+// 슬롯이 재사용되면 generation이 증가하므로, 이미 삭제된 오브젝트의 핸들은 조회 시 nullptr로 판별됨
+struct ObjectHandle
+{
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+    uint32_t index = INVALID_INDEX;
+    uint32_t generation = 0;
+
+    bool IsNull() const { return index == INVALID_INDEX; }
+
+    bool operator==(const ObjectHandle& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const ObjectHandle& other) const { return !(*this == other); }
+};
@@ -1,9 +1,14 @@
 ﻿#pragma once
 #include "Object.hpp"
+#include "ComponentStorage.hpp"
+#include "CommandBuffer.hpp"
+#include "DynamicAABBTree.hpp"
 #include <vector>
 #include <memory>
 #include <map>
+#include <unordered_map>
 #include <string>
+#include <string_view>
 #include <functional>
 #include "glm.hpp"
 
@@ -24,10 +29,25 @@ public:
     void Init();
 
     template <typename T, typename... Args>
-    void AddObject(Args... args)
+    ObjectHandle AddObject(Args... args)
     {
-        objects.push_back(std::move(std::unique_ptr<T>(std::make_unique<T>(std::forward<Args>(args)...))));
+        std::unique_ptr<T> newObject = std::make_unique<T>(std::forward<Args>(args)...);
+        ObjectHandle handle = AllocateHandle(newObject.get());
+        newObject->manager = this;
+        AddToNameIndex(newObject.get());
+        for (uint64_t tagHash : newObject->tags)
+        {
+            AddToTagIndex(newObject.get(), tagHash);
+        }
+        componentStorage.Attach(newObject.get());
+        // 생성자에서 추가된 렌더러는 등록 전이라 알리지 못했으므로 여기서 경계 계산을 예약
+        QueueSpatialRefresh(handle.index);
+        newObject->objectIndex = static_cast<uint32_t>(objects.size());
+        objects.push_back(std::move(newObject));
+        transformOrderDirty = true;
         ++lastObjectID;
+        ++currentFrameStats.createdObjects;
+        return handle;
     }
 
     template<typename ComponentTypes, typename Func>
@@ -38,35 +58,103 @@ public:
             return;
         }
 
-        commandQueue.push_back([component, func]()
+        Object* owner = component->GetOwner();
+        uint64_t sortKey = owner ? owner->GetHandle().index : ObjectHandle::INVALID_INDEX;
+        commandQueue.Push(sortKey, [component, f = std::forward<Func>(func)]() mutable
         {
-            func(component);
+            f(component);
         });
     }
 
-    template<typename T, typename Func>
-    void QueueObjectFunction(T* object, Func&& func)
+    // 실행 시점에 핸들을 다시 조회하므로, 그 사이 삭제된 오브젝트에 대해서는 호출되지 않음
+    // 워커 스레드에서도 호출 가능 (스레드별 버퍼에 기록됨)
+    template<typename Func>
+    void QueueObjectFunction(ObjectHandle handle, Func&& func)
     {
-        if (object == nullptr)
+        if (handle.IsNull())
         {
             return;
         }
-        commandQueue.push_back([object, func]()
+        commandQueue.Push(handle.index, [this, handle, f = std::forward<Func>(func)]() mutable
         {
-            func(object);
+            if (Object* object = FindObject(handle))
+            {
+                f(object);
+            }
         });
     }
 
-    Object* FindObject(int id);
-    Object* FindObjectByName(const std::string& name);
+    // true면 ProcessQueues에서 명령을 오브젝트 순으로 정렬해서 실행
+    void SetSortCommandsByObject(bool sort) { sortCommandsByObject = sort; }
+
+    // 삭제되었거나 슬롯이 재사용된 핸들이면 nullptr 반환
+    Object* FindObject(ObjectHandle handle) const
+    {
+        if (handle.index >= slots.size())
+        {
+            return nullptr;
+        }
+        const ObjectSlot& slot = slots[handle.index];
+        return slot.generation == handle.generation ? slot.object : nullptr;
+    }
+    // 이름/태그 조회는 해시 인덱스를 사용 (문자열 할당 없음)
+    // 같은 이름이 여럿이면 그 이름으로 가장 먼저 등록된(생성 또는 SetName) 오브젝트 반환
+    Object* FindObjectByName(std::string_view name) const;
+    void FindObjectsByName(std::string_view name, std::vector<Object*>& outObjects) const;
+    void FindObjectsByPrefix(std::string_view prefix, std::vector<Object*>& outObjects) const;
+    const std::vector<Object*>& FindObjectsByTag(std::string_view tag) const;
 
     void DestroyObject(Object* object);
+    void DestroyObject(ObjectHandle handle) { DestroyObject(FindObject(handle)); }
     void Update(float dt);
+    // 깊이 순으로 정렬된 Transform 목록을 한 번 순회하며 바뀐 것만 월드 행렬 갱신
+    void UpdateTransforms();
     void DestroyAllObjects();
     void ProcessQueues();
     
     //void DrawBoneHierarchy(const AssimpNodeData* node, const std::map<std::string, glm::mat4>& animatedTransforms, Camera* camera);
     const std::vector<std::unique_ptr<Object>>& GetObjectList() const { return objects; }
+    ComponentStorage& GetComponentStorage() { return componentStorage; }
+
+    // 지정한 컴포넌트 조합을 모두 가진 오브젝트를 아키타입 단위로 순회
+    template <typename Func>
+    void ForEachObjectWith(ComponentSignature required, Func&& func)
+    {
+        componentStorage.ForEachArchetype(required, [&](const std::vector<Object*>& bucket)
+        {
+            for (Object* object : bucket)
+            {
+                func(object);
+            }
+        });
+    }
+    // 렌더러를 가진 오브젝트의 공간 인덱스 (Update에서 움직였거나 경계가 바뀐 것만 갱신)
+    // 월드 행렬이 바뀐 Transform, MarkBoundsDirty로 알린 렌더러, Animator가 있는 오브젝트만 다시 계산하므로 비용은 바뀐 수에 비례
+    // 경계를 알 수 없는 렌더러(ComputeWorldBounds 실패)는 트리 대신 별도 목록에 두고 절두체 질의에 항상 포함
+    void QueryFrustum(const Frustum& frustum, std::vector<Object*>& outObjects) const;
+    void QueryOverlap(const AABB& bounds, std::vector<Object*>& outObjects) const;
+    void QuerySphere(const glm::vec3& center, float radius, std::vector<Object*>& outObjects) const;
+    // 광선과 가장 먼저 만나는 렌더러 경계의 오브젝트 (없으면 nullptr)
+    Object* RayCast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, float* hitDistance = nullptr) const;
+    // 창 좌표(픽셀)를 카메라 광선으로 바꿔 RayCast
+    Object* PickObject(const Camera* camera, const glm::vec2& screenPosition) const;
+    const DynamicAABBTree& GetSpatialTree() const { return spatialTree; }
+    // 메시/모델/셰이더가 바뀌어 다음 Update에서 경계를 다시 계산해야 함 (MeshRenderer에서 호출, 등록되지 않은 오브젝트는 무시)
+    void MarkBoundsDirty(const Object* object);
+
+    // 프레임 단위 오브젝트 생성/삭제 통계 (ProcessQueues에서 갱신)
+    struct FrameStats
+    {
+        int createdObjects = 0;
+        int destroyedObjects = 0;
+        float compactionMs = 0.0f;
+        int updatedTransforms = 0;
+        int refreshedBounds = 0;    // 공간 인덱스에서 경계를 다시 계산한 오브젝트
+        int reinsertedProxies = 0;  // 여유 상자를 벗어나 트리에 다시 삽입된 오브젝트
+        float spatialUpdateMs = 0.0f;
+    };
+    const FrameStats& GetFrameStats() const { return lastFrameStats; }
+
     void ObjectControllerForImgui();
     
     // Gizmo
@@ -75,12 +163,84 @@ public:
 
 private:
     friend class Engine;
+    friend class Object;
+
+    struct ObjectSlot
+    {
+        Object* object = nullptr;
+        uint32_t generation = 0;
+    };
+
+    ObjectHandle AllocateHandle(Object* object);
+    void ReleaseHandle(Object* object);
+    void UnregisterObject(Object* object);
+
+    // 같은 이름을 가진 오브젝트 묶음 (이름 문자열은 여기에 한 번만 보관, objects는 등록 순서)
+    // 충돌 체인 중간의 항목은 비어도 체인이 끊기지 않게 남겨 둠 (nameTombstones, 많아지면 인덱스를 다시 만듦)
+    struct NameEntry
+    {
+        std::string name;
+        std::vector<Object*> objects;
+    };
+
+    // 해시 충돌 시 다음 키로 이동하며 이름이 일치하는 항목을 찾음
+    const NameEntry* FindNameEntry(std::string_view name, uint64_t hash) const;
+    void AddToNameIndex(Object* object);
+    void RemoveFromNameIndex(Object* object);
+    // 빈 항목을 빼고 이름 인덱스를 다시 만들어 충돌 체인을 압축
+    void RebuildNameIndex();
+    void AddToTagIndex(Object* object, uint64_t tagHash);
+    void RemoveFromTagIndex(Object* object, uint64_t tagHash);
 
     int lastObjectID = 0;
+    std::vector<ObjectSlot> slots;      // 핸들 index -> 오브젝트
+    std::vector<uint32_t> freeSlots;    // 재사용 가능한 슬롯 index
+
+    std::unordered_map<uint64_t, NameEntry> nameIndex;            // 이름 해시 -> 오브젝트 묶음
+    std::map<std::string, uint64_t, std::less<>> sortedNames;     // 이름 -> nameIndex 키 (접두사 검색용)
+    size_t nameTombstones = 0;                                     // 체인 중간에 남은 빈 항목 수
+    std::unordered_map<uint64_t, std::vector<Object*>> tagIndex;  // 태그 해시 -> 오브젝트 목록
+    // 컴포넌트 풀은 오브젝트보다 먼저 선언하여 오브젝트 소멸 이후에 해제되도록 함
+    ComponentStorage componentStorage;
     std::vector<std::unique_ptr<Object>> objects;
-    std::vector<std::function<void()>> commandQueue;
+    CommandQueue commandQueue;
+    bool sortCommandsByObject = false;
     std::vector<Object*> removalQueue;
+    void RebuildTransformOrder();
+
+    // 핸들 index마다 공간 인덱스 상태 (slots와 같은 크기)
+    struct SpatialEntry
+    {
+        int proxy = DynamicAABBTree::NULL_NODE;
+        int unboundedIndex = -1;       // unboundedSlots 내 위치
+        bool queued = false;           // spatialDirtySlots에 들어 있음
+        AABB bounds;                   // 실제 월드 경계 (트리에는 여유를 둔 상자가 들어감)
+    };
+    void UpdateSpatialIndex();
+    void RemoveFromSpatialIndex(uint32_t slotIndex);
+    void QueueSpatialRefresh(uint32_t slotIndex);
+
+    DynamicAABBTree spatialTree;
+    std::vector<SpatialEntry> spatialEntries;
+    std::vector<uint32_t> unboundedSlots;
+    std::vector<uint32_t> spatialDirtySlots; // 이번 Update에서 경계를 다시 계산할 슬롯
+    int spatialBenchmarkCount = 100000;
+    SpatialTreeBenchmarkResult lastSpatialBenchmark;
+    bool pickWithMouse = true;
+
+    std::vector<Transform*> sortedTransforms; // 부모가 항상 자식보다 앞에 오도록 깊이 순 정렬
+    std::vector<uint32_t> sortedTransformSlots; // sortedTransforms와 같은 순서의 오브젝트 핸들 index
+    Transform::BatchScratch transformScratch;
+    int transformBenchmarkCount = 100000;
+    TransformBenchmarkResult lastTransformBenchmark;
+    bool transformOrderDirty = true;
+    unsigned int transformHierarchyVersion = 0;
+
+    FrameStats currentFrameStats;
+    FrameStats lastFrameStats;
 
+    // 목록 클릭/마우스 선택 공통 처리
+    void SelectObject(Object* object);
     Object* selectedObject = nullptr;
     std::shared_ptr<Shader> prevShader = nullptr;
 
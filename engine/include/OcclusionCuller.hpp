@@ -0,0 +1,105 @@
+﻿#pragma once
+#include "Bounds.hpp"
+#include <glm.hpp>
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+// [0, count)를 나눠 func(begin, end)로 실행하는 병렬 실행기 (ClusterParallelFor와 같은 형태, 비어 있으면 순차 실행)
+using OcclusionParallelFor = std::function<void(int count, const std::function<void(int, int)>& func)>;
+
+struct OcclusionStats
+{
+    int occluders = 0;
+    int occluderTriangles = 0;   // 제출된 삼각형
+    int rasterizedTriangles = 0; // 근평면 클리핑/화면 밖 제거 후 설정된 삼각형
+    int binnedTriangles = 0;     // 타일에 배정된 횟수 (여러 타일에 걸치면 중복)
+    float rasterMs = 0.0f;       // 변환 + 타일 배정 + 래스터화 + 계층 깊이 생성
+};
+
+// 지정된 가리개(occluder) 삼각형을 저해상도 깊이 버퍼에 CPU로 래스터화하고, 물체의 AABB가 그 뒤에 완전히 가려지는지 판정
+// 깊이는 NDC z를 [0, 1]로 옮긴 값 (1 = 먼 면), 버퍼 y = 0은 화면 아래쪽
+// - 삼각형은 화면 타일에 배정한 뒤 타일마다 따로(병렬로) 래스터화하며, 한 줄에 4픽셀씩 SIMD로 에지 함수와 깊이를 계산
+// - 픽셀에 쓰는 깊이는 픽셀 안에서 삼각형 평면이 가질 수 있는 최댓값 (가리개를 실제보다 가깝게 기록하지 않음)
+// - 덮임 판정은 픽셀 중심 기준이라 윤곽이 실제보다 넓게 기록될 수 있으므로, 판정할 때 상자의 화면 사각형을 한 픽셀씩 넓혀 봄
+// - 판정은 최대 깊이 피라미드(HiZ)에서 상자 크기에 맞는 단계를 먼저 보고, 가려지지 않으면 원래 해상도로 다시 확인
+// GL 없이 동작하므로 따로 검사/측정할 수 있음
+class OcclusionCuller
+{
+public:
+    static constexpr int TILE_WIDTH = 32;  // 4의 배수 (SIMD 한 번에 4픽셀)
+    static constexpr int TILE_HEIGHT = 16;
+
+    OcclusionCuller() { SetResolution(256, 128); }
+
+    // 너비/높이는 타일 크기의 배수로 올림
+    void SetResolution(int width_, int height_);
+    void SetUseSimd(bool use) { useSimd = use; }
+    bool GetUseSimd() const { return useSimd; }
+
+    // 프레임(카메라)마다 호출: 깊이 버퍼를 비우고 제출된 가리개를 버림
+    void BeginFrame(const glm::mat4& viewProjection_);
+    // positions: 정점 위치(vec3)가 stride 바이트 간격으로 놓인 배열, indices: 삼각형 목록
+    void AddOccluder(const glm::mat4& modelMatrix, const float* positions, size_t stride, size_t vertexCount,
+        const unsigned int* indices, size_t indexCount);
+    bool HasOccluders() const { return !triangles.empty(); }
+    // 제출된 가리개를 깊이 버퍼에 그리고 계층 깊이를 만듦
+    void Rasterize(const OcclusionParallelFor& parallelFor = {});
+
+    // false면 마지막 Rasterize 기준으로 완전히 가려짐 (근평면에 걸치거나 화면 밖이면 항상 true)
+    bool TestAABB(const AABB& bounds) const;
+
+    int GetWidth() const { return width; }
+    int GetHeight() const { return height; }
+    const std::vector<float>& GetDepthBuffer() const { return depthLevels[0]; }
+    const OcclusionStats& GetStats() const { return stats; }
+
+private:
+    // 화면 좌표(픽셀 단위)로 설정된 삼각형: 에지 함수 e = a * x + b * y + c >= 0이면 안쪽, 깊이 평면 z = za * x + zb * y + zc
+    struct SetupTriangle
+    {
+        float edgeA[3], edgeB[3], edgeC[3];
+        float depthA, depthB, depthC;
+        float depthBias; // 픽셀 중심에서 픽셀 안 최댓값까지의 차이 (0.5 * (|za| + |zb|))
+        float maxDepth;  // 세 꼭짓점의 최대 깊이 (평면을 삼각형 밖으로 연장한 값이 이보다 커지지 않게)
+        int minX, minY, maxX, maxY;
+    };
+
+    void SetupClippedTriangle(const glm::vec4& a, const glm::vec4& b, const glm::vec4& c);
+    void RasterizeTile(int tileIndex);
+    void RasterizeRowsScalar(const SetupTriangle& triangle, int x0, int x1, int y0, int y1);
+    void RasterizeRowsSimd(const SetupTriangle& triangle, int x0, int x1, int y0, int y1);
+    void BuildHierarchy();
+
+    int width = 0;
+    int height = 0;
+    int tilesX = 0;
+    int tilesY = 0;
+    bool useSimd = true;
+    glm::mat4 viewProjection = glm::mat4(1.0f);
+
+    std::vector<glm::vec4> clipVertices; // AddOccluder 임시 버퍼
+    std::vector<SetupTriangle> triangles;
+    std::vector<std::vector<uint32_t>> tileBins;
+    // [0] = 원래 해상도, [k] = [k - 1]의 2x2 최댓값
+    std::vector<std::vector<float>> depthLevels;
+    std::vector<glm::ivec2> levelSizes;
+    OcclusionStats stats;
+};
+
+// 바닥 + 벽 가리개와 무작위 상자 occludeeCount개로 래스터화/판정 시간을 측정
+// 스칼라 / SIMD / SIMD + 병렬 래스터화 결과가 같은지, 벽 바로 뒤/앞의 상자가 올바르게 판정되는지 확인
+struct OcclusionBenchmarkResult
+{
+    int occludeeCount = 0;
+    int occluderTriangles = 0;
+    float scalarRasterMs = 0.0f;
+    float simdRasterMs = 0.0f;
+    float parallelRasterMs = 0.0f;
+    float testMs = 0.0f;
+    int occludedCount = 0;
+    bool matchesReference = false;  // 세 래스터화 결과의 깊이 버퍼가 비트 단위로 같음
+    bool knownCasesPassed = false;  // 벽 뒤 상자는 가려짐, 벽 앞 상자는 보임
+};
+
+OcclusionBenchmarkResult RunOcclusionBenchmark(int occludeeCount, const OcclusionParallelFor& parallelFor);
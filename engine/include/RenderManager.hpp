@@ -3,7 +3,16 @@
 #include <string>
 #include <memory>
 #include <unordered_map>
+#include <map>
+#include <cstdint>
 #include "glm.hpp"
+#include "RenderQueue.hpp"
+#include "LightCluster.hpp"
+#include "Shader.hpp"
+#include "Bounds.hpp"
+#include "OcclusionCuller.hpp"
+#include "MeshRenderer.hpp"
+#include "StreamRingBuffer.hpp"
 
 enum class TextureSlot
 {
@@ -23,11 +32,35 @@ enum class TextureSlot
     IBL_BRDF_LUT = 12
 };
 
+// 라이트 버퍼(SSBO)에 들어가는 조명 하나 (셰이더의 LightData와 같은 std430 배치)
+struct GPULight
+{
+    glm::vec4 positionType; // xyz = 점광원 위치 또는 방향광 방향, w = 1 점광원 / 0 방향광
+    glm::vec4 color;        // rgb = 색상
+    glm::vec4 intensity;    // x = ambient, y = diffuse, z = specular, w = shininess
+    glm::vec4 params;       // x = 점광원 영향 반경 (0이면 무한)
+};
+
+// 유니폼 버퍼(std140)에 들어가는 값 (셰이더의 FrameData / CameraData 블록과 같은 배치)
+struct FrameUniforms
+{
+    glm::vec4 time;   // x = 경과 시간(초), y = 프레임 시간(초)
+    glm::vec4 params; // x = exposure
+};
+
+struct CameraUniforms
+{
+    glm::mat4 view;
+    glm::mat4 projection;
+    glm::vec4 position; // xyz = 카메라 월드 위치
+};
+
 class Engine;
 class Shader;  
 class Texture;
-class MeshRenderer;
 class Light;
+class Camera;
+class Object;
 
 class RenderManager
 {
@@ -59,14 +92,157 @@ public:
     void ResetShaders();
     void ResetTextures();
     void ResetAllResources();
+
+    // HDR 셰이더(PBR)의 노출 값 (프레임 유니폼 버퍼로 전달)
+    void SetExposure(float exposure_) { exposure = exposure_; }
+    float GetExposure() const { return exposure; }
+
+    const RenderQueueStats& GetRenderQueueStats() const { return lastRenderStats; }
+    // 렌더러 메시가 정점 형식(정적 / 스키닝)과 인덱스 형식(16 / 32비트)별로 함께 쓰는 정점/인덱스 버퍼 (처음 요청할 때 생성)
+    const std::shared_ptr<GeometryPool>& GetGeometryPool(const VertexFormat& format, GLenum indexType);
+    // (형태, 분할 수)마다 하나만 만들어 여러 렌더러가 함께 쓰는 절차적 메시 (처음 요청할 때 생성해 풀에 올림)
+    // 캐시는 약한 참조만 가지므로 마지막 렌더러가 놓으면 메시와 풀 구간이 해제됨, 공유되므로 수정하지 않음
+    std::shared_ptr<const Mesh> GetProceduralMesh(ProceduralShape shape, int param0 = 0, int param1 = 0);
+    // 프레임마다 새로 채우는 GPU 데이터용 영구 매핑 링 버퍼 (처음 요청할 때 생성)
+    StreamRingBuffer* GetStreamBuffer();
+    // 뼈 행렬을 링 버퍼에 기록하고 BonePalette 블록 바인딩에 연결 (blockSize = 셰이더의 블록 크기, 넘치는 행렬은 버림)
+    void BindBonePalette(const glm::mat4* matrices, size_t count, size_t blockSize);
+    void RenderQueueControllerForImGui();
+    // 카메라가 삭제될 때 렌더러들이 그 카메라 기준으로 가진 상태(LOD 히스테리시스)를 제거 (CameraManager에서 호출)
+    void RemoveCameraState(const Camera* camera);
 private:
     friend class Engine;
+
+    // 렌더러마다 월드 경계를 계산해 rendererBounds에 기록 (프레임마다 한 번, 모든 카메라가 공유)
+    void UpdateRendererBounds();
+    // 카메라 하나에 대해 절두체 안의 렌더러만 드로우 아이템으로 모아 정렬한 뒤 제출 단위(DrawBatch)로 묶음
+    void BuildRenderQueue(Camera* camera);
+    // 절두체를 통과한 가리개를 CPU 깊이 버퍼에 그리고, 절두체를 통과한 렌더러 중 완전히 가려진 것을 rendererVisible = 2로 표시
+    void ApplyOcclusionCulling(Camera* camera);
+    // 정렬 순서상 인접하고 지오메트리/셰이더/텍스처/렌더 모드가 같은 아이템을 인스턴싱 배치로 묶고 인스턴스 버퍼 업로드
+    void BuildDrawBatches();
+    // 같은 셰이더/텍스처/렌더 모드/VAO를 쓰는 연속된 인스턴싱 배치(풀 메시)를 간접 드로우 배치 하나로 합치고 명령을 만듦
+    void MergeIndirectBatches();
+    // 조명 적용 방식
+    enum class LightingPass
+    {
+        PerLight,     // 조명 하나만 적용 (기존 방식, 조명마다 가산 블렌딩으로 다시 그림)
+        MultiLight,   // MULTI_LIGHT 변형은 라이트 버퍼의 모든 조명을 한 번에, 지원하지 않는 셰이더는 첫 번째 조명만
+        FallbackOnly, // MULTI_LIGHT를 지원하지 않는 배치만 그림 (두 번째 이후 조명의 가산 패스)
+    };
+
+    // 정렬된 배치를 순서대로 그리며, 직전과 같은 셰이더/텍스처/VAO는 다시 바인딩하지 않음
+    void SubmitRenderQueue(Camera* camera, Light* light, LightingPass lightingPass);
+    // 활성 조명을 라이트 버퍼에 기록 (프레임마다 한 번, 반경이 있는 점광원을 배열 앞쪽에 둠)
+    void UploadLightBuffer();
+    // 유니폼 버퍼 갱신: 프레임마다 한 번 / 카메라마다 한 번 / 조명 패스마다 한 번
+    void UploadFrameUniforms();
+    void UploadCameraUniforms(Camera* camera);
+    void UploadPassLightUniforms(Light* light);
+    // 카메라 절두체의 클러스터마다 점광원을 배정하여 클러스터 버퍼에 기록 (카메라마다 한 번)
+    void UploadClusterBuffers(Camera* camera, const glm::vec4& viewportPixels);
+
+    // 셰이더 변형 플래그 (셰이더 소스의 #ifdef 분기와 대응)
+    static constexpr uint32_t VARIANT_INSTANCED = 1 << 0;   // INSTANCED
+    static constexpr uint32_t VARIANT_MULTI_LIGHT = 1 << 1; // MULTI_LIGHT
+    static constexpr uint32_t VARIANT_CLUSTERED = 1 << 2;   // CLUSTERED (MULTI_LIGHT와 함께 사용)
+    // 유니폼 버퍼 바인딩 번호 (GL_UNIFORM_BUFFER는 SSBO와 별개의 번호 공간이라 아래 SSBO 번호와 겹쳐도 무방)
+    static constexpr unsigned int FRAME_UNIFORM_BINDING = 0;
+    static constexpr unsigned int CAMERA_UNIFORM_BINDING = 1;
+    static constexpr unsigned int PASS_LIGHT_UNIFORM_BINDING = 2;
+    static constexpr unsigned int BONE_PALETTE_UNIFORM_BINDING = 3;
+    // 스키닝하지 않는 드로우에도 BonePalette 블록이 연결되어 있도록 프레임마다 한 번 바인딩하는 기본 크기 (mat4 256개)
+    static constexpr size_t DEFAULT_BONE_PALETTE_BYTES = 256 * sizeof(glm::mat4);
+    // SSBO 바인딩 번호
+    static constexpr unsigned int LIGHT_BUFFER_BINDING = 0;
+    static constexpr unsigned int CLUSTER_BUFFER_BINDING = 1;
+    static constexpr unsigned int CLUSTER_INDEX_BUFFER_BINDING = 2;
+    static constexpr int GPU_TIMER_QUERY_COUNT = 3;
+
+    // 정의를 넣어 컴파일한 변형 셰이더 (소스가 해당 분기를 지원하지 않거나 컴파일에 실패하면 nullptr)
+    Shader* GetShaderVariant(Shader* shader, uint32_t variantFlags);
+    // 셰이더가 바뀔 때 한 번만 설정하면 되는 유니폼 (IBL 슬롯, 유니폼 블록을 쓰지 않는 셰이더의 카메라 값)
+    void ApplyPassUniforms(Shader* shader, Camera* camera);
+
+    RenderQueue renderQueue;
+    std::vector<DrawBatch> drawBatches;
+    std::vector<InstanceData> instanceData;
+    StreamAllocation instanceAllocation; // 카메라마다 링 버퍼에 기록한 instanceData
+    bool enableInstancing = true;
+    // 풀에 올린 메시는 VAO가 같으므로 여러 지오메트리를 glMultiDrawElementsIndirect 한 번으로 그림
+    // 드로우별 값은 명령의 baseInstance부터 읽는 인스턴스 속성으로 전달 (gl_DrawID는 GL 4.6 / ARB_shader_draw_parameters 필요)
+    bool useMultiDrawIndirect = true;
+    std::shared_ptr<GeometryPool> geometryPools[2][2]; // [스키닝 여부][16비트 인덱스 여부]
+    std::vector<DrawElementsIndirectCommand> drawCommands;
+    std::vector<DrawBatch> mergedBatches;
+    StreamAllocation commandAllocation; // 카메라마다 링 버퍼에 기록한 drawCommands
+    std::map<std::pair<Shader*, uint32_t>, std::shared_ptr<Shader>> shaderVariants;
+    bool hasFallbackBatches = false; // MULTI_LIGHT 변형이 없는 배치가 있는지 (있으면 조명마다 가산 패스 필요)
+
+    // 유니폼 블록, 라이트/클러스터 SSBO, 인스턴스, 간접 명령, 뼈 행렬을 모두 이 버퍼의 구간으로 기록하고 바인딩
+    std::unique_ptr<StreamRingBuffer> streamBuffer;
+    float exposure = 0.5f;
+    float elapsedSeconds = 0.0f;
+    uint64_t lastFrameTicks = 0;
+
+    std::vector<GPULight> gpuLights;
+    bool lightBufferBound = false;
+    bool enableMultiLight = true;
+
+    // 클러스터 단위 조명 배정 (반경이 있는 점광원이 있을 때만 사용)
+    LightClusterGrid lightClusters;
+    std::vector<glm::vec4> clusterLightSpheres; // gpuLights 앞쪽의 점광원과 같은 순서 (xyz = 위치, w = 반경)
+    bool enableClustering = true;
+    bool useClustering = false; // 이번 프레임에 CLUSTERED 변형을 사용하는지
+    bool useClusterThreads = true;
+    int lightClusterBenchmarkCount = 1000;
+    LightClusterBenchmarkResult lastLightClusterBenchmark;
+    int uniformBenchmarkIterations = 100000;
+    UniformBenchmarkResult lastUniformBenchmark;
+
+    // GPU 시간 측정 (몇 프레임 전 결과를 읽어 대기하지 않음)
+    unsigned int gpuTimerQueries[GPU_TIMER_QUERY_COUNT] = {};
+    bool gpuTimerIssued[GPU_TIMER_QUERY_COUNT] = {};
+    int gpuTimerIndex = 0;
+    float gpuRenderMs = 0.0f;
+    float cpuRenderMs = 0.0f;
+    RenderQueueStats currentRenderStats;
+    RenderQueueStats lastRenderStats;
+    bool sortRenderQueue = true;
+
+    // 절두체 컬링 (renderers와 같은 인덱스)
+    BoundsArray rendererBounds;
+    std::vector<uint8_t> rendererVisible;
+    bool enableFrustumCulling = true;
+    bool useSimdCulling = true;
+    bool useSpatialTreeCulling = false; // ObjectManager의 AABB 트리로 판정 (보이는 비율이 낮은 큰 씬에 유리)
+    std::vector<Object*> spatialQueryResults;
+    float cullingMs = 0.0f;      // 이번 프레임의 경계 계산 + 판정 시간 (모든 카메라 합)
+    float lastCullingMs = 0.0f;
+
+    // CPU 가림 컬링 (가리개로 지정된 렌더러만 깊이 버퍼에 그림)
+    OcclusionCuller occlusionCuller;
+    bool enableOcclusionCulling = true;
+    bool useOcclusionThreads = true;
+    float occlusionMs = 0.0f;     // 이번 프레임의 래스터화 + 판정 시간 (모든 카메라 합)
+    float lastOcclusionMs = 0.0f;
+    bool showOcclusionBuffer = false;
+    unsigned int occlusionDebugTexture = 0; // 깊이 버퍼 확인용 (R32F)
+    int occlusionBenchmarkCount = 10000;
+    OcclusionBenchmarkResult lastOcclusionBenchmark;
+
+    // 메시 LOD 선택 (임포트한 모델 메시는 로드 시 LOD를 만들어 둠)
+    LodSelectionSettings lodSettings;
+
     std::vector<MeshRenderer*> renderers;
     std::vector<MeshRenderer*> pendingAddition;
-    std::vector<MeshRenderer*> pendingRemoval;
+    std::vector<int> pendingRemoval; // 해제된 렌더러의 인덱스 (해당 칸은 nullptr로 표시됨)
     std::vector<Light*> lights;
     glm::vec4 backGroundColor = { 0.1f, 0.1f, 0.15f, 1.0f };
 
     std::unordered_map<std::string, std::shared_ptr<Shader>> shaders;
     std::unordered_map<std::string, std::shared_ptr<Texture>> textures;
+    std::unordered_map<uint64_t, std::weak_ptr<const Mesh>> proceduralMeshes; // Mesh::MakeProceduralKey 기준
+    int proceduralMeshRequests = 0;
+    int proceduralMeshBuilds = 0;
 };
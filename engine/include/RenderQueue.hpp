@@ -0,0 +1,121 @@
+﻿#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <unordered_map>
+#include <glm.hpp>
+
+class MeshRenderer;
+class Mesh;
+class Shader;
+class Texture;
+
+// 드로우 패스 (정렬 키 최상위 2비트)
+enum class RenderPass : uint8_t
+{
+    Main = 0,
+};
+
+// 한 번의 드로우 콜에 필요한 정보
+struct DrawItem
+{
+    uint64_t key = 0;
+    MeshRenderer* renderer = nullptr;
+    const Mesh* mesh = nullptr;
+    Shader* shader = nullptr;
+    Texture* texture = nullptr;
+    int lod = 0; // 그릴 Mesh LOD 단계 (인덱스 버퍼 구간)
+};
+
+// 인스턴싱 드로우에서 오브젝트마다 인스턴스 버퍼에 기록하는 값
+// 셰이더의 INSTANCED 분기 속성 배치와 같아야 함 (location 6~9: model, 10: color, 11: metallic/roughness)
+struct InstanceData
+{
+    glm::mat4 model;
+    glm::vec4 color;
+    glm::vec4 material; // x = metallic, y = roughness
+};
+
+// glMultiDrawElementsIndirect가 읽는 명령 하나 (GL 규격의 배치와 같아야 함)
+struct DrawElementsIndirectCommand
+{
+    uint32_t count = 0;
+    uint32_t instanceCount = 0;
+    uint32_t firstIndex = 0;
+    int32_t baseVertex = 0;
+    uint32_t baseInstance = 0; // 인스턴스 속성(InstanceData)을 읽기 시작할 위치
+};
+
+// 제출 단위: 인스턴싱이면 items[firstItem, firstItem + itemCount)를 한 번에 그림
+// 간접 드로우면 그 구간의 여러 지오메트리를 명령 commandCount개로 한 번에 그림
+struct DrawBatch
+{
+    size_t firstItem = 0;
+    int itemCount = 1;
+    Shader* shader = nullptr;   // 인스턴싱이면 INSTANCED 변형 셰이더
+    Shader* multiLightShader = nullptr; // 모든 조명을 한 패스에서 계산하는 MULTI_LIGHT 변형 (없으면 nullptr)
+    bool instanced = false;
+    size_t instanceOffset = 0;  // 인스턴스 버퍼 내 바이트 오프셋
+    bool indirect = false;
+    size_t firstCommand = 0;    // 간접 드로우 명령 배열에서의 위치
+    int commandCount = 0;
+};
+
+// 제출 단계 통계 (생략된 바인딩 = 직전과 같은 상태라 다시 바인딩하지 않은 횟수)
+struct RenderQueueStats
+{
+    int drawCalls = 0;
+    int instancedDrawCalls = 0;
+    int instancedObjects = 0;
+    int shaderBinds = 0;
+    int textureBinds = 0;
+    int vertexArrayBinds = 0;
+    int skippedBinds = 0;
+    int visibleObjects = 0; // 절두체/가림 컬링을 통과한 렌더러 (카메라마다 누적)
+    int culledObjects = 0;
+    int occludedObjects = 0; // 절두체 안이지만 가리개 뒤에 가려져 그리지 않은 렌더러
+    int multiDrawCalls = 0;     // glMultiDrawElementsIndirect 호출 (drawCalls에 포함)
+    int indirectCommands = 0;   // 간접 드로우로 그린 명령 (지오메트리 단위)
+    int submittedTriangles = 0; // 선택된 LOD 기준으로 제출한 삼각형 (인스턴스 포함)
+    int lodDraws[4] = {};       // LOD 단계별 그린 메시 수 (Mesh::MAX_LOD_LEVELS)
+};
+
+// 매 프레임 드로우 아이템을 모아 64비트 키로 기수 정렬하는 큐
+// 키 구성 (상위 비트부터 비교)
+//   불투명: [패스 2][반투명 0][셰이더 11][텍스처 10][메시 16][깊이 24] -> 상태별로 묶은 뒤 가까운 것부터 (early-Z)
+//          같은 지오메트리는 메시 번호가 같으므로 서로 인접하게 되어 인스턴싱으로 묶을 수 있음
+//          메시 번호는 (메시, LOD 단계)마다 부여하므로 다른 단계끼리는 묶이지 않음
+//   반투명: [패스 2][반투명 1][역깊이 24][셰이더 11][텍스처 10][메시 16] -> 먼 것부터 (블렌딩 순서)
+class RenderQueue
+{
+public:
+    void Clear();
+    void Add(RenderPass pass, bool transparent, float viewDepth, MeshRenderer* renderer, const Mesh* mesh, Shader* shader, Texture* texture, int lod = 0);
+    void Sort();
+
+    const std::vector<DrawItem>& GetItems() const { return items; }
+    size_t GetCount() const { return items.size(); }
+
+    // 같은 지오메트리를 그리는지 (절차적 메시는 지오메트리 키로, 그 외에는 같은 메시인지로 판단)
+    static bool IsSameGeometry(const Mesh* a, const Mesh* b);
+
+private:
+    struct SortEntry
+    {
+        uint64_t key;
+        uint32_t index;
+    };
+
+    // 프레임 내에서 리소스마다 작은 번호를 부여 (포인터를 그대로 키에 넣기엔 비트가 부족함)
+    static uint32_t GetResourceId(std::unordered_map<uint64_t, uint32_t>& table, uint64_t resource, uint32_t maxId);
+    static uint32_t QuantizeDepth(float viewDepth);
+
+    std::vector<DrawItem> items;
+    std::vector<DrawItem> sortedItems;
+    std::vector<SortEntry> entries;
+    std::vector<SortEntry> entriesScratch;
+
+    std::unordered_map<uint64_t, uint32_t> shaderIds;
+    std::unordered_map<uint64_t, uint32_t> textureIds;
+    std::unordered_map<uint64_t, uint32_t> meshIds;   // 절차적 메시는 지오메트리 키, 그 외에는 포인터 (+ LOD 단계)
+};
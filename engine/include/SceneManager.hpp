@@ -32,6 +32,7 @@ private:
     void ImGuiBeginFrame();
     void ImGuiEndFrame();
     void RenderMainMenuBar();
+    void RenderDebugWindows();
 
     //  ±  
     std::vector<Scene*> sceneList;
@@ -39,4 +40,8 @@ private:
     Scene* currentScene = nullptr;
     SceneTag nextSceneTag = SceneTag::NONE;
     SceneState currentState = SceneState::START;
+
+    // Debug ޴  â
+    bool showJobSystemWindow = false;
+    bool showRenderQueueWindow = false;
 };
\ No newline at end of file
@@ -7,5 +7,6 @@ enum class SceneTag
 	PBR,
 	GAME, 
 	MOCAP,
+	LIGHT_STRESS,
 	NONE
 };
@@ -0,0 +1,15 @@
+﻿#pragma once
+#include <cstdint>
+#include <string_view>
+
+// FNV-1a 64비트 해시 (constexpr이므로 문자열 리터럴은 컴파일 타임에 계산 가능)
+constexpr uint64_t HashString(std::string_view string)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : string)
+    {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
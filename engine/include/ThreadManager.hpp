@@ -2,19 +2,86 @@
 #include <SDL3/SDL.h>
 #include <memory>
 #include <atomic>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <algorithm>
+#include "JobSystem.hpp"
 
 class ThreadManager {
 public:
     ThreadManager() = default;
-    ~ThreadManager() = default;
+    ~ThreadManager();
 
-    // ʱȭ   (ʿ   ۿ,   )
+    // Ŀ  /
     void Start();
     void Stop();
 
     //   ȣǾ ̺Ʈ ó Լ
     void ProcessEvents();
 
+    //  : counter Ϸ  , dependency  ش īͰ 0  ڿ 
+    void Schedule(std::function<void()> func, JobCounter* counter = nullptr, JobCounter* dependency = nullptr);
+
+    // counter 0   ϸ鼭     
+    // (ÿ  īʹ ݵ Wait Ŀ Ҹų )
+    void Wait(JobCounter& counter);
+
+    // [0, count)  ġ   , func(begin, end) · ȣǸ   ȯ
+    template <typename Func>
+    void ParallelFor(int count, int minBatchSize, Func&& func)
+    {
+        if (count <= 0)
+        {
+            return;
+        }
+
+        int workerCount = GetWorkerCount();
+        int batchSize = std::max(minBatchSize, count / std::max(1, (workerCount + 1) * 4));
+        batchSize = std::max(batchSize, 1);
+        if (workerCount == 0 || count <= batchSize)
+        {
+            func(0, count);
+            return;
+        }
+
+        JobCounter counter;
+        for (int begin = 0; begin < count; begin += batchSize)
+        {
+            int end = std::min(begin + batchSize, count);
+            Schedule([&func, begin, end]() { func(begin, end); }, &counter);
+        }
+        Wait(counter);
+    }
+
+    int GetWorkerCount() const { return static_cast<int>(workers.size()); }
+    bool IsWorkerThread() const;
+    JobSystemStats GetStats() const;
+
+    //     ý / ParallelFor / std::async Ͽ ٸ  
+    JobBenchmarkResult RunJobBenchmark(int jobCount);
+    void JobSystemControllerForImGui();
+
 private:
+    void WorkerLoop(int queueIndex);
+    bool TryRunJob(int queueIndex);
+    void Enqueue(Job&& job);
+    void FinishJob(JobCounter* counter);
+
     std::atomic<bool> running{ false };
+
+    // 0 ť ( Ŀ ƴ) , 1 Ŀ
+    std::vector<std::unique_ptr<JobQueue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<int> queuedJobs{ 0 };
+    std::mutex sleepMutex;
+    std::condition_variable wakeCondition;
+
+    std::atomic<unsigned long long> executedJobs{ 0 };
+    std::atomic<unsigned long long> stolenJobs{ 0 };
+
+    int benchmarkJobCount = 1000;
+    JobBenchmarkResult lastBenchmark;
 };
\ No newline at end of file
@@ -3,44 +3,134 @@
 #include <glm.hpp>
 #include <gtc/matrix_transform.hpp>
 #include <gtc/quaternion.hpp>
+#include <vector>
+#include <atomic>
+#include <cassert>
+#include "UpdatePhase.hpp"
+#include "TransformBatch.hpp"
 
 class Transform
 {
 public:
+    Transform() = default;
+    ~Transform();
+    Transform(const Transform&) = delete;
+    Transform& operator=(const Transform&) = delete;
+
     const glm::vec3& GetPosition() const { return position; }
     const glm::vec3& GetRotation() const { return rotation; }
     const glm::vec3& GetScale() const { return scale; }
 
-    void SetPosition(const glm::vec3& position_) { position = position_; }
-    void SetRotation(const glm::vec3& rotation_) { rotation = rotation_; }
-    void SetScale(const glm::vec3& scale_) { scale = scale_; }
+    void SetPosition(const glm::vec3& position_) { MarkDirty(); position = position_; }
+    void SetRotation(const glm::vec3& rotation_) { MarkDirty(); rotation = rotation_; }
+    void SetScale(const glm::vec3& scale_) { MarkDirty(); scale = scale_; }
+
+    void SetPosition(float x, float y, float z) { MarkDirty(); position.x = x; position.y = y; position.z = z; }
+    void SetPositionX(float x) { MarkDirty(); position.x = x; }
+    void SetPositionY(float y) { MarkDirty(); position.y = y; }
+    void SetPositionZ(float z) { MarkDirty(); position.z = z; }
 
-    void SetPosition(float x, float y, float z) { position.x = x; position.y = y; position.z = z; }
-    void SetPositionX(float x) { position.x = x; }
-    void SetPositionY(float y) { position.y = y; }
-    void SetPositionZ(float z) { position.z = z; }
+    void SetRotation(float x, float y, float z) { MarkDirty(); rotation.x = x; rotation.y = y; rotation.z = z; }
+    void SetRotationX(float x) { MarkDirty(); rotation.x = x; }
+    void SetRotationY(float y) { MarkDirty(); rotation.y = y; }
+    void SetRotationZ(float z) { MarkDirty(); rotation.z = z; }
 
-    void SetRotation(float x, float y, float z) { rotation.x = x; rotation.y = y; rotation.z = z; }
-    void SetRotationX(float x) { rotation.x = x; }
-    void SetRotationY(float y) { rotation.y = y; }
-    void SetRotationZ(float z) { rotation.z = z; }
+    void SetScale(float x, float y, float z) { MarkDirty(); scale.x = x; scale.y = y; scale.z = z; }
+    void SetScaleX(float x) { MarkDirty(); scale.x = x; }
+    void SetScaleY(float y) { MarkDirty(); scale.y = y; }
+    void SetScaleZ(float z) { MarkDirty(); scale.z = z; }
 
-    void SetScale(float x, float y, float z) { scale.x = x; scale.y = y; scale.z = z; }
-    void SetScaleX(float x) { scale.x = x; }
-    void SetScaleY(float y) { scale.y = y; }
-    void SetScaleZ(float z) { scale.z = z; }
+    // 부모 Transform 설정 (nullptr이면 최상위), 월드 행렬 = 부모 월드 행렬 * 로컬 행렬
+    void SetParent(Transform* newParent);
+    Transform* GetParent() const { return parent; }
+    const std::vector<Transform*>& GetChildren() const { return children; }
+    int GetDepth() const;
 
-    glm::mat4 GetModelMatrix() const
+    // 캐시된 월드 행렬 반환 (값이 바뀐 경우에만 다시 계산)
+    // 보통은 ObjectManager의 일괄 갱신에서 계산되며, 그 사이에 값이 바뀐 경우에만 여기서 계산됨
+    // 병렬 업데이트 중에는 캐시를 갱신하지 않고 지난 일괄 갱신의 값을 돌려줌 (이때 바뀐 값이 있으면 ComputeModelMatrix 사용)
+    const glm::mat4& GetModelMatrix() const
     {
-        glm::mat4 scaleMat = glm::scale(glm::mat4(1.0f), scale);
-        glm::quat rotQuat = glm::quat(glm::radians(rotation));
-        glm::mat4 rotationMat = glm::mat4_cast(rotQuat);
-        glm::mat4 translateMat = glm::translate(glm::mat4(1.0f), position);
+        if (IsDirty())
+        {
+            if (ParallelUpdatePhase::IsActive())
+            {
+                UpdateWriteGuard::CheckCachedRead();
+                assert(!"Transform::GetModelMatrix on a dirty transform during a parallel update; use ComputeModelMatrix");
+            }
+            else
+            {
+                UpdateWorldMatrix();
+            }
+        }
+        return worldMatrix;
+    }
+    // 캐시를 건드리지 않고 현재 값으로 월드 행렬을 계산 (병렬 업데이트 중에도 안전, 바뀐 값이 있으면 조상까지 매번 계산)
+    glm::mat4 ComputeModelMatrix() const;
+    glm::vec3 GetWorldPosition() const { return glm::vec3(GetModelMatrix()[3]); }
+    // 월드 행렬이 다시 계산될 때마다 증가 (값이 바뀌었는지 비교하는 용도, GetModelMatrix 이후에 읽어야 최신)
+    unsigned int GetWorldVersion() const { return worldVersion; }
 
-        return translateMat * rotationMat * scaleMat;
+    // 자신 또는 부모 계층이 바뀌어 월드 행렬을 다시 계산해야 하는지
+    bool IsDirty() const
+    {
+        if (localDirty || worldDirty)
+        {
+            return true;
+        }
+        if (parent == nullptr)
+        {
+            return false;
+        }
+        return parent->IsDirty() || parent->worldVersion != parentVersion;
     }
+
+    // 부모의 월드 행렬이 최신이라는 가정하에 이 Transform만 갱신 (깊이 순서 일괄 갱신용)
+    // 갱신되었으면 true 반환
+    bool UpdateWorldMatrixFromParent() const;
+
+    // 일괄 갱신에서 재사용하는 임시 버퍼
+    struct BatchScratch
+    {
+        std::vector<const Transform*> localDirtyTransforms;
+        TransformStreams streams;
+        std::vector<glm::mat4> localMatrices;
+        // 지난 일괄 갱신 이후 월드 행렬이 바뀐 Transform의 sortedTransforms 내 위치 (GetModelMatrix로 먼저 갱신된 것 포함)
+        std::vector<uint32_t> changedIndices;
+    };
+
+    // 깊이 순으로 정렬된 목록 전체 갱신
+    // 로컬 값이 바뀐 것들의 로컬 행렬을 SIMD 커널로 한 번에 계산한 뒤, 순서대로 부모 행렬을 곱함
+    // 갱신된 개수 반환
+    static int UpdateWorldMatrices(const std::vector<Transform*>& sortedTransforms, BatchScratch& scratch);
+
+    // 부모-자식 관계가 바뀔 때마다 증가 (ObjectManager가 깊이 정렬 목록을 다시 만드는 기준)
+    static unsigned int GetHierarchyVersion() { return hierarchyVersion.load(std::memory_order_relaxed); }
+
 private:
+    void MarkDirty()
+    {
+        UpdateWriteGuard::Check(this);
+        localDirty = true;
+        worldDirty = true;
+    }
+    void UpdateWorldMatrix() const;
+
     glm::vec3 position = glm::vec3(0.0f);
     glm::vec3 rotation = glm::vec3(0.0f);
     glm::vec3 scale = glm::vec3(1.0f);
+
+    Transform* parent = nullptr;
+    std::vector<Transform*> children;
+
+    // 월드 행렬 캐시 (const 조회 중에 갱신되므로 mutable)
+    mutable glm::mat4 localMatrix = glm::mat4(1.0f);
+    mutable glm::mat4 worldMatrix = glm::mat4(1.0f);
+    mutable bool localDirty = true;           // 로컬 행렬을 다시 계산해야 함
+    mutable bool worldDirty = true;           // 로컬 행렬은 최신이지만 월드 행렬은 아직 반영 전
+    mutable unsigned int worldVersion = 0;   // 월드 행렬이 갱신될 때마다 증가
+    mutable unsigned int parentVersion = 0;  // 마지막 계산 때 사용한 부모의 worldVersion
+    mutable unsigned int reportedWorldVersion = 0; // 마지막 일괄 갱신에서 changedIndices로 알린 worldVersion
+
+    static inline std::atomic<unsigned int> hierarchyVersion{ 0 };
 };
@@ -0,0 +1,72 @@
+﻿#pragma once
+#include <glm.hpp>
+#include <vector>
+#include <cstddef>
+
+// 위치/회전/스케일 -> 모델 행렬 일괄 변환 커널
+// 실행 중 CPU를 검사하여 AVX2 / SSE / 스칼라 구현 중 하나를 선택함
+enum class TransformSimdLevel
+{
+    Scalar = 0,
+    SSE,
+    AVX2,
+};
+
+const char* TransformSimdLevelToString(TransformSimdLevel level);
+
+// 성분별로 연속된 배열 (x0 x1 x2 ... / y0 y1 y2 ...)
+// SIMD 레인 단위로 그대로 로드할 수 있도록 위치/회전(오일러, 도)/스케일을 따로 보관
+class TransformStreams
+{
+public:
+    enum Stream
+    {
+        PositionX, PositionY, PositionZ,
+        RotationX, RotationY, RotationZ,
+        ScaleX, ScaleY, ScaleZ,
+        StreamCount
+    };
+
+    void Resize(size_t count_);
+    size_t GetCount() const { return count; }
+
+    void Set(size_t index, const glm::vec3& position, const glm::vec3& rotation, const glm::vec3& scale)
+    {
+        streams[PositionX][index] = position.x; streams[PositionY][index] = position.y; streams[PositionZ][index] = position.z;
+        streams[RotationX][index] = rotation.x; streams[RotationY][index] = rotation.y; streams[RotationZ][index] = rotation.z;
+        streams[ScaleX][index] = scale.x; streams[ScaleY][index] = scale.y; streams[ScaleZ][index] = scale.z;
+    }
+
+    const float* Get(Stream stream) const { return streams[stream].data(); }
+
+private:
+    std::vector<float> streams[StreamCount];
+    size_t count = 0;
+};
+
+// 하나의 TRS를 행렬로 변환 (일괄 커널과 같은 sin/cos 근사식을 사용)
+glm::mat4 ComposeTransformMatrix(const glm::vec3& position, const glm::vec3& rotation, const glm::vec3& scale);
+
+// streams의 [begin, end) 범위를 outMatrices[begin, end)에 기록
+// 회전은 Transform과 같이 도 단위 오일러 각(XYZ)이며, 결과는 T * R * S
+void ComposeTransformMatrices(const TransformStreams& streams, size_t begin, size_t end, glm::mat4* outMatrices);
+void ComposeTransformMatrices(const TransformStreams& streams, size_t begin, size_t end, glm::mat4* outMatrices, TransformSimdLevel level);
+
+// 이 CPU에서 사용할 수 있는 최고 수준
+TransformSimdLevel GetSupportedTransformSimdLevel();
+// 실제로 사용할 수준 (지원 수준보다 높게 지정하면 지원 수준으로 제한됨, 비교 측정용)
+TransformSimdLevel GetTransformSimdLevel();
+void SetTransformSimdLevel(TransformSimdLevel level);
+
+// 기존 Transform::GetModelMatrix 방식(glm::translate * mat4_cast * scale)과 각 커널 비교 결과
+struct TransformBenchmarkResult
+{
+    int transformCount = 0;
+    float glmMs = 0.0f;
+    float scalarMs = 0.0f;
+    float sseMs = 0.0f;
+    float avx2Ms = 0.0f;   // 지원하지 않으면 음수
+    float maxError = 0.0f; // glm 결과 대비 최대 오차
+};
+
+TransformBenchmarkResult RunTransformBenchmark(int transformCount);
@@ -0,0 +1,81 @@
+﻿#pragma once
+#include <atomic>
+
+class Component;
+
+// 컴포넌트 업데이트 단계 (정의된 순서대로 실행됨)
+enum class UpdatePhase
+{
+    PreAnimation,   // 애니메이션 상태 결정 (FSM 등)
+    Animation,      // 애니메이션 시간/본 행렬 계산
+    PostAnimation,  // 애니메이션 결과를 사용하는 로직
+    LateUpdate,     // 렌더링 직전 처리
+    Count
+};
+
+inline const char* UpdatePhaseToString(UpdatePhase phase)
+{
+    switch (phase)
+    {
+    case UpdatePhase::PreAnimation: return "PreAnimation";
+    case UpdatePhase::Animation: return "Animation";
+    case UpdatePhase::PostAnimation: return "PostAnimation";
+    case UpdatePhase::LateUpdate: return "LateUpdate";
+    default: return "Invalid";
+    }
+}
+
+// 병렬 컴포넌트 업데이트가 진행 중인지 (ComponentStorage::UpdateAll이 설정)
+// 이 동안 Transform은 캐시를 갱신하지 않음 (여러 잡이 같은 부모의 캐시를 동시에 쓰게 되므로)
+class ParallelUpdatePhase
+{
+public:
+    static void SetActive(bool active_) { active.store(active_, std::memory_order_release); }
+    static bool IsActive() { return active.load(std::memory_order_acquire); }
+
+private:
+    static inline std::atomic<bool> active{ false };
+};
+
+// 병렬 업데이트 컴포넌트가 자기 오브젝트 외의 Transform을 수정하는지 검사하는 디버그 도구
+// 활성화되면 병렬 컴포넌트의 Update 동안 스레드별로 "쓰기가 허용된 Transform"을 기록해 두고,
+// Transform의 Setter에서 다른 대상이 수정되면 위반으로 기록함
+// GetModelMatrix가 바뀐 Transform의 캐시를 갱신해야 하는 경우(병렬 중에는 갱신하지 않음)도 위반으로 기록
+class UpdateWriteGuard
+{
+public:
+    static void SetEnabled(bool enable) { enabled.store(enable, std::memory_order_relaxed); }
+    static bool IsEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+    // 컴포넌트 Update 직전/직후 호출 (ComponentStorage.cpp)
+    static void Begin(Component* component);
+    static void End();
+
+    static void Check(const void* transform)
+    {
+        if (allowedTransform != nullptr && allowedTransform != transform)
+        {
+            ReportViolation("wrote another object's transform");
+        }
+    }
+
+    // 병렬 업데이트 중 갱신이 필요한 Transform의 캐시된 행렬을 읽음 (대상과 관계없이 위반)
+    static void CheckCachedRead()
+    {
+        if (currentComponent != nullptr)
+        {
+            ReportViolation("read a stale cached transform (use ComputeModelMatrix)");
+        }
+    }
+
+    static int GetViolationCount() { return violationCount.load(std::memory_order_relaxed); }
+    static void ResetViolationCount() { violationCount.store(0, std::memory_order_relaxed); }
+
+private:
+    static void ReportViolation(const char* description);
+
+    static inline std::atomic<bool> enabled{ false };
+    static inline std::atomic<int> violationCount{ 0 };
+    static inline thread_local const void* allowedTransform = nullptr;
+    static inline thread_local Component* currentComponent = nullptr;
+};
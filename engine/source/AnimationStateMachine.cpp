@@ -5,7 +5,7 @@
 #include "MeshRenderer.hpp" 
 #include <iostream> // 
 
-AnimationStateMachine::AnimationStateMachine() : Component(ComponentTypes::INVALID) {}
+AnimationStateMachine::AnimationStateMachine() : Component(StaticType) {}
 
 void AnimationStateMachine::Init()
 {
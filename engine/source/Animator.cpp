@@ -12,7 +12,7 @@
 #include "ObjectManager.hpp" 
 
 Animator::Animator()
-	: Component(ComponentTypes::ANIMATOR),
+	: Component(StaticType),
 	currentTime(0.0f)
 {
 	finalBoneMatrices.reserve(maxBones);
@@ -126,7 +126,8 @@ void Animator::Update(float dt)
 		}
 	}
 
-	CalculateBoneTransform(&currentAnimation->GetRootNode(), GetOwner()->transform.GetModelMatrix());
+	// 병렬 업데이트 중이므로 Transform 캐시를 갱신하지 않는 계산 사용 (위에서 바꾼 루트 모션 위치까지 반영)
+	CalculateBoneTransform(&currentAnimation->GetRootNode(), GetOwner()->transform.ComputeModelMatrix());
 }
 
 void Animator::PlayAnimation(Animation* newAnimation, bool isLoop, float speed, float blendDuration)
@@ -170,7 +171,7 @@ void Animator::PlayAnimation(Animation* newAnimation, bool isLoop, float speed,
 	// 새 애니메이션의 루트 모션 시작점을 '현재' 오브젝트 위치로 갱신
 	if (enableRootMotion && owner)
 	{
-		rootMotionStartTransform = owner->transform.GetModelMatrix();
+		rootMotionStartTransform = owner->transform.ComputeModelMatrix();
 	}
 
 	// 루트 뼈 자동 감지 로직
@@ -258,16 +259,15 @@ void Animator::CalculateBoneTransform(const AssimpNodeData* node, glm::mat4 pare
 	glm::mat4 currLocalT = node->transformation;
 	bool currFound = false;
 
+	// Bone은 여러 Animator가 공유하므로 상태를 바꾸는 Update 대신 계산 결과만 받아서 사용
 	if (currBone) {
-		currBone->Update(currentTime);
-		currLocalT = currBone->GetLocalTransform();
+		currLocalT = currBone->CalculateLocalTransform(currentTime);
 		currFound = true;
 	}
 
 	if (prevBone && blendFactor < 1.0f)
 	{
-		prevBone->Update(previousTime);
-		glm::mat4 prevLocalT = prevBone->GetLocalTransform();
+		glm::mat4 prevLocalT = prevBone->CalculateLocalTransform(previousTime);
 
 		glm::vec3 prevPos, currPos, prevScale, currScale, prevSkew, currSkew;
 		glm::quat prevRot, currRot;
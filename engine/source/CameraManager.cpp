@@ -1,6 +1,7 @@
 #include "CameraManager.hpp"
 #include "Engine.hpp"
 #include "InputManager.hpp"
+#include "RenderManager.hpp"
 
 #include "imgui.h"
 #include <string>
@@ -24,6 +25,11 @@ void CameraManager::Update(float /*dt*/)
 
 void CameraManager::ClearCameras()
 {
+    //  ī޶󺰷  ¸  
+    for (const auto& cameraPtr : cameraList)
+    {
+        Engine::GetInstance().GetRenderManager()->RemoveCameraState(cameraPtr.get());
+    }
     // unique_ptr̹Ƿ clear() ȣǸ  ī޶ ü ڵ Ҹ˴ϴ.
     cameraList.clear();
     mainCameraIndex = -1; //  ī޶ ε ʱȭ
@@ -43,6 +49,7 @@ void CameraManager::DeleteCamera(int index)
     if (index == mainCameraIndex) return; //  ī޶  Ұ
 
     // Ϳ 
+    Engine::GetInstance().GetRenderManager()->RemoveCameraState(cameraList[index].get());
     cameraList.erase(cameraList.begin() + index);
 
     //  ī޶󺸴 ڿ ִ  ī޶ ε ϳ 
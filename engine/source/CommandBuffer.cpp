@@ -0,0 +1,180 @@
+﻿#include "CommandBuffer.hpp"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+void CommandBuffer::Reset()
+{
+    for (Command* command : commands)
+    {
+        command->destroy(command);
+    }
+    commands.clear();
+    currentBlock = 0;
+    offset = 0;
+}
+
+size_t CommandBuffer::GetBytesUsed() const
+{
+    size_t bytes = offset;
+    for (size_t i = 0; i < currentBlock && i < blocks.size(); ++i)
+    {
+        bytes += blocks[i].size;
+    }
+    return bytes;
+}
+
+void* CommandBuffer::Allocate(size_t size, size_t alignment)
+{
+    while (true)
+    {
+        while (currentBlock < blocks.size())
+        {
+            // 블록 시작 주소가 alignment로 정렬되어 있다는 보장이 없으므로 오프셋이 아닌 실제 주소를 정렬
+            Block& block = blocks[currentBlock];
+            void* pointer = block.data.get() + offset;
+            size_t space = block.size - offset;
+            if (std::align(alignment, size, pointer, space))
+            {
+                offset = static_cast<size_t>(static_cast<std::byte*>(pointer) - block.data.get()) + size;
+                return pointer;
+            }
+            // 현재 블록에 자리가 없으면 다음 블록으로
+            ++currentBlock;
+            offset = 0;
+        }
+
+        // 기존 블록을 모두 사용했을 때만 새 블록 할당 (블록 크기보다 큰 명령은 전용 블록)
+        // 정렬에 최대 alignment - 1 바이트가 쓰이므로 size + alignment면 항상 들어감
+        Block block;
+        block.size = std::max(blockSize, size + alignment);
+        block.data = std::make_unique<std::byte[]>(block.size);
+        blocks.push_back(std::move(block));
+        currentBlock = blocks.size() - 1;
+        offset = 0;
+    }
+}
+
+CommandQueue::CommandQueue()
+{
+    static std::atomic<uint64_t> nextQueueId{ 1 };
+    queueId = nextQueueId.fetch_add(1);
+}
+
+CommandQueue::ThreadBuffers& CommandQueue::GetThreadBuffers()
+{
+    // 스레드마다 마지막으로 사용한 큐를 기억하여 레지스트리 잠금을 피함
+    struct Cache
+    {
+        uint64_t queueId = 0;
+        ThreadBuffers* buffers = nullptr;
+    };
+    thread_local Cache cache;
+    if (cache.queueId == queueId)
+    {
+        return *cache.buffers;
+    }
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    std::thread::id threadId = std::this_thread::get_id();
+    ThreadBuffers* found = nullptr;
+    for (const auto& buffers : threadBuffers)
+    {
+        if (buffers->threadId == threadId)
+        {
+            found = buffers.get();
+            break;
+        }
+    }
+    if (found == nullptr)
+    {
+        auto newBuffers = std::make_unique<ThreadBuffers>();
+        newBuffers->threadId = threadId;
+        found = newBuffers.get();
+        threadBuffers.push_back(std::move(newBuffers));
+    }
+
+    cache.queueId = queueId;
+    cache.buffers = found;
+    return *found;
+}
+
+void CommandQueue::Execute(bool sortByKey)
+{
+    mergedCommands.clear();
+    executingBuffers.clear();
+    lastBytesUsed = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        for (size_t i = 0; i < threadBuffers.size(); ++i)
+        {
+            ThreadBuffers& buffers = *threadBuffers[i];
+            CommandBuffer* executing = nullptr;
+            {
+                // 기록 버퍼를 교체하여 실행 중에 추가되는 명령은 다른 버퍼로 가도록 함
+                std::lock_guard<std::mutex> bufferLock(buffers.mutex);
+                executing = &buffers.buffers[buffers.recordIndex];
+                buffers.recordIndex ^= 1;
+            }
+            if (executing->GetCount() == 0)
+            {
+                continue;
+            }
+            for (CommandBuffer::Command* command : executing->GetCommands())
+            {
+                command->bufferIndex = static_cast<uint32_t>(i);
+                mergedCommands.push_back(command);
+            }
+            lastBytesUsed += executing->GetBytesUsed();
+            executingBuffers.push_back(executing);
+        }
+    }
+
+    if (sortByKey)
+    {
+        // (오브젝트, 스레드, 기록 순서) 순으로 정렬하여 같은 오브젝트의 명령은 기록 순서를 유지
+        std::sort(mergedCommands.begin(), mergedCommands.end(),
+            [](const CommandBuffer::Command* a, const CommandBuffer::Command* b)
+        {
+            if (a->sortKey != b->sortKey) return a->sortKey < b->sortKey;
+            if (a->bufferIndex != b->bufferIndex) return a->bufferIndex < b->bufferIndex;
+            return a->sequence < b->sequence;
+        });
+    }
+
+    for (CommandBuffer::Command* command : mergedCommands)
+    {
+        command->invoke(command);
+    }
+    lastExecutedCount = mergedCommands.size();
+
+    for (CommandBuffer* buffer : executingBuffers)
+    {
+        buffer->Reset();
+    }
+    mergedCommands.clear();
+    executingBuffers.clear();
+}
+
+void CommandQueue::Clear()
+{
+    std::lock_guard<std::mutex> lock(registryMutex);
+    for (const auto& buffers : threadBuffers)
+    {
+        std::lock_guard<std::mutex> bufferLock(buffers->mutex);
+        buffers->buffers[0].Reset();
+        buffers->buffers[1].Reset();
+    }
+}
+
+size_t CommandQueue::GetBlockCount() const
+{
+    std::lock_guard<std::mutex> lock(registryMutex);
+    size_t count = 0;
+    for (const auto& buffers : threadBuffers)
+    {
+        count += buffers->buffers[0].GetBlockCount() + buffers->buffers[1].GetBlockCount();
+    }
+    return count;
+}
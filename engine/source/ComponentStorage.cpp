@@ -0,0 +1,132 @@
+﻿#include "ComponentStorage.hpp"
+#include "Object.hpp"
+#include "ThreadManager.hpp"
+#include <iostream>
+
+namespace
+{
+    // 이보다 적은 컴포넌트는 한 배치로 처리 (잡 생성 비용이 더 큼)
+    constexpr int PARALLEL_BATCH_SIZE = 32;
+}
+
+void UpdateWriteGuard::Begin(Component* component)
+{
+    currentComponent = component;
+    Object* owner = component->GetOwner();
+    allowedTransform = owner ? &owner->transform : nullptr;
+}
+
+void UpdateWriteGuard::End()
+{
+    currentComponent = nullptr;
+    allowedTransform = nullptr;
+}
+
+void UpdateWriteGuard::ReportViolation(const char* description)
+{
+    // 같은 문제가 매 프레임 반복되므로 처음 몇 번만 출력
+    int count = violationCount.fetch_add(1, std::memory_order_relaxed);
+    if (count < 8 && currentComponent)
+    {
+        Object* owner = currentComponent->GetOwner();
+        std::cerr << "[Warning] Parallel " << ComponentToString(currentComponent->Component::GetType())
+            << " component of '" << (owner ? owner->GetName() : std::string("?"))
+            << "' " << description << std::endl;
+    }
+}
+
+void ComponentStorage::Destroy(Component* component)
+{
+    if (component == nullptr)
+    {
+        return;
+    }
+    if (component->pool)
+    {
+        component->pool->Release(component);
+    }
+    else
+    {
+        delete component;
+    }
+}
+
+void ComponentStorage::UpdateAll(float dt, ThreadManager* threadManager)
+{
+    // 단계 순서대로, 각 단계 안에서는 타입별 풀을 차례로 순회 (같은 타입의 컴포넌트는 메모리상 연속)
+    for (const auto& phase : phasePools)
+    {
+        for (ComponentPoolBase* pool : phase)
+        {
+            if (!pool->HasUpdate() || pool->GetCount() == 0)
+            {
+                continue;
+            }
+            if (parallelUpdate && threadManager && pool->IsParallel())
+            {
+                // 자기 오브젝트만 수정하는 컴포넌트이므로 분할 순서와 관계없이 결과가 동일함
+                ParallelUpdatePhase::SetActive(true);
+                threadManager->ParallelFor(static_cast<int>(pool->GetCount()), PARALLEL_BATCH_SIZE, [pool, dt](int begin, int end)
+                {
+                    pool->UpdateRange(static_cast<size_t>(begin), static_cast<size_t>(end), dt);
+                });
+                ParallelUpdatePhase::SetActive(false);
+            }
+            else
+            {
+                pool->UpdateAll(dt);
+            }
+        }
+    }
+}
+
+void ComponentStorage::Attach(Object* object)
+{
+    object->storage = this;
+    for (const auto& [component, adopt] : object->unpooledComponents)
+    {
+        adopt(*this, component);
+    }
+    object->unpooledComponents.clear();
+
+    std::vector<Object*>& bucket = archetypes[object->signature];
+    object->archetypeIndex = static_cast<unsigned int>(bucket.size());
+    bucket.push_back(object);
+}
+
+void ComponentStorage::Detach(Object* object)
+{
+    RemoveFromArchetype(object);
+    object->storage = nullptr;
+}
+
+void ComponentStorage::ChangeSignature(Object* object, ComponentSignature newSignature)
+{
+    RemoveFromArchetype(object);
+    object->signature = newSignature;
+
+    std::vector<Object*>& bucket = archetypes[newSignature];
+    object->archetypeIndex = static_cast<unsigned int>(bucket.size());
+    bucket.push_back(object);
+}
+
+void ComponentStorage::RemoveFromArchetype(Object* object)
+{
+    auto it = archetypes.find(object->signature);
+    if (it == archetypes.end())
+    {
+        return;
+    }
+
+    // swap-and-pop으로 아키타입 버킷에서 제거
+    std::vector<Object*>& bucket = it->second;
+    unsigned int index = object->archetypeIndex;
+    if (index >= bucket.size() || bucket[index] != object)
+    {
+        return;
+    }
+    Object* last = bucket.back();
+    bucket[index] = last;
+    last->archetypeIndex = index;
+    bucket.pop_back();
+}
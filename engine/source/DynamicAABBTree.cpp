@@ -0,0 +1,499 @@
+﻿#include "DynamicAABBTree.hpp"
+#include <gtc/matrix_transform.hpp>
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <random>
+
+namespace
+{
+    float TicksToMs(Uint64 ticks)
+    {
+        return static_cast<float>(ticks) * 1000.0f / static_cast<float>(SDL_GetPerformanceFrequency());
+    }
+}
+
+int DynamicAABBTree::AllocateNode()
+{
+    if (freeList == NULL_NODE)
+    {
+        nodes.emplace_back();
+        return static_cast<int>(nodes.size()) - 1;
+    }
+    int index = freeList;
+    freeList = nodes[index].parent;
+    nodes[index] = Node{};
+    return index;
+}
+
+void DynamicAABBTree::FreeNode(int index)
+{
+    nodes[index].parent = freeList;
+    nodes[index].height = -1;
+    freeList = index;
+}
+
+AABB DynamicAABBTree::MakeFatBounds(const AABB& bounds) const
+{
+    return bounds.Inflate(bounds.GetExtents() * marginRatio + glm::vec3(marginMinimum));
+}
+
+int DynamicAABBTree::CreateProxy(const AABB& bounds, uint32_t userData)
+{
+    int proxyId = AllocateNode();
+    Node& node = nodes[proxyId];
+    node.bounds = MakeFatBounds(bounds);
+    node.userData = userData;
+    node.height = 0;
+    InsertLeaf(proxyId);
+    ++proxyCount;
+    return proxyId;
+}
+
+void DynamicAABBTree::DestroyProxy(int proxyId)
+{
+    RemoveLeaf(proxyId);
+    FreeNode(proxyId);
+    --proxyCount;
+}
+
+bool DynamicAABBTree::MoveProxy(int proxyId, const AABB& bounds)
+{
+    // 여유 상자 안에서 움직이면 트리 구조는 그대로 (대부분의 작은 이동)
+    if (nodes[proxyId].bounds.Contains(bounds))
+    {
+        return false;
+    }
+    RemoveLeaf(proxyId);
+    nodes[proxyId].bounds = MakeFatBounds(bounds);
+    InsertLeaf(proxyId);
+    return true;
+}
+
+void DynamicAABBTree::Clear()
+{
+    nodes.clear();
+    root = NULL_NODE;
+    freeList = NULL_NODE;
+    proxyCount = 0;
+}
+
+float DynamicAABBTree::GetAreaRatio() const
+{
+    if (root == NULL_NODE)
+    {
+        return 0.0f;
+    }
+    float rootArea = nodes[root].bounds.GetSurfaceArea();
+    float totalArea = 0.0f;
+    for (const Node& node : nodes)
+    {
+        if (node.height > 0)
+        {
+            totalArea += node.bounds.GetSurfaceArea();
+        }
+    }
+    return rootArea > 0.0f ? totalArea / rootArea : 0.0f;
+}
+
+void DynamicAABBTree::InsertLeaf(int leaf)
+{
+    if (root == NULL_NODE)
+    {
+        root = leaf;
+        nodes[root].parent = NULL_NODE;
+        return;
+    }
+
+    // 형제 고르기: 여기서 멈추면 드는 비용(새 부모의 면적)과 자식으로 내려가면 드는 최소 비용을 비교
+    // 내려갈 때 지나는 조상들은 모두 새 잎만큼 커지므로 그 증가분(inheritance)을 함께 더함
+    AABB leafBounds = nodes[leaf].bounds;
+    int index = root;
+    while (!nodes[index].IsLeaf())
+    {
+        const Node& node = nodes[index];
+        float area = node.bounds.GetSurfaceArea();
+        float combinedArea = AABB::Union(node.bounds, leafBounds).GetSurfaceArea();
+
+        float cost = 2.0f * combinedArea;
+        float inheritanceCost = 2.0f * (combinedArea - area);
+
+        auto childCost = [&](int child)
+        {
+            const Node& childNode = nodes[child];
+            float newArea = AABB::Union(leafBounds, childNode.bounds).GetSurfaceArea();
+            return childNode.IsLeaf() ? newArea + inheritanceCost : (newArea - childNode.bounds.GetSurfaceArea()) + inheritanceCost;
+        };
+        float cost1 = childCost(node.child1);
+        float cost2 = childCost(node.child2);
+
+        if (cost < cost1 && cost < cost2)
+        {
+            break;
+        }
+        index = (cost1 < cost2) ? node.child1 : node.child2;
+    }
+    int sibling = index;
+
+    // 형제 자리에 새 부모를 만들고 형제와 잎을 자식으로
+    int oldParent = nodes[sibling].parent;
+    int newParent = AllocateNode();
+    nodes[newParent].parent = oldParent;
+    nodes[newParent].bounds = AABB::Union(leafBounds, nodes[sibling].bounds);
+    nodes[newParent].height = nodes[sibling].height + 1;
+    nodes[newParent].child1 = sibling;
+    nodes[newParent].child2 = leaf;
+    nodes[sibling].parent = newParent;
+    nodes[leaf].parent = newParent;
+
+    if (oldParent == NULL_NODE)
+    {
+        root = newParent;
+    }
+    else if (nodes[oldParent].child1 == sibling)
+    {
+        nodes[oldParent].child1 = newParent;
+    }
+    else
+    {
+        nodes[oldParent].child2 = newParent;
+    }
+
+    RefitAncestors(oldParent);
+}
+
+void DynamicAABBTree::RemoveLeaf(int leaf)
+{
+    if (leaf == root)
+    {
+        root = NULL_NODE;
+        return;
+    }
+
+    // 부모를 없애고 형제를 조부모에 바로 연결
+    int parent = nodes[leaf].parent;
+    int grandParent = nodes[parent].parent;
+    int sibling = (nodes[parent].child1 == leaf) ? nodes[parent].child2 : nodes[parent].child1;
+
+    if (grandParent == NULL_NODE)
+    {
+        root = sibling;
+        nodes[sibling].parent = NULL_NODE;
+        FreeNode(parent);
+        return;
+    }
+
+    if (nodes[grandParent].child1 == parent)
+    {
+        nodes[grandParent].child1 = sibling;
+    }
+    else
+    {
+        nodes[grandParent].child2 = sibling;
+    }
+    nodes[sibling].parent = grandParent;
+    FreeNode(parent);
+
+    RefitAncestors(grandParent);
+}
+
+void DynamicAABBTree::RefitAncestors(int index)
+{
+    while (index != NULL_NODE)
+    {
+        Node& node = nodes[index];
+        node.bounds = AABB::Union(nodes[node.child1].bounds, nodes[node.child2].bounds);
+        node.height = 1 + std::max(nodes[node.child1].height, nodes[node.child2].height);
+        RotateNodes(index);
+        index = nodes[index].parent;
+    }
+}
+
+void DynamicAABBTree::RotateNodes(int indexA)
+{
+    /*
+           A
+         /   \
+        B     C
+       / \   / \
+      D   E F   G
+    */
+    // 자식 하나를 반대편 손자와 바꾸면 A의 경계는 그대로이고, 바뀐 쪽 자식의 면적만 달라짐
+    // 네 가지 교환 중 면적을 가장 많이 줄이는 것을 적용 (줄지 않으면 그대로)
+    Node& A = nodes[indexA];
+    if (A.height < 2)
+    {
+        return;
+    }
+
+    int indexB = A.child1;
+    int indexC = A.child2;
+    Node& B = nodes[indexB];
+    Node& C = nodes[indexC];
+
+    enum class Rotation { None, BF, BG, CD, CE };
+    Rotation bestRotation = Rotation::None;
+    float bestDelta = 0.0f;
+
+    if (!C.IsLeaf())
+    {
+        float areaC = C.bounds.GetSurfaceArea();
+        // B <-> F: C = (B, G)
+        float deltaBF = AABB::Union(B.bounds, nodes[C.child2].bounds).GetSurfaceArea() - areaC;
+        // B <-> G: C = (F, B)
+        float deltaBG = AABB::Union(B.bounds, nodes[C.child1].bounds).GetSurfaceArea() - areaC;
+        if (deltaBF < bestDelta) { bestDelta = deltaBF; bestRotation = Rotation::BF; }
+        if (deltaBG < bestDelta) { bestDelta = deltaBG; bestRotation = Rotation::BG; }
+    }
+    if (!B.IsLeaf())
+    {
+        float areaB = B.bounds.GetSurfaceArea();
+        // C <-> D: B = (C, E)
+        float deltaCD = AABB::Union(C.bounds, nodes[B.child2].bounds).GetSurfaceArea() - areaB;
+        // C <-> E: B = (D, C)
+        float deltaCE = AABB::Union(C.bounds, nodes[B.child1].bounds).GetSurfaceArea() - areaB;
+        if (deltaCD < bestDelta) { bestDelta = deltaCD; bestRotation = Rotation::CD; }
+        if (deltaCE < bestDelta) { bestDelta = deltaCE; bestRotation = Rotation::CE; }
+    }
+
+    // child를 parent의 자식으로 옮기고 바뀐 중간 노드의 경계/높이를 다시 계산
+    auto swapIntoParent = [&](int indexMoved, int indexInner, int& innerSlot)
+    {
+        int indexGrandChild = innerSlot;
+        Node& inner = nodes[indexInner];
+        innerSlot = indexMoved;
+        nodes[indexMoved].parent = indexInner;
+        nodes[indexGrandChild].parent = indexA;
+        inner.bounds = AABB::Union(nodes[inner.child1].bounds, nodes[inner.child2].bounds);
+        inner.height = 1 + std::max(nodes[inner.child1].height, nodes[inner.child2].height);
+        return indexGrandChild;
+    };
+
+    switch (bestRotation)
+    {
+    case Rotation::None:
+        return;
+    case Rotation::BF:
+        A.child1 = swapIntoParent(indexB, indexC, C.child1);
+        break;
+    case Rotation::BG:
+        A.child1 = swapIntoParent(indexB, indexC, C.child2);
+        break;
+    case Rotation::CD:
+        A.child2 = swapIntoParent(indexC, indexB, B.child1);
+        break;
+    case Rotation::CE:
+        A.child2 = swapIntoParent(indexC, indexB, B.child2);
+        break;
+    }
+    A.height = 1 + std::max(nodes[A.child1].height, nodes[A.child2].height);
+}
+
+SpatialTreeBenchmarkResult RunSpatialTreeBenchmark(int objectCount)
+{
+    SpatialTreeBenchmarkResult result;
+    result.objectCount = objectCount;
+
+    // 한 변 worldSize인 공간에 0.5 ~ 3 크기의 상자를 흩뿌림 (오브젝트 밀도는 개수와 무관하게 비슷하게 유지)
+    std::mt19937 random(1234);
+    float worldSize = std::cbrt(static_cast<float>(objectCount)) * 8.0f;
+    std::uniform_real_distribution<float> position(-worldSize * 0.5f, worldSize * 0.5f);
+    std::uniform_real_distribution<float> halfSize(0.25f, 1.5f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    auto randomBox = [&](const glm::vec3& center)
+    {
+        glm::vec3 extents(halfSize(random), halfSize(random), halfSize(random));
+        return AABB{ center - extents, center + extents };
+    };
+
+    std::vector<AABB> boxes(objectCount);
+    for (AABB& box : boxes)
+    {
+        box = randomBox(glm::vec3(position(random), position(random), position(random)));
+    }
+
+    DynamicAABBTree tree;
+    std::vector<int> proxies(objectCount);
+    Uint64 start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < objectCount; ++i)
+    {
+        proxies[i] = tree.CreateProxy(boxes[i], static_cast<uint32_t>(i));
+    }
+    result.buildMs = TicksToMs(SDL_GetPerformanceCounter() - start);
+
+    // 1%는 여유 상자 안에서 조금, 1%는 멀리 이동 (움직인 것만 갱신하는 경우)
+    int movedCount = std::max(1, objectCount / 100);
+    std::vector<int> movedIndices(movedCount * 2);
+    std::vector<AABB> movedBoxes(movedCount * 2);
+    for (int i = 0; i < movedCount * 2; ++i)
+    {
+        int index = static_cast<int>(random() % static_cast<uint32_t>(objectCount));
+        movedIndices[i] = index;
+        glm::vec3 offset = (i < movedCount) ? glm::vec3(unit(random), unit(random), unit(random)) * 0.02f
+            : glm::vec3(position(random), position(random), position(random)) - boxes[index].GetCenter();
+        movedBoxes[i] = AABB{ boxes[index].min + offset, boxes[index].max + offset };
+    }
+    start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < movedCount * 2; ++i)
+    {
+        if (tree.MoveProxy(proxies[movedIndices[i]], movedBoxes[i]))
+        {
+            ++result.reinsertedProxies;
+        }
+    }
+    result.moveMs = TicksToMs(SDL_GetPerformanceCounter() - start);
+    for (int i = 0; i < movedCount * 2; ++i)
+    {
+        boxes[movedIndices[i]] = movedBoxes[i];
+    }
+    result.treeHeight = tree.GetHeight();
+    result.areaRatio = tree.GetAreaRatio();
+
+    bool matches = true;
+    // 트리는 여유 상자로 후보를 찾고 실제 상자로 다시 판정하므로 결과가 전수 검사와 같아야 함
+    auto compareSets = [&](std::vector<uint32_t>& treeHits, std::vector<uint32_t>& linearHits)
+    {
+        std::sort(treeHits.begin(), treeHits.end());
+        std::sort(linearHits.begin(), linearHits.end());
+        if (treeHits != linearHits)
+        {
+            matches = false;
+        }
+    };
+
+    // 절두체: 공간 가장자리에서 중심을 바라보는 카메라
+    glm::mat4 view = glm::lookAt(glm::vec3(-worldSize * 0.5f, worldSize * 0.1f, -worldSize * 0.5f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, worldSize * 0.75f);
+    Frustum frustum(projection * view);
+
+    std::vector<uint32_t> treeHits, linearHits;
+    start = SDL_GetPerformanceCounter();
+    tree.QueryFrustum(frustum, [&](uint32_t index)
+    {
+        if (frustum.TestAABB(boxes[index]))
+        {
+            treeHits.push_back(index);
+        }
+    });
+    result.frustumTreeMs = TicksToMs(SDL_GetPerformanceCounter() - start);
+
+    BoundsArray boundsArray;
+    boundsArray.Resize(boxes.size());
+    for (size_t i = 0; i < boxes.size(); ++i)
+    {
+        boundsArray.Set(i, boxes[i]);
+    }
+    std::vector<uint8_t> visible;
+    start = SDL_GetPerformanceCounter();
+    result.frustumVisible = frustum.CullBoxes(boundsArray, visible, true);
+    result.frustumLinearMs = TicksToMs(SDL_GetPerformanceCounter() - start);
+    for (int i = 0; i < objectCount; ++i)
+    {
+        if (visible[i]) linearHits.push_back(static_cast<uint32_t>(i));
+    }
+    compareSets(treeHits, linearHits);
+
+    // 광선: 가장 가까운 상자
+    constexpr int RAY_COUNT = 1000;
+    std::vector<glm::vec3> rayOrigins(RAY_COUNT), rayDirections(RAY_COUNT);
+    for (int i = 0; i < RAY_COUNT; ++i)
+    {
+        rayOrigins[i] = glm::vec3(position(random), position(random), position(random));
+        rayDirections[i] = glm::normalize(glm::vec3(unit(random), unit(random), unit(random)) + glm::vec3(0.001f));
+    }
+    std::vector<int> treeNearest(RAY_COUNT, -1), linearNearest(RAY_COUNT, -1);
+    float maxDistance = worldSize * 2.0f;
+    start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < RAY_COUNT; ++i)
+    {
+        glm::vec3 inverseDirection = 1.0f / rayDirections[i];
+        tree.RayCast(rayOrigins[i], rayDirections[i], maxDistance, [&](uint32_t index, float currentMax)
+        {
+            float hitDistance;
+            if (boxes[index].IntersectRay(rayOrigins[i], inverseDirection, currentMax, hitDistance) && hitDistance < currentMax)
+            {
+                treeNearest[i] = static_cast<int>(index);
+                return hitDistance;
+            }
+            return currentMax;
+        });
+    }
+    result.rayTreeMs = TicksToMs(SDL_GetPerformanceCounter() - start);
+
+    std::vector<float> treeDistances(RAY_COUNT), linearDistances(RAY_COUNT);
+    start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < RAY_COUNT; ++i)
+    {
+        glm::vec3 inverseDirection = 1.0f / rayDirections[i];
+        float nearest = maxDistance;
+        for (int index = 0; index < objectCount; ++index)
+        {
+            float hitDistance;
+            if (boxes[index].IntersectRay(rayOrigins[i], inverseDirection, nearest, hitDistance) && hitDistance < nearest)
+            {
+                nearest = hitDistance;
+                linearNearest[i] = index;
+            }
+        }
+        linearDistances[i] = nearest;
+    }
+    result.rayLinearMs = TicksToMs(SDL_GetPerformanceCounter() - start);
+    for (int i = 0; i < RAY_COUNT; ++i)
+    {
+        // 같은 거리에서 여러 상자와 만나면 고른 상자가 다를 수 있으므로 거리로 비교
+        float hitDistance = maxDistance;
+        if (treeNearest[i] >= 0)
+        {
+            boxes[treeNearest[i]].IntersectRay(rayOrigins[i], 1.0f / rayDirections[i], maxDistance, hitDistance);
+        }
+        if ((treeNearest[i] < 0) != (linearNearest[i] < 0) || hitDistance != linearDistances[i])
+        {
+            matches = false;
+        }
+    }
+
+    // 겹침: 상자와 구 질의를 번갈아 실행
+    constexpr int OVERLAP_COUNT = 500;
+    std::vector<glm::vec3> queryCenters(OVERLAP_COUNT);
+    for (glm::vec3& center : queryCenters)
+    {
+        center = glm::vec3(position(random), position(random), position(random));
+    }
+    const float queryRadius = 6.0f;
+    std::vector<std::vector<uint32_t>> treeOverlaps(OVERLAP_COUNT), linearOverlaps(OVERLAP_COUNT);
+    start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < OVERLAP_COUNT; ++i)
+    {
+        const glm::vec3& center = queryCenters[i];
+        if (i % 2 == 0)
+        {
+            AABB query{ center - glm::vec3(queryRadius), center + glm::vec3(queryRadius) };
+            tree.QueryAABB(query, [&](uint32_t index) { if (boxes[index].Overlaps(query)) treeOverlaps[i].push_back(index); });
+        }
+        else
+        {
+            tree.QuerySphere(center, queryRadius, [&](uint32_t index) { if (boxes[index].OverlapsSphere(center, queryRadius)) treeOverlaps[i].push_back(index); });
+        }
+    }
+    result.overlapTreeMs = TicksToMs(SDL_GetPerformanceCounter() - start);
+
+    start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < OVERLAP_COUNT; ++i)
+    {
+        const glm::vec3& center = queryCenters[i];
+        AABB query{ center - glm::vec3(queryRadius), center + glm::vec3(queryRadius) };
+        for (int index = 0; index < objectCount; ++index)
+        {
+            bool overlaps = (i % 2 == 0) ? boxes[index].Overlaps(query) : boxes[index].OverlapsSphere(center, queryRadius);
+            if (overlaps) linearOverlaps[i].push_back(static_cast<uint32_t>(index));
+        }
+    }
+    result.overlapLinearMs = TicksToMs(SDL_GetPerformanceCounter() - start);
+    for (int i = 0; i < OVERLAP_COUNT; ++i)
+    {
+        compareSets(treeOverlaps[i], linearOverlaps[i]);
+    }
+
+    result.matchesBruteForce = matches;
+    return result;
+}
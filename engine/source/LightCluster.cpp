@@ -0,0 +1,400 @@
+﻿#include "LightCluster.hpp"
+#include <gtc/matrix_transform.hpp>
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define LIGHT_CLUSTER_SIMD_SSE 1
+#include <emmintrin.h>
+#else
+#define LIGHT_CLUSTER_SIMD_SSE 0
+#endif
+
+namespace
+{
+    float TicksToMs(Uint64 ticks)
+    {
+        return static_cast<float>(ticks) * 1000.0f / static_cast<float>(SDL_GetPerformanceFrequency());
+    }
+
+    // 구 중심에서 [minValue, maxValue] 구간까지의 거리 (구간 안이면 0)
+    inline float AxisDistance(float center, float minValue, float maxValue)
+    {
+        return std::max(std::max(minValue - center, center - maxValue), 0.0f);
+    }
+}
+
+void LightClusterGrid::SetDimensions(int x, int y, int z, int maxLightsPerCluster_)
+{
+    dimX = std::max(x, 1);
+    dimY = std::max(y, 1);
+    dimZ = std::max(z, 1);
+    maxLightsPerCluster = std::max(maxLightsPerCluster_, 1);
+    boundsDirty = true;
+}
+
+void LightClusterGrid::UpdateFrustum(const glm::mat4& projection, float nearClip, float farClip)
+{
+    float newTanHalfX = 1.0f / projection[0][0];
+    float newTanHalfY = 1.0f / projection[1][1];
+    if (!boundsDirty && newTanHalfX == tanHalfX && newTanHalfY == tanHalfY && nearClip == nearPlane && farClip == farPlane)
+    {
+        return;
+    }
+
+    tanHalfX = newTanHalfX;
+    tanHalfY = newTanHalfY;
+    nearPlane = nearClip;
+    farPlane = farClip;
+    boundsDirty = false;
+
+    // slice = floor(log(depth / near) / log(far / near) * dimZ)
+    float logRatio = std::log(farPlane / nearPlane);
+    sliceScale = static_cast<float>(dimZ) / logRatio;
+    sliceBias = -static_cast<float>(dimZ) * std::log(nearPlane) / logRatio;
+
+    sliceNear.resize(dimZ);
+    sliceFar.resize(dimZ);
+    tileMinX.resize(static_cast<size_t>(dimZ) * dimX);
+    tileMaxX.resize(static_cast<size_t>(dimZ) * dimX);
+    tileMinY.resize(static_cast<size_t>(dimZ) * dimY);
+    tileMaxY.resize(static_cast<size_t>(dimZ) * dimY);
+
+    for (int z = 0; z < dimZ; ++z)
+    {
+        float depthNear = nearPlane * std::pow(farPlane / nearPlane, static_cast<float>(z) / static_cast<float>(dimZ));
+        float depthFar = nearPlane * std::pow(farPlane / nearPlane, static_cast<float>(z + 1) / static_cast<float>(dimZ));
+        sliceNear[z] = depthNear;
+        sliceFar[z] = depthFar;
+
+        // 타일의 네 모서리 광선이 슬라이스 앞/뒤 평면과 만나는 점들의 AABB
+        for (int x = 0; x < dimX; ++x)
+        {
+            float ndc0 = -1.0f + 2.0f * static_cast<float>(x) / static_cast<float>(dimX);
+            float ndc1 = -1.0f + 2.0f * static_cast<float>(x + 1) / static_cast<float>(dimX);
+            float a = ndc0 * depthNear * tanHalfX, b = ndc0 * depthFar * tanHalfX;
+            float c = ndc1 * depthNear * tanHalfX, d = ndc1 * depthFar * tanHalfX;
+            tileMinX[z * dimX + x] = std::min(std::min(a, b), std::min(c, d));
+            tileMaxX[z * dimX + x] = std::max(std::max(a, b), std::max(c, d));
+        }
+        for (int y = 0; y < dimY; ++y)
+        {
+            float ndc0 = -1.0f + 2.0f * static_cast<float>(y) / static_cast<float>(dimY);
+            float ndc1 = -1.0f + 2.0f * static_cast<float>(y + 1) / static_cast<float>(dimY);
+            float a = ndc0 * depthNear * tanHalfY, b = ndc0 * depthFar * tanHalfY;
+            float c = ndc1 * depthNear * tanHalfY, d = ndc1 * depthFar * tanHalfY;
+            tileMinY[z * dimY + y] = std::min(std::min(a, b), std::min(c, d));
+            tileMaxY[z * dimY + y] = std::max(std::max(a, b), std::max(c, d));
+        }
+    }
+}
+
+void LightClusterGrid::CullLights(const glm::mat4& view, const std::vector<glm::vec4>& lightSpheres)
+{
+    lastView = view;
+    viewLights.clear();
+    for (size_t i = 0; i < lightSpheres.size(); ++i)
+    {
+        const glm::vec4& sphere = lightSpheres[i];
+        if (sphere.w <= 0.0f)
+        {
+            continue;
+        }
+        glm::vec4 viewPosition = view * glm::vec4(glm::vec3(sphere), 1.0f);
+
+        ViewLight light;
+        light.center = glm::vec3(viewPosition.x, viewPosition.y, -viewPosition.z);
+        light.radiusSq = sphere.w * sphere.w;
+        light.index = static_cast<uint32_t>(i);
+        viewLights.push_back(light);
+    }
+}
+
+void LightClusterGrid::ResetClusters()
+{
+    size_t clusterCount = static_cast<size_t>(GetClusterCount());
+    clusterCounts.assign(clusterCount, 0);
+    clusterSlots.resize(clusterCount * maxLightsPerCluster);
+    sliceOverflow.assign(dimZ, 0);
+}
+
+void LightClusterGrid::Build(const glm::mat4& view, const glm::mat4& projection, float nearClip, float farClip,
+    const std::vector<glm::vec4>& lightSpheres, const ClusterParallelFor& parallelFor)
+{
+    Uint64 start = SDL_GetPerformanceCounter();
+
+    UpdateFrustum(projection, nearClip, farClip);
+    CullLights(view, lightSpheres);
+    ResetClusters();
+
+    // 슬라이스마다 담당 클러스터가 겹치지 않으므로 잠금 없이 나눠 실행
+    if (parallelFor)
+    {
+        parallelFor(dimZ, [this](int begin, int end) { AssignSlices(begin, end); });
+    }
+    else
+    {
+        AssignSlices(0, dimZ);
+    }
+
+    Compact(TicksToMs(SDL_GetPerformanceCounter() - start));
+}
+
+void LightClusterGrid::BuildReference(const glm::mat4& view, const glm::mat4& projection, float nearClip, float farClip,
+    const std::vector<glm::vec4>& lightSpheres)
+{
+    Uint64 start = SDL_GetPerformanceCounter();
+
+    UpdateFrustum(projection, nearClip, farClip);
+    CullLights(view, lightSpheres);
+    ResetClusters();
+
+    for (const ViewLight& light : viewLights)
+    {
+        for (int z = 0; z < dimZ; ++z)
+        {
+            for (int y = 0; y < dimY; ++y)
+            {
+                for (int x = 0; x < dimX; ++x)
+                {
+                    float dz = AxisDistance(light.center.z, sliceNear[z], sliceFar[z]);
+                    float dy = AxisDistance(light.center.y, tileMinY[z * dimY + y], tileMaxY[z * dimY + y]);
+                    float dx = AxisDistance(light.center.x, tileMinX[z * dimX + x], tileMaxX[z * dimX + x]);
+                    float remainingSq = light.radiusSq - dz * dz;
+                    if (remainingSq < 0.0f) continue;
+                    remainingSq -= dy * dy;
+                    if (remainingSq < 0.0f) continue;
+                    if (dx * dx <= remainingSq)
+                    {
+                        AddToCluster(x + dimX * (y + dimY * z), light.index);
+                    }
+                }
+            }
+        }
+    }
+
+    Compact(TicksToMs(SDL_GetPerformanceCounter() - start));
+}
+
+void LightClusterGrid::AssignSlices(int beginSlice, int endSlice)
+{
+    for (int z = beginSlice; z < endSlice; ++z)
+    {
+        for (const ViewLight& light : viewLights)
+        {
+            // 슬라이스 깊이 범위와 겹치지 않으면 이 슬라이스의 모든 클러스터를 건너뜀
+            float dz = AxisDistance(light.center.z, sliceNear[z], sliceFar[z]);
+            float sliceRemainingSq = light.radiusSq - dz * dz;
+            if (sliceRemainingSq < 0.0f)
+            {
+                continue;
+            }
+
+            for (int y = 0; y < dimY; ++y)
+            {
+                float dy = AxisDistance(light.center.y, tileMinY[z * dimY + y], tileMaxY[z * dimY + y]);
+                float rowRemainingSq = sliceRemainingSq - dy * dy;
+                if (rowRemainingSq < 0.0f)
+                {
+                    continue;
+                }
+
+                if (useSimd)
+                {
+                    AssignRowSimd(light, z, y, rowRemainingSq);
+                }
+                else
+                {
+                    AssignRowScalar(light, z, y, rowRemainingSq);
+                }
+            }
+        }
+    }
+}
+
+void LightClusterGrid::AssignRowScalar(const ViewLight& light, int z, int y, float remainingSq)
+{
+    const float* minX = tileMinX.data() + z * dimX;
+    const float* maxX = tileMaxX.data() + z * dimX;
+    int rowBase = dimX * (y + dimY * z);
+    for (int x = 0; x < dimX; ++x)
+    {
+        float dx = AxisDistance(light.center.x, minX[x], maxX[x]);
+        if (dx * dx <= remainingSq)
+        {
+            AddToCluster(rowBase + x, light.index);
+        }
+    }
+}
+
+void LightClusterGrid::AssignRowSimd(const ViewLight& light, int z, int y, float remainingSq)
+{
+#if LIGHT_CLUSTER_SIMD_SSE
+    const float* minX = tileMinX.data() + z * dimX;
+    const float* maxX = tileMaxX.data() + z * dimX;
+    int rowBase = dimX * (y + dimY * z);
+
+    // 타일 4개를 한 번에 판정 (스칼라와 같은 연산 순서라 결과가 동일함)
+    __m128 centerX = _mm_set1_ps(light.center.x);
+    __m128 remaining = _mm_set1_ps(remainingSq);
+    __m128 zero = _mm_setzero_ps();
+    int x = 0;
+    for (; x + 4 <= dimX; x += 4)
+    {
+        __m128 distance = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(minX + x), centerX), _mm_sub_ps(centerX, _mm_loadu_ps(maxX + x))), zero);
+        int mask = _mm_movemask_ps(_mm_cmple_ps(_mm_mul_ps(distance, distance), remaining));
+        for (int lane = 0; mask != 0; ++lane, mask >>= 1)
+        {
+            if (mask & 1)
+            {
+                AddToCluster(rowBase + x + lane, light.index);
+            }
+        }
+    }
+    for (; x < dimX; ++x)
+    {
+        float dx = AxisDistance(light.center.x, minX[x], maxX[x]);
+        if (dx * dx <= remainingSq)
+        {
+            AddToCluster(rowBase + x, light.index);
+        }
+    }
+#else
+    AssignRowScalar(light, z, y, remainingSq);
+#endif
+}
+
+void LightClusterGrid::AddToCluster(int cluster, uint32_t lightIndex)
+{
+    uint32_t& count = clusterCounts[cluster];
+    if (count < static_cast<uint32_t>(maxLightsPerCluster))
+    {
+        clusterSlots[static_cast<size_t>(cluster) * maxLightsPerCluster + count] = lightIndex;
+        ++count;
+    }
+    else
+    {
+        ++sliceOverflow[cluster / (dimX * dimY)];
+    }
+}
+
+void LightClusterGrid::Compact(float buildMs)
+{
+    int clusterCount = GetClusterCount();
+    clusterRanges.resize(clusterCount);
+
+    uint32_t offset = 0;
+    uint32_t maxCount = 0;
+    for (int cluster = 0; cluster < clusterCount; ++cluster)
+    {
+        uint32_t count = clusterCounts[cluster];
+        clusterRanges[cluster] = glm::uvec2(offset, count);
+        offset += count;
+        maxCount = std::max(maxCount, count);
+    }
+
+    lightIndices.resize(offset);
+    for (int cluster = 0; cluster < clusterCount; ++cluster)
+    {
+        const uint32_t* slots = clusterSlots.data() + static_cast<size_t>(cluster) * maxLightsPerCluster;
+        std::copy(slots, slots + clusterRanges[cluster].y, lightIndices.begin() + clusterRanges[cluster].x);
+    }
+
+    stats.clusteredLights = 0;
+    if (!viewLights.empty())
+    {
+        std::vector<bool> assignedLights(viewLights.back().index + 1, false);
+        for (uint32_t lightIndex : lightIndices)
+        {
+            if (!assignedLights[lightIndex])
+            {
+                assignedLights[lightIndex] = true;
+                ++stats.clusteredLights;
+            }
+        }
+    }
+    stats.assignments = static_cast<int>(offset);
+    stats.maxLightsInCluster = static_cast<int>(maxCount);
+    stats.overflowedAssignments = 0;
+    for (int overflow : sliceOverflow)
+    {
+        stats.overflowedAssignments += overflow;
+    }
+    stats.buildMs = buildMs;
+}
+
+int LightClusterGrid::FindCluster(const glm::vec3& worldPosition) const
+{
+    if (sliceNear.empty())
+    {
+        return -1;
+    }
+
+    glm::vec4 viewPosition = lastView * glm::vec4(worldPosition, 1.0f);
+    float depth = -viewPosition.z;
+    if (depth < nearPlane || depth > farPlane)
+    {
+        return -1;
+    }
+
+    float ndcX = viewPosition.x / (depth * tanHalfX);
+    float ndcY = viewPosition.y / (depth * tanHalfY);
+    if (ndcX < -1.0f || ndcX > 1.0f || ndcY < -1.0f || ndcY > 1.0f)
+    {
+        return -1;
+    }
+
+    int x = std::clamp(static_cast<int>((ndcX * 0.5f + 0.5f) * static_cast<float>(dimX)), 0, dimX - 1);
+    int y = std::clamp(static_cast<int>((ndcY * 0.5f + 0.5f) * static_cast<float>(dimY)), 0, dimY - 1);
+    int z = std::clamp(static_cast<int>(std::floor(std::log(depth) * sliceScale + sliceBias)), 0, dimZ - 1);
+    return x + dimX * (y + dimY * z);
+}
+
+LightClusterBenchmarkResult RunLightClusterBenchmark(int lightCount, const ClusterParallelFor& parallelFor)
+{
+    constexpr int ITERATIONS = 20;
+
+    LightClusterBenchmarkResult result;
+    result.lightCount = lightCount;
+
+    // 카메라 앞쪽 공간에 무작위 점광원 배치 (고정 시드)
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> rangeX(-60.0f, 60.0f);
+    std::uniform_real_distribution<float> rangeY(-30.0f, 30.0f);
+    std::uniform_real_distribution<float> rangeZ(-100.0f, 5.0f);
+    std::uniform_real_distribution<float> rangeRadius(1.0f, 6.0f);
+    std::vector<glm::vec4> lightSpheres(lightCount);
+    for (glm::vec4& sphere : lightSpheres)
+    {
+        sphere = glm::vec4(rangeX(random), rangeY(random), rangeZ(random), rangeRadius(random));
+    }
+
+    glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    glm::mat4 projection = glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, 0.1f, 100.0f);
+
+    LightClusterGrid grid;
+    auto measure = [&](bool simd, const ClusterParallelFor& executor)
+    {
+        grid.SetUseSimd(simd);
+        Uint64 start = SDL_GetPerformanceCounter();
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            grid.Build(view, projection, 0.1f, 100.0f, lightSpheres, executor);
+        }
+        return TicksToMs(SDL_GetPerformanceCounter() - start) / static_cast<float>(ITERATIONS);
+    };
+
+    result.scalarMs = measure(false, {});
+    result.simdMs = measure(true, {});
+    result.parallelMs = measure(true, parallelFor);
+    std::vector<glm::uvec2> ranges = grid.GetClusterRanges();
+    std::vector<uint32_t> indices = grid.GetLightIndices();
+    result.assignments = grid.GetStats().assignments;
+
+    grid.BuildReference(view, projection, 0.1f, 100.0f, lightSpheres);
+    result.referenceMs = grid.GetStats().buildMs;
+    result.matchesReference = ranges == grid.GetClusterRanges() && indices == grid.GetLightIndices();
+    return result;
+}
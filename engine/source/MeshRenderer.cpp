@@ -1,35 +1,64 @@
 #include "MeshRenderer.hpp"
 
 #include "Model.hpp"
-#include "Light.hpp"
 #include "Animator.hpp" 
 
 #include "Engine.hpp"
 #include "Object.hpp"
 #include "RenderManager.hpp"
+#include "ObjectManager.hpp"
 #include "CameraManager.hpp"
 #include "Shader.hpp"
 #include "Texture.hpp"
+#include "RenderQueue.hpp"
+#include "OcclusionCuller.hpp"
 
 #include <glew.h>
 #include <gtc/type_ptr.hpp>
 #include <iostream>
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+    constexpr UniformHandle MODEL_UNIFORM("model");
+    constexpr UniformHandle BONE_PALETTE_BLOCK("BonePalette");
+    constexpr UniformHandle USE_TEXTURE_UNIFORM("useTexture");
+    constexpr UniformHandle TEXTURE_UNIFORM("Texture");
+    constexpr UniformHandle COLOR_UNIFORM("color");
+    constexpr UniformHandle METALLIC_UNIFORM("metallic");
+    constexpr UniformHandle ROUGHNESS_UNIFORM("roughness");
+}
 
 void MeshRenderer::Init()
 {
     Engine::GetInstance().GetRenderManager()->Register(this);
+    InvalidateBounds();
 }
 
 void MeshRenderer::Update(float /*dt*/)
 {
 }
 
+void MeshRenderer::InvalidateBounds()
+{
+    if (ObjectManager* objectManager = Engine::GetInstance().GetObjectManager())
+    {
+        objectManager->MarkBoundsDirty(GetOwner());
+    }
+}
+
 void MeshRenderer::End()
 {
    Engine::GetInstance().GetRenderManager()->Unregister(this);
 }
 
-void MeshRenderer::Render(Camera* camera, Light* light)
+void MeshRenderer::RemoveLodState(uint32_t cameraId)
+{
+    std::erase_if(lodStates, [cameraId](const LodState& state) { return state.cameraId == cameraId; });
+}
+
+void MeshRenderer::CollectDrawItems(RenderQueue& queue, const Camera* camera, const LodSelectionSettings& lodSettings)
 {
     //  ʿ ⺻ Ұ  Լ 
     if ((!model && !mesh) || !shader || !camera)
@@ -37,215 +66,337 @@ void MeshRenderer::Render(Camera* camera, Light* light)
         return;
     }
 
-    // ̾  
-    if (renderMode == RenderMode::Wireframe)
+    // ī޶    (Ŀ)
+    glm::vec3 worldPosition = GetOwner()->transform.GetWorldPosition();
+    float viewDepth = glm::dot(worldPosition - camera->GetCameraPosition(), camera->GetFrontVector());
+    bool transparent = IsTransparent();
+    int lodLevel = SelectLod(camera, lodSettings);
+
+    if (model)
+    {
+        for (const auto& meshInModel : model->GetMeshes())
+        {
+            if (!meshInModel->GetVertexArray()) continue;
+            int meshLod = std::min(lodLevel, meshInModel->GetLodCount() - 1);
+            queue.Add(RenderPass::Main, transparent, viewDepth, this, meshInModel.get(), shader.get(), texture.get(), meshLod);
+        }
+    }
+    else if (mesh && mesh->GetVertexArray())
+    {
+        int meshLod = std::min(lodLevel, mesh->GetLodCount() - 1);
+        queue.Add(RenderPass::Main, transparent, viewDepth, this, mesh.get(), shader.get(), texture.get(), meshLod);
+    }
+}
+
+int MeshRenderer::SelectLod(const Camera* camera, const LodSelectionSettings& settings)
+{
+    if (!settings.enabled)
+    {
+        return 0;
+    }
+    if (settings.forcedLevel >= 0)
+    {
+        return std::min(settings.forcedLevel, Mesh::MAX_LOD_LEVELS - 1);
+    }
+    int lodCount = model ? 1 : (mesh ? mesh->GetLodCount() : 1);
+    if (model)
+    {
+        for (const auto& meshInModel : model->GetMeshes())
+        {
+            lodCount = std::max(lodCount, meshInModel->GetLodCount());
+        }
+    }
+    if (lodCount <= 1)
+    {
+        return 0;
+    }
+
+    //   : Ű ޽ô    ڸ,  ܿ ε    Ű 
+    glm::vec3 center(0.0f);
+    float radius = -1.0f;
+    bool skinned = shader && shader->HasUniformBlock(BONE_PALETTE_BLOCK) && GetOwner()->HasComponent<Animator>();
+    if (skinned)
+    {
+        AABB worldBounds;
+        if (ComputeWorldBounds(worldBounds) && worldBounds.IsValid())
+        {
+            center = worldBounds.GetCenter();
+            radius = glm::length(worldBounds.GetExtents());
+        }
+    }
+    else
     {
-        glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+        const BoundingSphere& localSphere = model ? model->GetBoundingSphere() : mesh->GetBoundingSphere();
+        if (localSphere.IsValid())
+        {
+            BoundingSphere worldSphere = localSphere.Transform(GetOwner()->transform.GetModelMatrix());
+            center = worldSphere.center;
+            radius = worldSphere.radius;
+        }
+    }
+    if (radius < 0.0f)
+    {
+        return 0;
     }
 
-    //  ̴ Ȱȭ
-    shader->Bind();
+    //   [1][1] = 1 / tan(fovY / 2) (), 2 /  ()
+    const glm::mat4& projection = camera->GetProjectionMatrix();
+    float screenSize = radius * projection[1][1];
+    if (projection[2][3] != 0.0f)
+    {
+        float distance = glm::length(center - camera->GetCameraPosition());
+        screenSize = distance > radius ? screenSize / distance : std::numeric_limits<float>::max();
+    }
 
-    //    ( ̴ ʿ)
-    glm::mat4 modelMat = GetOwner()->transform.GetModelMatrix();
-    glm::mat4 viewMat = camera->GetViewMatrix();
-    glm::mat4 projectionMat = camera->GetProjectionMatrix();
-    shader->SetUniformMat4f("model", modelMat);
-    shader->SetUniformMat4f("view", viewMat);
-    shader->SetUniformMat4f("projection", projectionMat);
+    LodState* state = nullptr;
+    for (LodState& candidate : lodStates)
+    {
+        if (candidate.cameraId == camera->GetId())
+        {
+            state = &candidate;
+            break;
+        }
+    }
+    if (!state)
+    {
+        state = &lodStates.emplace_back();
+        state->cameraId = camera->GetId();
+    }
 
-    // ̴ IBL   ִٸ  ȣ 
-    if (shader->HasUniform("irradianceMap")) 
+    int level = std::min(state->level, lodCount - 1);
+    while (level < lodCount - 1 && screenSize < settings.screenThresholds[level] * (1.0f - settings.hysteresis))
     {
-        shader->SetUniform1i("irradianceMap", static_cast<int>(TextureSlot::IBL_IRRADIANCE));
+        ++level;
     }
-    if (shader->HasUniform("prefilterMap")) 
+    while (level > 0 && screenSize > settings.screenThresholds[level - 1] * (1.0f + settings.hysteresis))
     {
-        shader->SetUniform1i("prefilterMap", static_cast<int>(TextureSlot::IBL_PREFILTER));
+        --level;
     }
-    if (shader->HasUniform("brdfLUT")) 
+    state->level = level;
+    return level;
+}
+
+void MeshRenderer::ApplyDrawUniforms(Shader* activeShader) const
+{
+    // ̴/ؽó RenderManager ٲ , ī޶//  ۷ ϹǷ ⼭ ο츶 ٸ  
+    // ġ ̴ ٲ 쿡 ڵ ã,  ܿ   ġ ٷ  (ڿ ȸ )
+    if (uniformLocations.shaderSerial != activeShader->GetSerial())
     {
-        shader->SetUniform1i("brdfLUT", static_cast<int>(TextureSlot::IBL_BRDF_LUT));
+        uniformLocations.shaderSerial = activeShader->GetSerial();
+        uniformLocations.model = activeShader->GetUniformLocation(MODEL_UNIFORM);
+        uniformLocations.bonePaletteSize = activeShader->GetUniformBlockSize(BONE_PALETTE_BLOCK);
+        uniformLocations.useTexture = activeShader->GetUniformLocation(USE_TEXTURE_UNIFORM);
+        uniformLocations.texture = activeShader->GetUniformLocation(TEXTURE_UNIFORM);
+        uniformLocations.color = activeShader->GetUniformLocation(COLOR_UNIFORM);
+        uniformLocations.metallic = activeShader->GetUniformLocation(METALLIC_UNIFORM);
+        uniformLocations.roughness = activeShader->GetUniformLocation(ROUGHNESS_UNIFORM);
     }
+    const UniformLocations& locations = uniformLocations;
+
+    activeShader->SetUniformMat4f(locations.model, GetOwner()->transform.GetModelMatrix());
 
     // ִϸ̼  
-    // ̴ finalBonesMatrices ϰ,  Ʈ Animator   
-    if (shader->HasUniform("finalBonesMatrices") && GetOwner()->HasComponent<Animator>())
+    // ̴ BonePalette  ϰ,  Ʈ Animator    ( ۿ ϰ  ε )
+    Animator* animator = locations.bonePaletteSize > 0 ? GetOwner()->GetComponent<Animator>() : nullptr;
+    if (animator)
     {
-        auto animator = GetOwner()->GetComponent<Animator>();
         const auto& transforms = animator->GetFinalBoneMatrices();
-        shader->SetUniformMat4fv("finalBonesMatrices", static_cast<int>(transforms.size()), transforms[0]);
+        Engine::GetInstance().GetRenderManager()->BindBonePalette(transforms.data(), transforms.size(), static_cast<size_t>(locations.bonePaletteSize));
     }
 
-    // ؽó    
-    // ̴ useTexture    
-    if (shader->HasUniform("useTexture"))
+    // ؽó   (ؽó ε ü RenderManager ó)
+    if (locations.useTexture != -1)
     {
-        if (texture) 
+        if (texture)
         {
-            shader->SetUniform1i("useTexture", 1);
-            texture->Bind(0);
-            shader->SetUniform1i("Texture", 0);
+            activeShader->SetUniform1i(locations.useTexture, 1);
+            activeShader->SetUniform1i(locations.texture, 0);
         }
-        else 
+        else
         {
-            shader->SetUniform1i("useTexture", 0);
+            activeShader->SetUniform1i(locations.useTexture, 0);
         }
     }
 
     // ̴ color    
-    if (shader->HasUniform("color")) 
+    if (locations.color != -1)
     {
-        shader->SetUniformVec4("color", color);
+        activeShader->SetUniformVec4(locations.color, color);
     }
 
     // PBR 
-    if (shader->HasUniform("metallic")) 
+    if (locations.metallic != -1)
     {
-        shader->SetUniform1f("metallic", metallic);
+        activeShader->SetUniform1f(locations.metallic, metallic);
     }
-    if (shader->HasUniform("roughness")) 
+    if (locations.roughness != -1)
     {
-        shader->SetUniform1f("roughness", roughness);
+        activeShader->SetUniform1f(locations.roughness, roughness);
     }
-    if (shader->HasUniform("exposure")) 
+}
+
+bool MeshRenderer::CanInstance() const
+{
+    return !GetOwner()->HasComponent<Animator>();
+}
+
+void MeshRenderer::FillInstanceData(InstanceData& instance) const
+{
+    instance.model = GetOwner()->transform.GetModelMatrix();
+    instance.color = color;
+    instance.material = glm::vec4(metallic, roughness, 0.0f, 0.0f);
+}
+
+bool MeshRenderer::ComputeWorldBounds(AABB& worldBounds) const
+{
+    worldBounds = AABB();
+    if (!model && !mesh)
     {
-        shader->SetUniform1f("exposure", exposure);
+        return false;
     }
 
-    //   
-    //  ϰ, ̴ lightPos    
-    if (light && shader->HasUniform("lightPos"))
-    {
-        Object* lightObject = light->GetOwner();
-        bool isPoint = (light->GetType() == LightType::Point);
+    const glm::mat4& modelMatrix = GetOwner()->transform.GetModelMatrix();
+    // ̴     Ű׵ǹǷ ׶   踦 
+    bool shaderSkins = shader && shader->HasUniformBlock(BONE_PALETTE_BLOCK);
+    Animator* animator = shaderSkins ? GetOwner()->GetComponent<Animator>() : nullptr;
 
-        if (isPoint)
+    auto expandMesh = [&](const Mesh& target)
+    {
+        if (!shaderSkins || !target.HasSkinnedVertices())
         {
-            shader->SetUniformVec3("lightPos", lightObject->transform.GetPosition() + light->GetOffsetForPointL());
+            worldBounds.Expand(target.GetBounds().Transform(modelMatrix));
+            return true;
         }
-        else
+        if (!animator)
         {
-            shader->SetUniformVec3("lightPos", light->GetDirection());
+            return false;
         }
-        shader->SetUniform1i("isPointLight", isPoint);
-
-        shader->SetUniformVec3("lightColor", light->GetColor());
-        shader->SetUniformVec3("viewPos", camera->GetCameraPosition());
-        shader->SetUniform1f("ambientStrength", light->GetAmbientIntensity());
-        shader->SetUniform1f("diffuseStrength", light->GetDiffuseIntensity());
-        shader->SetUniform1f("specularStrength", light->GetSpecularIntensity());
-        shader->SetUniform1i("shininess", light->GetShininess());
-    }
-    else //   ⺻ 
-    {
-        shader->SetUniformVec3("lightPos", { 0,0,0 });
-        shader->SetUniformVec3("lightColor", { 0,0,0 });
-    }
+        AABB skinnedBounds;
+        if (!target.ComputeSkinnedBounds(animator->GetFinalBoneMatrices(), skinnedBounds))
+        {
+            return false;
+        }
+        worldBounds.Expand(skinnedBounds);
+        worldBounds.Expand(target.GetUnskinnedBounds().Transform(modelMatrix));
+        return true;
+    };
 
     if (model)
     {
         for (const auto& meshInModel : model->GetMeshes())
         {
-            VertexArray* va = meshInModel->GetVertexArray();
-            if (!va) continue;
-            va->Bind();
-            glDrawElements(static_cast<GLenum>(meshInModel->GetPrimitivePattern()), meshInModel->GetIndicesCount(), GL_UNSIGNED_INT, 0);
-            va->UnBind();
+            if (!expandMesh(*meshInModel))
+            {
+                return false;
+            }
         }
+        return true;
     }
-    else if (mesh)
+    return expandMesh(*mesh);
+}
+
+void MeshRenderer::SubmitOccluder(OcclusionCuller& culler) const
+{
+    if (renderMode == RenderMode::Wireframe || IsTransparent())
     {
-        VertexArray* va = mesh->GetVertexArray();
-        if (va)
+        return;
+    }
+
+    const glm::mat4& modelMatrix = GetOwner()->transform.GetModelMatrix();
+    bool shaderSkins = shader && shader->HasUniformBlock(BONE_PALETTE_BLOCK);
+    auto submitMesh = [&](const Mesh& target)
+    {
+        const std::vector<Vertex>& vertices = target.GetVertices();
+        const std::vector<unsigned int>& indices = target.GetIndices();
+        if (target.GetPrimitivePattern() != PrimitivePattern::Triangles || (shaderSkins && target.HasSkinnedVertices())
+            || vertices.empty() || indices.empty())
         {
-            va->Bind();
-            glDrawElements(static_cast<GLenum>(mesh->GetPrimitivePattern()), mesh->GetIndicesCount(), GL_UNSIGNED_INT, 0);
-            va->UnBind();
+            return;
         }
-    }
+        culler.AddOccluder(modelMatrix, &vertices[0].position.x, sizeof(Vertex), vertices.size(), indices.data(), indices.size());
+    };
 
-    //  
-    if (renderMode == RenderMode::Wireframe)
+    if (model)
     {
-        glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+        for (const auto& meshInModel : model->GetMeshes())
+        {
+            submitMesh(*meshInModel);
+        }
     }
-    if (texture)
+    else if (mesh)
     {
-        texture->Unbind();
+        submitMesh(*mesh);
     }
 }
 
-void MeshRenderer::CreatePlane()
+void MeshRenderer::UploadMesh(Mesh& target)
+{
+    // Ű  η  (Ʈ ) Ƿ 踦      Ǯ ø
+    target.ComputeBounds();
+    target.UploadToGPU(Engine::GetInstance().GetRenderManager()->GetGeometryPool(target.GetVertexFormat(), target.GetIndexType()));
+}
+
+void MeshRenderer::SetProceduralMesh(ProceduralShape shape, int param0, int param1)
 {
     model = nullptr;
-    mesh = std::make_unique<Mesh>();
-    mesh->CreatePlane();
-    mesh->UploadToGPU();
+    mesh = Engine::GetInstance().GetRenderManager()->GetProceduralMesh(shape, param0, param1);
+    InvalidateBounds();
+}
+
+void MeshRenderer::CreatePlane()
+{
+    SetProceduralMesh(ProceduralShape::Plane);
 }
 
 void MeshRenderer::CreateCube()
 {
-    model = nullptr;
-    mesh = std::make_unique<Mesh>();
-    mesh->CreateCube();
-    mesh->UploadToGPU();
+    SetProceduralMesh(ProceduralShape::Cube);
 }
 
 void MeshRenderer::CreateSphere()
 {
-    model = nullptr;
-    mesh = std::make_unique<Mesh>();
-    mesh->CreateSphere();
-    mesh->UploadToGPU();
+    SetProceduralMesh(ProceduralShape::Sphere, Mesh::DEFAULT_SPHERE_STACKS, Mesh::DEFAULT_SPHERE_SLICES);
 }
 
 void MeshRenderer::CreateDiamond()
 {
-    model = nullptr;
-    mesh = std::make_unique<Mesh>();
-    mesh->CreateDiamond();
-    mesh->UploadToGPU();
+    SetProceduralMesh(ProceduralShape::Diamond);
 }
 
 void MeshRenderer::CreateCylinder()
 {
-    model = nullptr;
-    mesh = std::make_unique<Mesh>();
-    mesh->CreateCylinder();
-    mesh->UploadToGPU();
+    SetProceduralMesh(ProceduralShape::Cylinder, Mesh::DEFAULT_CYLINDER_SEGMENTS);
 }
 
 void MeshRenderer::CreateCapsule()
 {
-    model = nullptr;
-    mesh = std::make_unique<Mesh>();
-    mesh->CreateCapsule();
-    mesh->UploadToGPU();
+    SetProceduralMesh(ProceduralShape::Capsule);
 }
 
 void MeshRenderer::CreateFromData(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, PrimitivePattern pattern)
 {
     model = nullptr;
-    mesh = std::make_unique<Mesh>(vertices, indices, pattern);
-    mesh->UploadToGPU();
+    auto newMesh = std::make_shared<Mesh>(vertices, indices, pattern);
+    UploadMesh(*newMesh);
+    mesh = std::move(newMesh);
+    InvalidateBounds();
 }
 
 void MeshRenderer::RebuildMesh()
 {
-    //  ޽    
-    model = nullptr; //  ε  
-    mesh = std::make_unique<Mesh>(); //  ޽ 
-
+    // ʿ   ĳÿ ް,   ٸ    
     switch (currentShape)
     {
-    case MeshShape::Cube:     mesh->CreateCube(); break;
-    case MeshShape::Sphere:   mesh->CreateSphere(stacks, slices); break; // Ķ 
-    case MeshShape::Cylinder: mesh->CreateCylinder(slices); break;       // Ķ 
-    case MeshShape::Plane:    mesh->CreatePlane(); break;
+    case MeshShape::Cube:     SetProceduralMesh(ProceduralShape::Cube); break;
+    case MeshShape::Sphere:   SetProceduralMesh(ProceduralShape::Sphere, stacks, slices); break; // Ķ 
+    case MeshShape::Cylinder: SetProceduralMesh(ProceduralShape::Cylinder, slices); break;       // Ķ 
+    case MeshShape::Plane:    SetProceduralMesh(ProceduralShape::Plane); break;
+    case MeshShape::None:
+        model = nullptr;
+        mesh = nullptr;
+        InvalidateBounds();
+        break;
     }
-
-    mesh->UploadToGPU();
 }
 
 void MeshRenderer::LoadModel(const std::string& path, const std::string& customRootBoneName)
@@ -253,8 +404,9 @@ void MeshRenderer::LoadModel(const std::string& path, const std::string& customR
     mesh = nullptr;
     model = std::make_shared<Model>(path);
     for (const auto& meshInModel : model->GetMeshes()) {
-        meshInModel->UploadToGPU();
+        UploadMesh(*meshInModel);
     }
+    InvalidateBounds();
 
     Animator* animator = GetOwner()->GetComponent<Animator>();
     if (animator)
@@ -266,11 +418,13 @@ void MeshRenderer::LoadModel(const std::string& path, const std::string& customR
 void MeshRenderer::SetShader(const std::string& name)
 {
     shader = Engine::GetInstance().GetRenderManager()->GetShader(name);
+    InvalidateBounds(); // Ű ΰ ̴  ޶
 }
 
 void MeshRenderer::SetShader(std::shared_ptr<Shader> shader_)
 {
     shader = shader_;
+    InvalidateBounds();
 }
 
 void MeshRenderer::SetTexture(const std::string& name)
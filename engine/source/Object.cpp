@@ -1,17 +1,99 @@
 #include "Object.hpp"
+#include "ObjectManager.hpp"
+#include <algorithm>
 
 Object::~Object()
 {
-    for (const auto& component : components)
+    EndComponents();
+    if (storage)
+    {
+        storage->Detach(this);
+    }
+    for (Component* component : components)
+    {
+        ComponentStorage::Destroy(component);
+    }
+    components.clear();
+    componentSlots.fill(nullptr);
+}
+
+void Object::EndComponents()
+{
+    if (componentsEnded)
+    {
+        return;
+    }
+    componentsEnded = true;
+    for (Component* component : components)
     {
         component->End();
     }
 }
 
-void Object::Update(float dt)
+void Object::SetName(const std::string& newName)
 {
-	for (auto& comp : components)
-	{
-		comp->Update(dt);
-	}
+    if (name == newName)
+    {
+        return;
+    }
+    if (manager)
+    {
+        manager->RemoveFromNameIndex(this);
+    }
+    name = newName;
+    nameHash = HashString(name);
+    if (manager)
+    {
+        manager->AddToNameIndex(this);
+    }
+}
+
+void Object::AddTag(std::string_view tag)
+{
+    uint64_t tagHash = HashString(tag);
+    if (std::find(tags.begin(), tags.end(), tagHash) != tags.end())
+    {
+        return;
+    }
+    tags.push_back(tagHash);
+    if (manager)
+    {
+        manager->AddToTagIndex(this, tagHash);
+    }
+}
+
+void Object::RemoveTag(std::string_view tag)
+{
+    uint64_t tagHash = HashString(tag);
+    auto it = std::find(tags.begin(), tags.end(), tagHash);
+    if (it == tags.end())
+    {
+        return;
+    }
+    tags.erase(it);
+    if (manager)
+    {
+        manager->RemoveFromTagIndex(this, tagHash);
+    }
+}
+
+bool Object::HasTag(std::string_view tag) const
+{
+    return std::find(tags.begin(), tags.end(), HashString(tag)) != tags.end();
+}
+
+void Object::SetSignature(ComponentSignature newSignature)
+{
+    if (signature == newSignature)
+    {
+        return;
+    }
+    if (storage)
+    {
+        storage->ChangeSignature(this, newSignature);
+    }
+    else
+    {
+        signature = newSignature;
+    }
 }
@@ -4,6 +4,7 @@
 #include "Shader.hpp" 
 #include "Engine.hpp"
 #include "RenderManager.hpp"
+#include "ThreadManager.hpp"
 #include "Camera.hpp"
 #include "Transform.hpp"
 #include "MeshRenderer.hpp"
@@ -12,6 +13,8 @@
 #include "Animator.hpp"
 #include "Animation.hpp"
 #include "AnimationStateMachine.hpp"
+#include "InputManager.hpp"
+#include "CameraManager.hpp"
 
 #include <assimp/scene.h> 
 #include "imgui.h"
@@ -47,77 +50,611 @@ void ObjectManager::Init()
 	boneMesh->UploadToGPU();
 }
 
-Object* ObjectManager::FindObject(int id)
+ObjectHandle ObjectManager::AllocateHandle(Object* object)
 {
-	Object* obj = objects.at(id).get();
-	if (obj == nullptr)
+	ObjectHandle handle;
+	if (!freeSlots.empty())
+	{
+		handle.index = freeSlots.back();
+		freeSlots.pop_back();
+	}
+	else
+	{
+		handle.index = static_cast<uint32_t>(slots.size());
+		slots.emplace_back();
+	}
+
+	ObjectSlot& slot = slots[handle.index];
+	slot.object = object;
+	handle.generation = slot.generation;
+	object->handle = handle;
+	return handle;
+}
+
+void ObjectManager::ReleaseHandle(Object* object)
+{
+	ObjectHandle handle = object->handle;
+	if (FindObject(handle) != object)
+	{
+		return;
+	}
+
+	// generation을 올려 기존 핸들을 모두 무효화한 뒤 슬롯 반환
+	ObjectSlot& slot = slots[handle.index];
+	slot.object = nullptr;
+	++slot.generation;
+	freeSlots.push_back(handle.index);
+	object->handle = ObjectHandle{};
+}
+
+void ObjectManager::UnregisterObject(Object* object)
+{
+	RemoveFromNameIndex(object);
+	for (uint64_t tagHash : object->tags)
+	{
+		RemoveFromTagIndex(object, tagHash);
+	}
+	if (FindObject(object->handle) == object)
+	{
+		RemoveFromSpatialIndex(object->handle.index);
+	}
+	ReleaseHandle(object);
+	object->manager = nullptr;
+}
+
+Object* ObjectManager::FindObjectByName(std::string_view name) const
+{
+	const NameEntry* entry = FindNameEntry(name, HashString(name));
+	if (entry == nullptr || entry->objects.empty())
 	{
 		return nullptr;
 	}
-	return obj;
+	return entry->objects.front();
+}
 
+void ObjectManager::FindObjectsByName(std::string_view name, std::vector<Object*>& outObjects) const
+{
+	const NameEntry* entry = FindNameEntry(name, HashString(name));
+	if (entry)
+	{
+		outObjects.insert(outObjects.end(), entry->objects.begin(), entry->objects.end());
+	}
 }
 
-Object* ObjectManager::FindObjectByName(const std::string& name)
+void ObjectManager::FindObjectsByPrefix(std::string_view prefix, std::vector<Object*>& outObjects) const
 {
-	for (const auto& objectPtr : objects)
+	// 정렬된 이름 목록에서 접두사 범위만 순회
+	for (auto it = sortedNames.lower_bound(prefix); it != sortedNames.end(); ++it)
 	{
-		if (objectPtr->GetName() == name)
+		if (it->first.compare(0, prefix.size(), prefix) != 0)
 		{
-			return objectPtr.get();
+			break;
 		}
+		const std::vector<Object*>& bucket = nameIndex.at(it->second).objects;
+		outObjects.insert(outObjects.end(), bucket.begin(), bucket.end());
+	}
+}
+
+const std::vector<Object*>& ObjectManager::FindObjectsByTag(std::string_view tag) const
+{
+	static const std::vector<Object*> empty;
+	auto it = tagIndex.find(HashString(tag));
+	return it != tagIndex.end() ? it->second : empty;
+}
+
+const ObjectManager::NameEntry* ObjectManager::FindNameEntry(std::string_view name, uint64_t hash) const
+{
+	for (uint64_t key = hash;; ++key)
+	{
+		auto it = nameIndex.find(key);
+		if (it == nameIndex.end())
+		{
+			return nullptr;
+		}
+		if (it->second.name == name)
+		{
+			return &it->second;
+		}
+	}
+}
+
+void ObjectManager::AddToNameIndex(Object* object)
+{
+	if (object->name.empty())
+	{
+		return;
+	}
+
+	uint64_t key = object->nameHash;
+	while (true)
+	{
+		auto it = nameIndex.find(key);
+		if (it == nameIndex.end())
+		{
+			NameEntry& entry = nameIndex[key];
+			entry.name = object->name;
+			entry.objects.push_back(object);
+			sortedNames.emplace(object->name, key);
+			return;
+		}
+		if (it->second.name == object->name)
+		{
+			if (it->second.objects.empty())
+			{
+				--nameTombstones;
+			}
+			it->second.objects.push_back(object);
+			return;
+		}
+		++key;
+	}
+}
+
+void ObjectManager::RemoveFromNameIndex(Object* object)
+{
+	if (object->name.empty())
+	{
+		return;
+	}
+
+	auto sorted = sortedNames.find(object->name);
+	if (sorted == sortedNames.end())
+	{
+		return;
+	}
+	NameEntry& entry = nameIndex.at(sorted->second);
+	auto it = std::find(entry.objects.begin(), entry.objects.end(), object);
+	if (it == entry.objects.end())
+	{
+		return;
+	}
+	// 등록 순서를 유지해야 FindObjectByName 결과가 다른 오브젝트의 삭제에 따라 바뀌지 않음
+	entry.objects.erase(it);
+	if (!entry.objects.empty())
+	{
+		return;
+	}
+
+	uint64_t key = sorted->second;
+	if (nameIndex.find(key + 1) != nameIndex.end())
+	{
+		// 뒤에 체인이 이어지므로 빈 항목으로 남김
+		++nameTombstones;
+		if (nameTombstones > 16 && nameTombstones * 2 > nameIndex.size())
+		{
+			RebuildNameIndex();
+		}
+		return;
+	}
+
+	// 체인의 끝이면 제거하고, 그 앞의 빈 항목도 이제 체인의 끝이므로 함께 제거
+	nameIndex.erase(key);
+	sortedNames.erase(sorted);
+	for (auto previous = nameIndex.find(key - 1); previous != nameIndex.end() && previous->second.objects.empty();
+		previous = nameIndex.find(--key - 1))
+	{
+		sortedNames.erase(previous->second.name);
+		nameIndex.erase(previous);
+		--nameTombstones;
+	}
+}
+
+void ObjectManager::RebuildNameIndex()
+{
+	std::vector<NameEntry> entries;
+	entries.reserve(nameIndex.size() - nameTombstones);
+	for (auto& [key, entry] : nameIndex)
+	{
+		if (!entry.objects.empty())
+		{
+			entries.push_back(std::move(entry));
+		}
+	}
+	nameIndex.clear();
+	sortedNames.clear();
+	nameTombstones = 0;
+
+	for (NameEntry& entry : entries)
+	{
+		uint64_t key = entry.objects.front()->nameHash;
+		while (nameIndex.find(key) != nameIndex.end())
+		{
+			++key;
+		}
+		sortedNames.emplace(entry.name, key);
+		nameIndex.emplace(key, std::move(entry));
+	}
+}
+
+void ObjectManager::AddToTagIndex(Object* object, uint64_t tagHash)
+{
+	tagIndex[tagHash].push_back(object);
+}
+
+void ObjectManager::RemoveFromTagIndex(Object* object, uint64_t tagHash)
+{
+	auto it = tagIndex.find(tagHash);
+	if (it == tagIndex.end())
+	{
+		return;
+	}
+	std::vector<Object*>& bucket = it->second;
+	auto found = std::find(bucket.begin(), bucket.end(), object);
+	if (found != bucket.end())
+	{
+		*found = bucket.back();
+		bucket.pop_back();
+	}
+	if (bucket.empty())
+	{
+		tagIndex.erase(it);
 	}
-	return nullptr;
 }
 
 void ObjectManager::DestroyObject(Object* object)
 {
-	if (object == nullptr)
+	// 이미 삭제 예약된 오브젝트는 다시 넣지 않음
+	if (object == nullptr || object->pendingDestroy || object->manager != this)
 	{
 		return;
 	}
+	object->pendingDestroy = true;
 	removalQueue.push_back(object);
 }
 
 void ObjectManager::Update(float dt)
 {
-	for (auto& object : objects)
+	// 오브젝트 단위가 아닌 컴포넌트 타입 단위로 밀집 배열을 순회
+	componentStorage.UpdateAll(dt, Engine::GetInstance().GetThreadManager());
+	UpdateTransforms();
+	UpdateSpatialIndex();
+}
+
+void ObjectManager::UpdateTransforms()
+{
+	if (transformOrderDirty || transformHierarchyVersion != Transform::GetHierarchyVersion())
+	{
+		RebuildTransformOrder();
+	}
+
+	currentFrameStats.updatedTransforms = Transform::UpdateWorldMatrices(sortedTransforms, transformScratch);
+	// 월드 행렬이 바뀐 오브젝트만 공간 인덱스에서 다시 계산
+	for (uint32_t index : transformScratch.changedIndices)
+	{
+		QueueSpatialRefresh(sortedTransformSlots[index]);
+	}
+}
+
+void ObjectManager::RebuildTransformOrder()
+{
+	std::vector<std::pair<int, Object*>> depthOrder;
+	depthOrder.reserve(objects.size());
+	for (const auto& object : objects)
+	{
+		depthOrder.emplace_back(object->transform.GetDepth(), object.get());
+	}
+	std::stable_sort(depthOrder.begin(), depthOrder.end(),
+		[](const auto& a, const auto& b) { return a.first < b.first; });
+
+	sortedTransforms.clear();
+	sortedTransformSlots.clear();
+	for (const auto& pair : depthOrder)
+	{
+		sortedTransforms.push_back(&pair.second->transform);
+		sortedTransformSlots.push_back(pair.second->GetHandle().index);
+	}
+	transformOrderDirty = false;
+	transformHierarchyVersion = Transform::GetHierarchyVersion();
+}
+
+void ObjectManager::MarkBoundsDirty(const Object* object)
+{
+	if (object && object->manager == this && FindObject(object->GetHandle()) == object)
+	{
+		QueueSpatialRefresh(object->GetHandle().index);
+	}
+}
+
+void ObjectManager::QueueSpatialRefresh(uint32_t slotIndex)
+{
+	if (slotIndex >= spatialEntries.size())
+	{
+		spatialEntries.resize(std::max<size_t>(slots.size(), slotIndex + 1));
+	}
+	SpatialEntry& entry = spatialEntries[slotIndex];
+	if (!entry.queued)
+	{
+		entry.queued = true;
+		spatialDirtySlots.push_back(slotIndex);
+	}
+}
+
+void ObjectManager::UpdateSpatialIndex()
+{
+	Uint64 startTicks = SDL_GetPerformanceCounter();
+	spatialEntries.resize(slots.size());
+
+	// 스키닝 메시는 자세가 계속 바뀌므로 Animator가 있는 오브젝트는 매 프레임 다시 계산
+	if (const ComponentPool<Animator>* animators = componentStorage.GetPool<Animator>())
+	{
+		for (const Animator* animator : animators->GetComponents())
+		{
+			if (animator->GetOwner())
+			{
+				QueueSpatialRefresh(animator->GetOwner()->GetHandle().index);
+			}
+		}
+	}
+
+	for (uint32_t slotIndex : spatialDirtySlots)
+	{
+		SpatialEntry& entry = spatialEntries[slotIndex];
+		entry.queued = false;
+		// 예약 후 삭제된 오브젝트는 UnregisterObject에서 이미 인덱스에서 빠짐
+		Object* object = slots[slotIndex].object;
+		if (!object)
+		{
+			continue;
+		}
+		MeshRenderer* renderer = object->GetComponent<MeshRenderer>();
+		if (!renderer)
+		{
+			RemoveFromSpatialIndex(slotIndex);
+			continue;
+		}
+		++currentFrameStats.refreshedBounds;
+
+		AABB bounds;
+		bool bounded = renderer->ComputeWorldBounds(bounds) && bounds.IsValid();
+		bool indexed = entry.proxy != DynamicAABBTree::NULL_NODE || entry.unboundedIndex != -1;
+		bool wasBounded = entry.proxy != DynamicAABBTree::NULL_NODE;
+		if (indexed && bounded != wasBounded)
+		{
+			RemoveFromSpatialIndex(slotIndex);
+		}
+
+		if (!bounded)
+		{
+			if (entry.unboundedIndex == -1)
+			{
+				entry.unboundedIndex = static_cast<int>(unboundedSlots.size());
+				unboundedSlots.push_back(slotIndex);
+			}
+			continue;
+		}
+
+		entry.bounds = bounds;
+		if (entry.proxy == DynamicAABBTree::NULL_NODE)
+		{
+			entry.proxy = spatialTree.CreateProxy(bounds, slotIndex);
+		}
+		else if (spatialTree.MoveProxy(entry.proxy, bounds))
+		{
+			++currentFrameStats.reinsertedProxies;
+		}
+	}
+	spatialDirtySlots.clear();
+
+	Uint64 endTicks = SDL_GetPerformanceCounter();
+	currentFrameStats.spatialUpdateMs = static_cast<float>(endTicks - startTicks) * 1000.0f / static_cast<float>(SDL_GetPerformanceFrequency());
+}
+
+void ObjectManager::RemoveFromSpatialIndex(uint32_t slotIndex)
+{
+	if (slotIndex >= spatialEntries.size())
+	{
+		return;
+	}
+
+	SpatialEntry& entry = spatialEntries[slotIndex];
+	if (entry.proxy != DynamicAABBTree::NULL_NODE)
+	{
+		spatialTree.DestroyProxy(entry.proxy);
+	}
+	if (entry.unboundedIndex != -1)
+	{
+		// swap-and-pop 후 옮겨진 항목의 위치를 갱신
+		uint32_t movedSlot = unboundedSlots.back();
+		unboundedSlots[entry.unboundedIndex] = movedSlot;
+		spatialEntries[movedSlot].unboundedIndex = entry.unboundedIndex;
+		unboundedSlots.pop_back();
+	}
+	// spatialDirtySlots에 남아 있는 슬롯이 중복으로 들어가지 않도록 예약 상태는 유지
+	bool queued = entry.queued;
+	entry = SpatialEntry{};
+	entry.queued = queued;
+}
+
+void ObjectManager::QueryFrustum(const Frustum& frustum, std::vector<Object*>& outObjects) const
+{
+	spatialTree.QueryFrustum(frustum, [&](uint32_t slotIndex)
 	{
-		object->Update(dt);
+		if (frustum.TestAABB(spatialEntries[slotIndex].bounds))
+		{
+			outObjects.push_back(slots[slotIndex].object);
+		}
+	});
+	for (uint32_t slotIndex : unboundedSlots)
+	{
+		outObjects.push_back(slots[slotIndex].object);
+	}
+}
+
+void ObjectManager::QueryOverlap(const AABB& bounds, std::vector<Object*>& outObjects) const
+{
+	spatialTree.QueryAABB(bounds, [&](uint32_t slotIndex)
+	{
+		if (spatialEntries[slotIndex].bounds.Overlaps(bounds))
+		{
+			outObjects.push_back(slots[slotIndex].object);
+		}
+	});
+}
+
+void ObjectManager::QuerySphere(const glm::vec3& center, float radius, std::vector<Object*>& outObjects) const
+{
+	spatialTree.QuerySphere(center, radius, [&](uint32_t slotIndex)
+	{
+		if (spatialEntries[slotIndex].bounds.OverlapsSphere(center, radius))
+		{
+			outObjects.push_back(slots[slotIndex].object);
+		}
+	});
+}
+
+Object* ObjectManager::RayCast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, float* hitDistance) const
+{
+	Object* nearestObject = nullptr;
+	float nearestDistance = maxDistance;
+	glm::vec3 inverseDirection = 1.0f / direction;
+	spatialTree.RayCast(origin, direction, maxDistance, [&](uint32_t slotIndex, float currentMax)
+	{
+		float distance;
+		if (spatialEntries[slotIndex].bounds.IntersectRay(origin, inverseDirection, currentMax, distance) && distance < currentMax)
+		{
+			nearestObject = slots[slotIndex].object;
+			nearestDistance = distance;
+			return distance;
+		}
+		return currentMax;
+	});
+	if (nearestObject && hitDistance)
+	{
+		*hitDistance = nearestDistance;
+	}
+	return nearestObject;
+}
+
+Object* ObjectManager::PickObject(const Camera* camera, const glm::vec2& screenPosition) const
+{
+	if (!camera)
+	{
+		return nullptr;
+	}
+
+	// 창 좌표(왼쪽 위 원점) -> 카메라 뷰포트 기준 NDC (OpenGL 뷰포트는 왼쪽 아래 원점)
+	float windowWidth = static_cast<float>(Engine::GetInstance().GetWindowWidth());
+	float windowHeight = static_cast<float>(Engine::GetInstance().GetWindowHeight());
+	glm::vec4 viewport = camera->GetRelativeViewport();
+	float viewportX = viewport.x * windowWidth;
+	float viewportY = viewport.y * windowHeight;
+	float viewportWidth = viewport.z * windowWidth;
+	float viewportHeight = viewport.w * windowHeight;
+	if (viewportWidth <= 0.0f || viewportHeight <= 0.0f)
+	{
+		return nullptr;
+	}
+	float ndcX = (screenPosition.x - viewportX) / viewportWidth * 2.0f - 1.0f;
+	float ndcY = ((windowHeight - screenPosition.y) - viewportY) / viewportHeight * 2.0f - 1.0f;
+	if (ndcX < -1.0f || ndcX > 1.0f || ndcY < -1.0f || ndcY > 1.0f)
+	{
+		return nullptr;
+	}
+
+	// 가까운 면과 먼 면의 점을 월드로 되돌려 광선을 만듦
+	glm::mat4 inverseViewProjection = glm::inverse(camera->GetProjectionMatrix() * camera->GetViewMatrix());
+	glm::vec4 nearPoint = inverseViewProjection * glm::vec4(ndcX, ndcY, -1.0f, 1.0f);
+	glm::vec4 farPoint = inverseViewProjection * glm::vec4(ndcX, ndcY, 1.0f, 1.0f);
+	glm::vec3 origin = glm::vec3(nearPoint) / nearPoint.w;
+	glm::vec3 end = glm::vec3(farPoint) / farPoint.w;
+	float length = glm::length(end - origin);
+	if (length <= 0.0f)
+	{
+		return nullptr;
 	}
+	return RayCast(origin, (end - origin) / length, length);
 }
 
 void ObjectManager::DestroyAllObjects()
 {
 	lastObjectID = 0;
+	currentFrameStats.destroyedObjects += static_cast<int>(objects.size());
 	for (auto& obj : objects)
 	{
+		ReleaseHandle(obj.get());
+		obj->manager = nullptr;
 		obj.reset();
 	}
+	nameIndex.clear();
+	sortedNames.clear();
+	nameTombstones = 0;
+	tagIndex.clear();
 	removalQueue.clear();
 	objects.clear();
+	spatialTree.Clear();
+	spatialEntries.clear();
+	unboundedSlots.clear();
+	spatialDirtySlots.clear();
 	selectedObject = nullptr;
+	sortedTransforms.clear();
+	sortedTransformSlots.clear();
+	transformOrderDirty = true;
 }
 
 void ObjectManager::ProcessQueues()
 {
-	for (const auto& func : commandQueue)
-	{
-		func();
-	}
-	commandQueue.clear();
+	commandQueue.Execute(sortCommandsByObject);
 
 	if (!removalQueue.empty())
 	{
-		objects.erase(
-			std::remove_if(objects.begin(), objects.end(),
-				[&](const std::unique_ptr<Object>& object) {
-			return std::find(removalQueue.begin(), removalQueue.end(), object.get()) != removalQueue.end();
-		}),
-			objects.end()
-		);
+		Uint64 startTicks = SDL_GetPerformanceCounter();
+
+		// 1. 삭제될 오브젝트들의 컴포넌트 End()를 한 번에 호출 (렌더러/조명 해제 요청이 한 프레임에 모임)
+		for (Object* object : removalQueue)
+		{
+			object->EndComponents();
+		}
+
+		// 2. 인덱스/핸들 해제 후 swap-and-pop으로 제거 (삭제 1개당 O(1))
+		for (Object* object : removalQueue)
+		{
+			if (selectedObject == object)
+			{
+				selectedObject = nullptr;
+			}
+			UnregisterObject(object);
+
+			uint32_t index = object->objectIndex;
+			if (index != objects.size() - 1)
+			{
+				std::swap(objects[index], objects.back());
+				objects[index]->objectIndex = index;
+			}
+			objects.pop_back();
+		}
+
+		currentFrameStats.destroyedObjects += static_cast<int>(removalQueue.size());
 		removalQueue.clear();
+		transformOrderDirty = true;
+
+		Uint64 endTicks = SDL_GetPerformanceCounter();
+		currentFrameStats.compactionMs = static_cast<float>(endTicks - startTicks) * 1000.0f / static_cast<float>(SDL_GetPerformanceFrequency());
+	}
+
+	lastFrameStats = currentFrameStats;
+	currentFrameStats = FrameStats{};
+}
+
+void ObjectManager::SelectObject(Object* object)
+{
+	// 이전 선택의 디버그 셰이더를 원래대로 되돌림
+	if(selectedObject != nullptr)
+	{
+		MeshRenderer* renderer = selectedObject->GetComponent<MeshRenderer>();
+		if (renderer)
+		{
+			if (prevShader != nullptr)
+			{
+				renderer->SetShader(prevShader);
+			}
+		}
 	}
+	selectedBoneName = "";
+	bDrawSkeleton = false; 
+	isWeightDebugMode = false;
+	prevShader = nullptr;
+
+	selectedObject = object;
 }
 
 void ObjectManager::ObjectControllerForImgui()
@@ -137,26 +674,118 @@ void ObjectManager::ObjectControllerForImgui()
 		std::string uniqueID = label + "##" + std::to_string(reinterpret_cast<uintptr_t>(currentObject));
 		if (ImGui::Selectable(uniqueID.c_str(), selectedObject == currentObject))
 		{
-			if(selectedObject != nullptr)
+			SelectObject(currentObject);
+		}
+	}
+	ImGui::EndChild();
+
+	// 씬을 왼쪽 클릭하면 메인 카메라 광선으로 공간 인덱스를 검사해 가장 가까운 오브젝트 선택
+	InputManager* input = Engine::GetInstance().GetInputManager();
+	if (pickWithMouse && input && !ImGui::GetIO().WantCaptureMouse && !input->GetRelativeMouseMode()
+		&& input->IsMouseButtonPressOnce(MOUSEBUTTON::LEFT))
+	{
+		Object* picked = PickObject(Engine::GetInstance().GetCameraManager()->GetMainCamera(), input->GetMousePosition());
+		if (picked && picked != selectedObject)
+		{
+			SelectObject(picked);
+		}
+	}
+
+	ImGui::Text("Objects: %zu (+%d / -%d, compaction %.3f ms)", objects.size(),
+		lastFrameStats.createdObjects, lastFrameStats.destroyedObjects, lastFrameStats.compactionMs);
+	ImGui::Text("Updated Transforms: %d", lastFrameStats.updatedTransforms);
+
+	if (ImGui::TreeNode("Transform Batch"))
+	{
+		// 비교용으로 낮은 수준을 강제할 수 있음 (지원하지 않는 수준은 자동으로 제한됨)
+		int simdLevel = static_cast<int>(GetTransformSimdLevel());
+		const char* simdLevels[] = { "Scalar", "SSE", "AVX2" };
+		if (ImGui::Combo("SIMD", &simdLevel, simdLevels, IM_ARRAYSIZE(simdLevels)))
+		{
+			SetTransformSimdLevel(static_cast<TransformSimdLevel>(simdLevel));
+		}
+		ImGui::Text("Supported: %s", TransformSimdLevelToString(GetSupportedTransformSimdLevel()));
+
+		ImGui::InputInt("Transform Count", &transformBenchmarkCount);
+		if (ImGui::Button("Run Transform Benchmark"))
+		{
+			lastTransformBenchmark = RunTransformBenchmark(transformBenchmarkCount);
+		}
+		if (lastTransformBenchmark.transformCount > 0)
+		{
+			ImGui::Text("glm (GetModelMatrix) : %.3f ms", lastTransformBenchmark.glmMs);
+			ImGui::Text("Scalar : %.3f ms", lastTransformBenchmark.scalarMs);
+			if (lastTransformBenchmark.sseMs >= 0.0f)
 			{
-				MeshRenderer* renderer = selectedObject->GetComponent<MeshRenderer>();
-				if (renderer)
-				{
-					if (prevShader != nullptr)
-					{
-						renderer->SetShader(prevShader);
-					}
-				}
+				ImGui::Text("SSE    : %.3f ms", lastTransformBenchmark.sseMs);
 			}
-			selectedBoneName = "";
-			bDrawSkeleton = false; 
-			isWeightDebugMode = false;
-			prevShader = nullptr;
+			if (lastTransformBenchmark.avx2Ms >= 0.0f)
+			{
+				ImGui::Text("AVX2   : %.3f ms", lastTransformBenchmark.avx2Ms);
+			}
+			ImGui::Text("Max Error : %g", lastTransformBenchmark.maxError);
+		}
+		ImGui::TreePop();
+	}
+
+	if (ImGui::TreeNode("Spatial Index"))
+	{
+		ImGui::Checkbox("Pick With Mouse (Left Click)", &pickWithMouse);
+		ImGui::Text("Proxies: %d (+%zu unbounded)", spatialTree.GetProxyCount(), unboundedSlots.size());
+		ImGui::Text("Height: %d, Area Ratio: %.1f", spatialTree.GetHeight(), spatialTree.GetAreaRatio());
+		ImGui::Text("Refreshed Bounds: %d, Reinserted: %d (%.3f ms)", lastFrameStats.refreshedBounds,
+			lastFrameStats.reinsertedProxies, lastFrameStats.spatialUpdateMs);
+
+		ImGui::InputInt("Benchmark Objects", &spatialBenchmarkCount);
+		spatialBenchmarkCount = std::clamp(spatialBenchmarkCount, 1, 1000000);
+		if (ImGui::Button("Run Spatial Benchmark"))
+		{
+			lastSpatialBenchmark = RunSpatialTreeBenchmark(spatialBenchmarkCount);
+		}
+		if (lastSpatialBenchmark.objectCount > 0)
+		{
+			ImGui::Text("%d objects, height %d, area ratio %.1f", lastSpatialBenchmark.objectCount, lastSpatialBenchmark.treeHeight, lastSpatialBenchmark.areaRatio);
+			ImGui::Text("Build (incremental insert) : %.3f ms", lastSpatialBenchmark.buildMs);
+			ImGui::Text("Move 2%% : %.3f ms (%d reinserted)", lastSpatialBenchmark.moveMs, lastSpatialBenchmark.reinsertedProxies);
+			ImGui::Text("Frustum  : tree %.3f ms / linear SIMD %.3f ms (%d visible)", lastSpatialBenchmark.frustumTreeMs,
+				lastSpatialBenchmark.frustumLinearMs, lastSpatialBenchmark.frustumVisible);
+			ImGui::Text("1000 Rays : tree %.3f ms / linear %.3f ms", lastSpatialBenchmark.rayTreeMs, lastSpatialBenchmark.rayLinearMs);
+			ImGui::Text("500 Overlaps : tree %.3f ms / linear %.3f ms", lastSpatialBenchmark.overlapTreeMs, lastSpatialBenchmark.overlapLinearMs);
+			ImGui::Text("Matches Brute Force: %s", lastSpatialBenchmark.matchesBruteForce ? "Yes" : "No");
+		}
+		ImGui::TreePop();
+	}
+
+	ImGui::Text("Commands: %zu (%.1f KB, %zu blocks)", commandQueue.GetLastExecutedCount(),
+		static_cast<float>(commandQueue.GetBytesUsed()) / 1024.0f, commandQueue.GetBlockCount());
+	ImGui::Checkbox("Sort Commands By Object", &sortCommandsByObject);
+
+	if (ImGui::TreeNode("Component Storage"))
+	{
+		for (const auto& pool : componentStorage.GetPools())
+		{
+			ImGui::Text("%s : %zu / %zu (%s%s)", ComponentToString(pool->GetComponentType()).c_str(), pool->GetCount(), pool->GetCapacity(),
+				pool->HasUpdate() ? UpdatePhaseToString(pool->GetPhase()) : "no update", pool->IsParallel() ? ", parallel" : "");
+		}
 
-			selectedObject = currentObject;
+		bool parallelUpdate = componentStorage.IsParallelUpdate();
+		if (ImGui::Checkbox("Parallel Update", &parallelUpdate))
+		{
+			componentStorage.SetParallelUpdate(parallelUpdate);
+		}
+		bool writeGuard = UpdateWriteGuard::IsEnabled();
+		if (ImGui::Checkbox("Detect Cross-Object Writes", &writeGuard))
+		{
+			UpdateWriteGuard::SetEnabled(writeGuard);
+			UpdateWriteGuard::ResetViolationCount();
+		}
+		if (writeGuard)
+		{
+			ImGui::Text("Violations : %d", UpdateWriteGuard::GetViolationCount());
 		}
+		ImGui::Text("Archetypes : %zu", componentStorage.GetArchetypes().size());
+		ImGui::TreePop();
 	}
-	ImGui::EndChild();
 
 	ImGui::Separator();
 	ImGui::Text("Inspector");
@@ -273,6 +902,13 @@ void ObjectManager::ObjectControllerForImgui()
 						renderer->SetColor({ colorArr[0], colorArr[1], colorArr[2], colorArr[3] });
 					}
 
+					// 가리개: CPU 깊이 버퍼에 그려져 뒤쪽 물체의 가림 판정에 쓰임
+					bool isOccluder = renderer->IsOccluder();
+					if (ImGui::Checkbox("Occluder", &isOccluder))
+					{
+						renderer->SetOccluder(isOccluder);
+					}
+
 					ImGui::Separator();
 					ImGui::Text("Material Properties");
 
@@ -288,10 +924,12 @@ void ObjectManager::ObjectControllerForImgui()
 						renderer->SetRoughness(currentRoughness);
 					}
 
-					float currentExposure = renderer->GetExposure();
-					if (ImGui::DragFloat("Exposure", &currentExposure, 0.01f, 0.0f, 10.0f))
+					// 노출은 프레임 유니폼 버퍼로 전달되는 전역 값
+					RenderManager* renderManager = Engine::GetInstance().GetRenderManager();
+					float currentExposure = renderManager->GetExposure();
+					if (ImGui::DragFloat("Exposure (Global)", &currentExposure, 0.01f, 0.0f, 10.0f))
 					{
-						renderer->SetExposure(currentExposure);
+						renderManager->SetExposure(currentExposure);
 					}
 				}
 			}
@@ -583,12 +1221,12 @@ void ObjectManager::RenderGizmos(Camera* camera)
 	glm::mat4 modelMatrix_X_Cyl = glm::translate(glm::mat4(1.0f), objectPosition) * objectRotationMatrix * glm::translate(glm::mat4(1.0f), { gizmoLineLength / 2.0f, 0.0f, 0.0f }) * glm::rotate(glm::mat4(1.0f), glm::radians(90.0f), { 0.0f, 1.0f, 0.0f }) * glm::scale(glm::mat4(1.0f), { gizmoLineRadius, gizmoLineRadius, gizmoLineLength });
 	gizmoShader->SetUniformMat4f("model", modelMatrix_X_Cyl);
 	cylinderVA->Bind();
-	glDrawElements(GL_TRIANGLES, cylinderVA->GetIndicesCount(), GL_UNSIGNED_INT, 0);
+	glDrawElements(GL_TRIANGLES, cylinderVA->GetIndicesCount(), cylinderVA->GetIndexType(), 0);
 	// 원뿔 (화살촉)
 	glm::mat4 modelMatrix_X_Cone = glm::translate(glm::mat4(1.0f), objectPosition) * objectRotationMatrix * glm::translate(glm::mat4(1.0f), { gizmoLineLength, 0.0f, 0.0f }) * glm::rotate(glm::mat4(1.0f), glm::radians(-90.0f), { 0.0f, 0.0f, 1.0f }) * glm::scale(glm::mat4(1.0f), { gizmoArrowHeadRadius, gizmoArrowHeadLength, gizmoArrowHeadRadius });
 	gizmoShader->SetUniformMat4f("model", modelMatrix_X_Cone);
 	coneVA->Bind();
-	glDrawElements(GL_TRIANGLES, coneVA->GetIndicesCount(), GL_UNSIGNED_INT, 0);
+	glDrawElements(GL_TRIANGLES, coneVA->GetIndicesCount(), coneVA->GetIndexType(), 0);
 
 	// Y축
 	gizmoShader->SetUniformVec4("color", { 0.0f, 1.0f, 0.0f, 1.0f });
@@ -596,12 +1234,12 @@ void ObjectManager::RenderGizmos(Camera* camera)
 	glm::mat4 modelMatrix_Y_Cyl = glm::translate(glm::mat4(1.0f), objectPosition) * objectRotationMatrix * glm::translate(glm::mat4(1.0f), { 0.0f, gizmoLineLength / 2.0f, 0.0f }) * glm::rotate(glm::mat4(1.0f), glm::radians(-90.0f), { 1.0f, 0.0f, 0.0f }) * glm::scale(glm::mat4(1.0f), { gizmoLineRadius, gizmoLineRadius, gizmoLineLength });
 	gizmoShader->SetUniformMat4f("model", modelMatrix_Y_Cyl);
 	cylinderVA->Bind();
-	glDrawElements(GL_TRIANGLES, cylinderVA->GetIndicesCount(), GL_UNSIGNED_INT, 0);
+	glDrawElements(GL_TRIANGLES, cylinderVA->GetIndicesCount(), cylinderVA->GetIndexType(), 0);
 	// 원뿔 (화살촉)
 	glm::mat4 modelMatrix_Y_Cone = glm::translate(glm::mat4(1.0f), objectPosition) * objectRotationMatrix * glm::translate(glm::mat4(1.0f), { 0.0f, gizmoLineLength, 0.0f }) * glm::scale(glm::mat4(1.0f), { gizmoArrowHeadRadius, gizmoArrowHeadLength, gizmoArrowHeadRadius });
 	gizmoShader->SetUniformMat4f("model", modelMatrix_Y_Cone);
 	coneVA->Bind();
-	glDrawElements(GL_TRIANGLES, coneVA->GetIndicesCount(), GL_UNSIGNED_INT, 0);
+	glDrawElements(GL_TRIANGLES, coneVA->GetIndicesCount(), coneVA->GetIndexType(), 0);
 
 	// Z축
 	gizmoShader->SetUniformVec4("color", { 0.0f, 0.0f, 1.0f, 1.0f });
@@ -609,12 +1247,12 @@ void ObjectManager::RenderGizmos(Camera* camera)
 	glm::mat4 modelMatrix_Z_Cyl = glm::translate(glm::mat4(1.0f), objectPosition) * objectRotationMatrix * glm::translate(glm::mat4(1.0f), { 0.0f, 0.0f, gizmoLineLength / 2.0f }) * glm::scale(glm::mat4(1.0f), { gizmoLineRadius, gizmoLineRadius, gizmoLineLength });
 	gizmoShader->SetUniformMat4f("model", modelMatrix_Z_Cyl);
 	cylinderVA->Bind();
-	glDrawElements(GL_TRIANGLES, cylinderVA->GetIndicesCount(), GL_UNSIGNED_INT, 0);
+	glDrawElements(GL_TRIANGLES, cylinderVA->GetIndicesCount(), cylinderVA->GetIndexType(), 0);
 	// 원뿔 (화살촉)
 	glm::mat4 modelMatrix_Z_Cone = glm::translate(glm::mat4(1.0f), objectPosition) * objectRotationMatrix * glm::translate(glm::mat4(1.0f), { 0.0f, 0.0f, gizmoLineLength }) * glm::rotate(glm::mat4(1.0f), glm::radians(90.0f), { 1.0f, 0.0f, 0.0f }) * glm::scale(glm::mat4(1.0f), { gizmoArrowHeadRadius, gizmoArrowHeadLength, gizmoArrowHeadRadius });
 	gizmoShader->SetUniformMat4f("model", modelMatrix_Z_Cone);
 	coneVA->Bind();
-	glDrawElements(GL_TRIANGLES, coneVA->GetIndicesCount(), GL_UNSIGNED_INT, 0);
+	glDrawElements(GL_TRIANGLES, coneVA->GetIndicesCount(), coneVA->GetIndexType(), 0);
 
 
 	// 다음 렌더링에 영향을 주지 않도록 깊이 테스트를 다시 활성화
@@ -696,7 +1334,7 @@ void ObjectManager::DrawBoneHierarchy(const AssimpNodeData* node, const std::map
 			if (va)
 			{
 				va->Bind();
-				glDrawElements(static_cast<GLenum>(boneMesh->GetPrimitivePattern()), boneMesh->GetIndicesCount(), GL_UNSIGNED_INT, 0);
+				glDrawElements(static_cast<GLenum>(boneMesh->GetPrimitivePattern()), boneMesh->GetIndicesCount(), boneMesh->GetIndexType(), 0);
 				va->UnBind();
 			}
 		}
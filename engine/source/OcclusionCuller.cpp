@@ -0,0 +1,554 @@
+﻿#include "OcclusionCuller.hpp"
+#include <gtc/matrix_transform.hpp>
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define OCCLUSION_SIMD_SSE 1
+#include <emmintrin.h>
+#else
+#define OCCLUSION_SIMD_SSE 0
+#endif
+
+namespace
+{
+    float TicksToMs(Uint64 ticks)
+    {
+        return static_cast<float>(ticks) * 1000.0f / static_cast<float>(SDL_GetPerformanceFrequency());
+    }
+
+    // 클립 공간 근평면(z >= -w)까지의 부호 있는 거리
+    inline float NearDistance(const glm::vec4& v)
+    {
+        return v.z + v.w;
+    }
+
+    // 모든 꼭짓점이 같은 평면(x, y = +-w) 바깥이면 화면에 닿지 않음
+    bool IsOutsideSamePlane(const glm::vec4& a, const glm::vec4& b, const glm::vec4& c)
+    {
+        return (a.x > a.w && b.x > b.w && c.x > c.w) || (a.x < -a.w && b.x < -b.w && c.x < -c.w)
+            || (a.y > a.w && b.y > b.w && c.y > c.w) || (a.y < -a.w && b.y < -b.w && c.y < -c.w)
+            || (a.z > a.w && b.z > b.w && c.z > c.w);
+    }
+}
+
+void OcclusionCuller::SetResolution(int width_, int height_)
+{
+    int newWidth = std::max((width_ + TILE_WIDTH - 1) / TILE_WIDTH, 1) * TILE_WIDTH;
+    int newHeight = std::max((height_ + TILE_HEIGHT - 1) / TILE_HEIGHT, 1) * TILE_HEIGHT;
+    if (newWidth == width && newHeight == height)
+    {
+        return;
+    }
+    width = newWidth;
+    height = newHeight;
+    tilesX = width / TILE_WIDTH;
+    tilesY = height / TILE_HEIGHT;
+    tileBins.assign(static_cast<size_t>(tilesX * tilesY), {});
+
+    depthLevels.clear();
+    levelSizes.clear();
+    glm::ivec2 size(width, height);
+    while (true)
+    {
+        levelSizes.push_back(size);
+        depthLevels.emplace_back(static_cast<size_t>(size.x * size.y), 1.0f);
+        if (size.x == 1 && size.y == 1)
+        {
+            break;
+        }
+        size = glm::max((size + 1) / 2, glm::ivec2(1));
+    }
+}
+
+void OcclusionCuller::BeginFrame(const glm::mat4& viewProjection_)
+{
+    viewProjection = viewProjection_;
+    triangles.clear();
+    stats = OcclusionStats();
+    for (std::vector<float>& level : depthLevels)
+    {
+        std::fill(level.begin(), level.end(), 1.0f);
+    }
+}
+
+void OcclusionCuller::AddOccluder(const glm::mat4& modelMatrix, const float* positions, size_t stride, size_t vertexCount,
+    const unsigned int* indices, size_t indexCount)
+{
+    Uint64 startTicks = SDL_GetPerformanceCounter();
+    ++stats.occluders;
+
+    glm::mat4 modelViewProjection = viewProjection * modelMatrix;
+    clipVertices.resize(vertexCount);
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(positions);
+    for (size_t i = 0; i < vertexCount; ++i)
+    {
+        const float* position = reinterpret_cast<const float*>(bytes + i * stride);
+        clipVertices[i] = modelViewProjection * glm::vec4(position[0], position[1], position[2], 1.0f);
+    }
+
+    for (size_t i = 0; i + 2 < indexCount; i += 3)
+    {
+        if (indices[i] >= vertexCount || indices[i + 1] >= vertexCount || indices[i + 2] >= vertexCount)
+        {
+            continue;
+        }
+        ++stats.occluderTriangles;
+        glm::vec4 polygon[4] = { clipVertices[indices[i]], clipVertices[indices[i + 1]], clipVertices[indices[i + 2]] };
+        if (IsOutsideSamePlane(polygon[0], polygon[1], polygon[2]))
+        {
+            continue;
+        }
+
+        float distances[3] = { NearDistance(polygon[0]), NearDistance(polygon[1]), NearDistance(polygon[2]) };
+        int insideCount = (distances[0] >= 0.0f) + (distances[1] >= 0.0f) + (distances[2] >= 0.0f);
+        if (insideCount == 3)
+        {
+            SetupClippedTriangle(polygon[0], polygon[1], polygon[2]);
+            continue;
+        }
+        if (insideCount == 0)
+        {
+            continue;
+        }
+
+        // 근평면에 걸친 삼각형은 평면 안쪽 부분만 남김 (꼭짓점 3개 또는 4개 -> 부채꼴로 분할)
+        glm::vec4 clipped[4];
+        int clippedCount = 0;
+        for (int edge = 0; edge < 3; ++edge)
+        {
+            int next = (edge + 1) % 3;
+            if (distances[edge] >= 0.0f)
+            {
+                clipped[clippedCount++] = polygon[edge];
+            }
+            if ((distances[edge] >= 0.0f) != (distances[next] >= 0.0f))
+            {
+                float t = distances[edge] / (distances[edge] - distances[next]);
+                clipped[clippedCount++] = polygon[edge] + (polygon[next] - polygon[edge]) * t;
+            }
+        }
+        for (int v = 2; v < clippedCount; ++v)
+        {
+            SetupClippedTriangle(clipped[0], clipped[v - 1], clipped[v]);
+        }
+    }
+    stats.rasterMs += TicksToMs(SDL_GetPerformanceCounter() - startTicks);
+}
+
+void OcclusionCuller::SetupClippedTriangle(const glm::vec4& a, const glm::vec4& b, const glm::vec4& c)
+{
+    constexpr float MIN_W = 1e-6f;
+    if (a.w <= MIN_W || b.w <= MIN_W || c.w <= MIN_W)
+    {
+        return;
+    }
+
+    // 클립 공간 -> 픽셀 좌표 (픽셀 i의 중심 = i + 0.5), 깊이 [0, 1]
+    glm::vec3 screen[3];
+    const glm::vec4* clip[3] = { &a, &b, &c };
+    for (int v = 0; v < 3; ++v)
+    {
+        float inverseW = 1.0f / clip[v]->w;
+        screen[v].x = (clip[v]->x * inverseW * 0.5f + 0.5f) * static_cast<float>(width);
+        screen[v].y = (clip[v]->y * inverseW * 0.5f + 0.5f) * static_cast<float>(height);
+        screen[v].z = clip[v]->z * inverseW * 0.5f + 0.5f;
+    }
+
+    float dx1 = screen[1].x - screen[0].x;
+    float dy1 = screen[1].y - screen[0].y;
+    float dx2 = screen[2].x - screen[0].x;
+    float dy2 = screen[2].y - screen[0].y;
+    float area = dx1 * dy2 - dx2 * dy1;
+    if (std::fabs(area) < 1e-6f)
+    {
+        return;
+    }
+
+    // 픽셀 중심이 들어갈 수 있는 범위 (화면 밖의 큰 좌표는 정수로 바꾸기 전에 자름)
+    float minX = std::min({ screen[0].x, screen[1].x, screen[2].x });
+    float maxX = std::max({ screen[0].x, screen[1].x, screen[2].x });
+    float minY = std::min({ screen[0].y, screen[1].y, screen[2].y });
+    float maxY = std::max({ screen[0].y, screen[1].y, screen[2].y });
+    SetupTriangle triangle;
+    triangle.minX = static_cast<int>(std::ceil(std::clamp(minX - 0.5f, -1.0f, static_cast<float>(width))));
+    triangle.maxX = static_cast<int>(std::floor(std::clamp(maxX - 0.5f, -1.0f, static_cast<float>(width))));
+    triangle.minY = static_cast<int>(std::ceil(std::clamp(minY - 0.5f, -1.0f, static_cast<float>(height))));
+    triangle.maxY = static_cast<int>(std::floor(std::clamp(maxY - 0.5f, -1.0f, static_cast<float>(height))));
+    triangle.minX = std::max(triangle.minX, 0);
+    triangle.minY = std::max(triangle.minY, 0);
+    triangle.maxX = std::min(triangle.maxX, width - 1);
+    triangle.maxY = std::min(triangle.maxY, height - 1);
+    if (triangle.minX > triangle.maxX || triangle.minY > triangle.maxY)
+    {
+        return;
+    }
+
+    // 반시계 방향(area > 0)이면 안쪽이 양수, 시계 방향이면 부호를 뒤집음 (가리개는 양면 모두 그림)
+    float sign = area > 0.0f ? 1.0f : -1.0f;
+    for (int edge = 0; edge < 3; ++edge)
+    {
+        const glm::vec3& from = screen[edge];
+        const glm::vec3& to = screen[(edge + 1) % 3];
+        triangle.edgeA[edge] = (from.y - to.y) * sign;
+        triangle.edgeB[edge] = (to.x - from.x) * sign;
+        triangle.edgeC[edge] = (from.x * to.y - from.y * to.x) * sign;
+    }
+
+    float dz1 = screen[1].z - screen[0].z;
+    float dz2 = screen[2].z - screen[0].z;
+    triangle.depthA = (dz1 * dy2 - dz2 * dy1) / area;
+    triangle.depthB = (dz2 * dx1 - dz1 * dx2) / area;
+    triangle.depthC = screen[0].z - triangle.depthA * screen[0].x - triangle.depthB * screen[0].y;
+    triangle.depthBias = 0.5f * (std::fabs(triangle.depthA) + std::fabs(triangle.depthB));
+    triangle.maxDepth = std::max({ screen[0].z, screen[1].z, screen[2].z });
+    triangles.push_back(triangle);
+}
+
+void OcclusionCuller::Rasterize(const OcclusionParallelFor& parallelFor)
+{
+    Uint64 startTicks = SDL_GetPerformanceCounter();
+    stats.rasterizedTriangles = static_cast<int>(triangles.size());
+
+    // 타일 배정 (타일마다 겹치는 삼각형 번호를 제출 순서대로 모음)
+    for (std::vector<uint32_t>& bin : tileBins)
+    {
+        bin.clear();
+    }
+    stats.binnedTriangles = 0;
+    for (size_t i = 0; i < triangles.size(); ++i)
+    {
+        const SetupTriangle& triangle = triangles[i];
+        for (int ty = triangle.minY / TILE_HEIGHT; ty <= triangle.maxY / TILE_HEIGHT; ++ty)
+        {
+            for (int tx = triangle.minX / TILE_WIDTH; tx <= triangle.maxX / TILE_WIDTH; ++tx)
+            {
+                tileBins[static_cast<size_t>(tx + ty * tilesX)].push_back(static_cast<uint32_t>(i));
+                ++stats.binnedTriangles;
+            }
+        }
+    }
+
+    // 타일끼리는 쓰는 픽셀이 겹치지 않으므로 잠금 없이 병렬로 래스터화
+    int tileCount = tilesX * tilesY;
+    auto rasterizeTiles = [this](int begin, int end)
+    {
+        for (int tile = begin; tile < end; ++tile)
+        {
+            RasterizeTile(tile);
+        }
+    };
+    if (parallelFor)
+    {
+        parallelFor(tileCount, rasterizeTiles);
+    }
+    else
+    {
+        rasterizeTiles(0, tileCount);
+    }
+
+    BuildHierarchy();
+    stats.rasterMs += TicksToMs(SDL_GetPerformanceCounter() - startTicks);
+}
+
+void OcclusionCuller::RasterizeTile(int tileIndex)
+{
+    int tileMinX = (tileIndex % tilesX) * TILE_WIDTH;
+    int tileMinY = (tileIndex / tilesX) * TILE_HEIGHT;
+    int tileMaxX = tileMinX + TILE_WIDTH - 1;
+    int tileMaxY = tileMinY + TILE_HEIGHT - 1;
+
+    for (uint32_t index : tileBins[static_cast<size_t>(tileIndex)])
+    {
+        const SetupTriangle& triangle = triangles[index];
+        // 시작 x를 4의 배수로 내려 4픽셀 묶음이 타일 경계를 넘지 않게 함 (범위 밖 픽셀은 에지 판정에서 걸러짐)
+        int x0 = std::max(triangle.minX, tileMinX) & ~3;
+        int x1 = std::min(triangle.maxX, tileMaxX);
+        int y0 = std::max(triangle.minY, tileMinY);
+        int y1 = std::min(triangle.maxY, tileMaxY);
+#if OCCLUSION_SIMD_SSE
+        if (useSimd)
+        {
+            RasterizeRowsSimd(triangle, x0, x1, y0, y1);
+            continue;
+        }
+#endif
+        RasterizeRowsScalar(triangle, x0, x1, y0, y1);
+    }
+}
+
+void OcclusionCuller::RasterizeRowsScalar(const SetupTriangle& triangle, int x0, int x1, int y0, int y1)
+{
+    std::vector<float>& depth = depthLevels[0];
+    for (int y = y0; y <= y1; ++y)
+    {
+        float py = static_cast<float>(y) + 0.5f;
+        float rowEdge0 = triangle.edgeB[0] * py + triangle.edgeC[0];
+        float rowEdge1 = triangle.edgeB[1] * py + triangle.edgeC[1];
+        float rowEdge2 = triangle.edgeB[2] * py + triangle.edgeC[2];
+        float rowDepth = triangle.depthB * py + triangle.depthC;
+        float* row = depth.data() + static_cast<size_t>(y) * width;
+        // SIMD 경로와 같은 4픽셀 묶음, 같은 연산 순서 (결과가 비트 단위로 같음)
+        for (int x = x0; x <= x1; x += 4)
+        {
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                float px = static_cast<float>(x + lane) + 0.5f;
+                float e0 = triangle.edgeA[0] * px + rowEdge0;
+                float e1 = triangle.edgeA[1] * px + rowEdge1;
+                float e2 = triangle.edgeA[2] * px + rowEdge2;
+                if (e0 >= 0.0f && e1 >= 0.0f && e2 >= 0.0f)
+                {
+                    float z = std::min(triangle.depthA * px + rowDepth + triangle.depthBias, triangle.maxDepth);
+                    row[x + lane] = std::min(row[x + lane], z);
+                }
+            }
+        }
+    }
+}
+
+void OcclusionCuller::RasterizeRowsSimd(const SetupTriangle& triangle, int x0, int x1, int y0, int y1)
+{
+#if OCCLUSION_SIMD_SSE
+    std::vector<float>& depth = depthLevels[0];
+    const __m128 laneOffsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    const __m128 zero = _mm_setzero_ps();
+    __m128 edgeA0 = _mm_set1_ps(triangle.edgeA[0]);
+    __m128 edgeA1 = _mm_set1_ps(triangle.edgeA[1]);
+    __m128 edgeA2 = _mm_set1_ps(triangle.edgeA[2]);
+    __m128 depthA = _mm_set1_ps(triangle.depthA);
+    __m128 depthBias = _mm_set1_ps(triangle.depthBias);
+    __m128 maxDepth = _mm_set1_ps(triangle.maxDepth);
+    for (int y = y0; y <= y1; ++y)
+    {
+        float py = static_cast<float>(y) + 0.5f;
+        __m128 rowEdge0 = _mm_set1_ps(triangle.edgeB[0] * py + triangle.edgeC[0]);
+        __m128 rowEdge1 = _mm_set1_ps(triangle.edgeB[1] * py + triangle.edgeC[1]);
+        __m128 rowEdge2 = _mm_set1_ps(triangle.edgeB[2] * py + triangle.edgeC[2]);
+        __m128 rowDepth = _mm_set1_ps(triangle.depthB * py + triangle.depthC);
+        float* row = depth.data() + static_cast<size_t>(y) * width;
+        for (int x = x0; x <= x1; x += 4)
+        {
+            __m128 px = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), laneOffsets);
+            __m128 e0 = _mm_add_ps(_mm_mul_ps(edgeA0, px), rowEdge0);
+            __m128 e1 = _mm_add_ps(_mm_mul_ps(edgeA1, px), rowEdge1);
+            __m128 e2 = _mm_add_ps(_mm_mul_ps(edgeA2, px), rowEdge2);
+            __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(e0, zero), _mm_cmpge_ps(e1, zero)), _mm_cmpge_ps(e2, zero));
+            if (_mm_movemask_ps(inside) == 0)
+            {
+                continue;
+            }
+            __m128 z = _mm_min_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(depthA, px), rowDepth), depthBias), maxDepth);
+            __m128 old = _mm_loadu_ps(row + x);
+            __m128 merged = _mm_min_ps(old, z);
+            _mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, merged), _mm_andnot_ps(inside, old)));
+        }
+    }
+#else
+    RasterizeRowsScalar(triangle, x0, x1, y0, y1);
+#endif
+}
+
+void OcclusionCuller::BuildHierarchy()
+{
+    for (size_t level = 1; level < depthLevels.size(); ++level)
+    {
+        const std::vector<float>& source = depthLevels[level - 1];
+        std::vector<float>& target = depthLevels[level];
+        glm::ivec2 sourceSize = levelSizes[level - 1];
+        glm::ivec2 targetSize = levelSizes[level];
+        for (int y = 0; y < targetSize.y; ++y)
+        {
+            int sy0 = y * 2;
+            int sy1 = std::min(sy0 + 1, sourceSize.y - 1);
+            for (int x = 0; x < targetSize.x; ++x)
+            {
+                int sx0 = x * 2;
+                int sx1 = std::min(sx0 + 1, sourceSize.x - 1);
+                target[static_cast<size_t>(x + y * targetSize.x)] = std::max(
+                    std::max(source[static_cast<size_t>(sx0 + sy0 * sourceSize.x)], source[static_cast<size_t>(sx1 + sy0 * sourceSize.x)]),
+                    std::max(source[static_cast<size_t>(sx0 + sy1 * sourceSize.x)], source[static_cast<size_t>(sx1 + sy1 * sourceSize.x)]));
+            }
+        }
+    }
+}
+
+bool OcclusionCuller::TestAABB(const AABB& bounds) const
+{
+    if (!bounds.IsValid() || depthLevels.empty())
+    {
+        return true;
+    }
+
+    // 8개 꼭짓점을 화면에 투영해 감싸는 사각형과 가장 가까운 깊이를 구함
+    float minX = 1e30f, minY = 1e30f, maxX = -1e30f, maxY = -1e30f;
+    float nearestDepth = 1e30f;
+    for (int corner = 0; corner < 8; ++corner)
+    {
+        glm::vec4 position((corner & 1) ? bounds.max.x : bounds.min.x, (corner & 2) ? bounds.max.y : bounds.min.y,
+            (corner & 4) ? bounds.max.z : bounds.min.z, 1.0f);
+        glm::vec4 clip = viewProjection * position;
+        if (clip.w <= 1e-6f || clip.z < -clip.w)
+        {
+            // 근평면에 걸친 상자는 투영 사각형을 구할 수 없으므로 보이는 것으로 처리
+            return true;
+        }
+        float inverseW = 1.0f / clip.w;
+        float sx = (clip.x * inverseW * 0.5f + 0.5f) * static_cast<float>(width);
+        float sy = (clip.y * inverseW * 0.5f + 0.5f) * static_cast<float>(height);
+        minX = std::min(minX, sx);
+        maxX = std::max(maxX, sx);
+        minY = std::min(minY, sy);
+        maxY = std::max(maxY, sy);
+        nearestDepth = std::min(nearestDepth, clip.z * inverseW * 0.5f + 0.5f);
+    }
+    if (maxX < 0.0f || maxY < 0.0f || minX >= static_cast<float>(width) || minY >= static_cast<float>(height))
+    {
+        return true; // 화면 밖 (절두체 컬링이 맡음)
+    }
+
+    // 사각형과 겹치는 모든 픽셀 (픽셀 i는 [i, i + 1) 구간) + 주변 한 픽셀
+    // 가리개는 픽셀 중심 기준으로 덮으므로 윤곽이 최대 반 픽셀 넓게 기록됨 -> 한 픽셀 넓혀 윤곽 근처를 보이는 것으로 판정
+    int x0 = std::max(static_cast<int>(std::floor(minX)) - 1, 0);
+    int y0 = std::max(static_cast<int>(std::floor(minY)) - 1, 0);
+    int x1 = std::min(static_cast<int>(std::floor(maxX)) + 1, width - 1);
+    int y1 = std::min(static_cast<int>(std::floor(maxY)) + 1, height - 1);
+
+    // 사각형이 2x2 텍셀 이하가 되는 단계에서 최대 깊이를 먼저 비교
+    int level = 0;
+    while (level + 1 < static_cast<int>(depthLevels.size())
+        && ((x1 >> level) - (x0 >> level) > 1 || (y1 >> level) - (y0 >> level) > 1))
+    {
+        ++level;
+    }
+    const std::vector<float>& coarse = depthLevels[level];
+    int coarseWidth = levelSizes[level].x;
+    float coarseMax = 0.0f;
+    for (int y = y0 >> level; y <= (y1 >> level); ++y)
+    {
+        for (int x = x0 >> level; x <= (x1 >> level); ++x)
+        {
+            coarseMax = std::max(coarseMax, coarse[static_cast<size_t>(x + y * coarseWidth)]);
+        }
+    }
+    if (nearestDepth > coarseMax)
+    {
+        return false;
+    }
+    if (level == 0)
+    {
+        return true;
+    }
+
+    // 큰 텍셀에 먼 픽셀이 섞여 판정이 안 났으면 원래 해상도에서 사각형 안의 픽셀을 모두 확인
+    const std::vector<float>& depth = depthLevels[0];
+    for (int y = y0; y <= y1; ++y)
+    {
+        const float* row = depth.data() + static_cast<size_t>(y) * width;
+        for (int x = x0; x <= x1; ++x)
+        {
+            if (nearestDepth <= row[x])
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+OcclusionBenchmarkResult RunOcclusionBenchmark(int occludeeCount, const OcclusionParallelFor& parallelFor)
+{
+    constexpr int ITERATIONS = 20;
+    constexpr int WALL_COUNT = 48;
+
+    OcclusionBenchmarkResult result;
+    result.occludeeCount = occludeeCount;
+
+    // 단위 상자 (정점 8개, 삼각형 12개)와 바닥 사각형
+    std::vector<glm::vec3> boxVertices;
+    for (int corner = 0; corner < 8; ++corner)
+    {
+        boxVertices.emplace_back((corner & 1) ? 0.5f : -0.5f, (corner & 2) ? 0.5f : -0.5f, (corner & 4) ? 0.5f : -0.5f);
+    }
+    const std::vector<unsigned int> boxIndices = {
+        0, 2, 1, 1, 2, 3,  4, 5, 6, 5, 7, 6,  0, 1, 4, 1, 5, 4,
+        2, 6, 3, 3, 6, 7,  0, 4, 2, 2, 4, 6,  1, 3, 5, 3, 7, 5 };
+    const std::vector<glm::vec3> groundVertices = {
+        { -300.0f, 0.0f, -300.0f }, { 300.0f, 0.0f, -300.0f }, { 300.0f, 0.0f, 20.0f }, { -300.0f, 0.0f, 20.0f } };
+    const std::vector<unsigned int> groundIndices = { 0, 2, 1, 0, 3, 2 };
+
+    // 카메라 바로 앞(z = -20)의 기준 벽 + 그 뒤쪽의 무작위 벽 (고정 시드)
+    std::mt19937 random(4321);
+    std::vector<glm::mat4> walls;
+    walls.push_back(glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 2.5f, -20.0f)), glm::vec3(10.0f, 5.0f, 0.5f)));
+    std::uniform_real_distribution<float> wallX(-80.0f, 80.0f);
+    std::uniform_real_distribution<float> wallZ(-250.0f, -50.0f);
+    std::uniform_real_distribution<float> wallWidth(8.0f, 20.0f);
+    std::uniform_real_distribution<float> wallHeight(3.0f, 8.0f);
+    for (int i = 1; i < WALL_COUNT; ++i)
+    {
+        float wallHeightValue = wallHeight(random);
+        walls.push_back(glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(wallX(random), wallHeightValue * 0.5f, wallZ(random))),
+            glm::vec3(wallWidth(random), wallHeightValue, 0.5f)));
+    }
+
+    std::uniform_real_distribution<float> boxX(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> boxY(0.5f, 3.0f);
+    std::uniform_real_distribution<float> boxZ(-250.0f, -5.0f);
+    std::uniform_real_distribution<float> boxSize(0.25f, 1.0f);
+    std::vector<AABB> occludees(static_cast<size_t>(std::max(occludeeCount, 0)));
+    for (AABB& box : occludees)
+    {
+        glm::vec3 center(boxX(random), boxY(random), boxZ(random));
+        glm::vec3 halfSize(boxSize(random));
+        box = { center - halfSize, center + halfSize };
+    }
+
+    glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 1.7f, 0.0f), glm::vec3(0.0f, 1.7f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    glm::mat4 projection = glm::perspective(glm::radians(60.0f), 2.0f, 0.1f, 300.0f);
+
+    OcclusionCuller culler;
+    auto measure = [&](bool simd, const OcclusionParallelFor& executor)
+    {
+        culler.SetUseSimd(simd);
+        Uint64 start = SDL_GetPerformanceCounter();
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            culler.BeginFrame(projection * view);
+            culler.AddOccluder(glm::mat4(1.0f), &groundVertices[0].x, sizeof(glm::vec3), groundVertices.size(),
+                groundIndices.data(), groundIndices.size());
+            for (const glm::mat4& wall : walls)
+            {
+                culler.AddOccluder(wall, &boxVertices[0].x, sizeof(glm::vec3), boxVertices.size(), boxIndices.data(), boxIndices.size());
+            }
+            culler.Rasterize(executor);
+        }
+        return TicksToMs(SDL_GetPerformanceCounter() - start) / static_cast<float>(ITERATIONS);
+    };
+
+    result.scalarRasterMs = measure(false, {});
+    std::vector<float> scalarDepth = culler.GetDepthBuffer();
+    result.simdRasterMs = measure(true, {});
+    std::vector<float> simdDepth = culler.GetDepthBuffer();
+    result.parallelRasterMs = measure(true, parallelFor);
+    result.matchesReference = scalarDepth == simdDepth && simdDepth == culler.GetDepthBuffer();
+    result.occluderTriangles = culler.GetStats().occluderTriangles;
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    for (const AABB& box : occludees)
+    {
+        result.occludedCount += culler.TestAABB(box) ? 0 : 1;
+    }
+    result.testMs = TicksToMs(SDL_GetPerformanceCounter() - start);
+
+    // 기준 벽 바로 뒤 / 바닥 아래 상자는 가려지고, 벽 앞 상자와 벽 위로 솟은 상자는 보여야 함
+    AABB behindWall = { glm::vec3(-0.5f, 1.0f, -30.5f), glm::vec3(0.5f, 2.0f, -29.5f) };
+    AABB belowGround = { glm::vec3(-0.5f, -3.5f, -30.5f), glm::vec3(0.5f, -2.5f, -29.5f) };
+    AABB inFront = { glm::vec3(-0.5f, 1.0f, -10.5f), glm::vec3(0.5f, 2.0f, -9.5f) };
+    AABB aboveWall = { glm::vec3(-0.5f, 9.0f, -30.5f), glm::vec3(0.5f, 10.0f, -29.5f) };
+    result.knownCasesPassed = !culler.TestAABB(behindWall) && !culler.TestAABB(belowGround)
+        && culler.TestAABB(inFront) && culler.TestAABB(aboveWall);
+    return result;
+}
@@ -1,13 +1,116 @@
 #include "RenderManager.hpp"
 #include "Engine.hpp"  
 #include "MeshRenderer.hpp"
+#include "Model.hpp"
 #include "CameraManager.hpp"
 #include "SceneManager.hpp"
 #include "Scene.hpp" 
 #include "Shader.hpp"  
 #include "Texture.hpp" 
 #include "Light.hpp" 
+#include "Object.hpp"
+#include "ObjectManager.hpp"
+#include "VertexArray.hpp"
+#include "ThreadManager.hpp"
+#include "imgui.h"
 #include <algorithm>
+#include <functional>
+#include <cstddef>
+#include <cstring>
+
+namespace
+{
+    // н/ġ  ϴ  (̸ ؽô  Ÿӿ )
+    constexpr UniformHandle VIEW_UNIFORM("view");
+    constexpr UniformHandle PROJECTION_UNIFORM("projection");
+    constexpr UniformHandle VIEW_POS_UNIFORM("viewPos");
+    constexpr UniformHandle IRRADIANCE_MAP_UNIFORM("irradianceMap");
+    constexpr UniformHandle PREFILTER_MAP_UNIFORM("prefilterMap");
+    constexpr UniformHandle BRDF_LUT_UNIFORM("brdfLUT");
+    constexpr UniformHandle USE_TEXTURE_UNIFORM("useTexture");
+    constexpr UniformHandle TEXTURE_UNIFORM("Texture");
+
+    //     data ϰ  ε ȣ   
+    // (  д  ο찡 ־  Ƿ GPU ȭ )
+    void UpdateUniformBuffer(StreamRingBuffer& ring, unsigned int binding, const void* data, size_t size)
+    {
+        StreamAllocation allocation = ring.Write(data, size, ring.GetUniformAlignment());
+        if (allocation.IsValid())
+        {
+            glBindBufferRange(GL_UNIFORM_BUFFER, binding, allocation.buffer, static_cast<GLintptr>(allocation.offset), static_cast<GLsizeiptr>(size));
+        }
+    }
+}
+
+const std::shared_ptr<GeometryPool>& RenderManager::GetGeometryPool(const VertexFormat& format, GLenum indexType)
+{
+    std::shared_ptr<GeometryPool>& pool = geometryPools[&format == &GetSkinnedVertexFormat() ? 1 : 0][indexType == GL_UNSIGNED_SHORT ? 1 : 0];
+    if (!pool)
+    {
+        pool = std::make_shared<GeometryPool>(format, indexType);
+    }
+    return pool;
+}
+
+void RenderManager::RemoveCameraState(const Camera* camera)
+{
+    if (!camera)
+    {
+        return;
+    }
+    for (std::vector<MeshRenderer*>* list : { &renderers, &pendingAddition })
+    {
+        for (MeshRenderer* renderer : *list)
+        {
+            if (renderer)
+            {
+                renderer->RemoveLodState(camera->GetId());
+            }
+        }
+    }
+}
+
+std::shared_ptr<const Mesh> RenderManager::GetProceduralMesh(ProceduralShape shape, int param0, int param1)
+{
+    ++proceduralMeshRequests;
+    //    ׸  ĳð  ִ   ̻ Ŀ ʰ 
+    std::erase_if(proceduralMeshes, [](const auto& entry) { return entry.second.expired(); });
+    std::weak_ptr<const Mesh>& cached = proceduralMeshes[Mesh::MakeProceduralKey(shape, param0, param1)];
+    if (std::shared_ptr<const Mesh> existing = cached.lock())
+    {
+        return existing;
+    }
+
+    auto mesh = std::make_shared<Mesh>();
+    mesh->CreateProcedural(shape, param0, param1);
+    MeshRenderer::UploadMesh(*mesh);
+    ++proceduralMeshBuilds;
+    cached = mesh;
+    return mesh;
+}
+
+StreamRingBuffer* RenderManager::GetStreamBuffer()
+{
+    if (!streamBuffer)
+    {
+        streamBuffer = std::make_unique<StreamRingBuffer>();
+    }
+    return streamBuffer.get();
+}
+
+void RenderManager::BindBonePalette(const glm::mat4* matrices, size_t count, size_t blockSize)
+{
+    StreamRingBuffer* ring = GetStreamBuffer();
+    StreamAllocation allocation = ring->Allocate(blockSize, ring->GetUniformAlignment());
+    if (!allocation.IsValid())
+    {
+        return;
+    }
+    // ̴ д  ȣ  ũ ̹Ƿ  κ ä 
+    std::memcpy(allocation.data, matrices, std::min(count * sizeof(glm::mat4), blockSize));
+    glBindBufferRange(GL_UNIFORM_BUFFER, BONE_PALETTE_UNIFORM_BINDING, allocation.buffer,
+        static_cast<GLintptr>(allocation.offset), static_cast<GLsizeiptr>(blockSize));
+}
 
 void RenderManager::Register(MeshRenderer* renderer)
 {
@@ -16,13 +119,31 @@ void RenderManager::Register(MeshRenderer* renderer)
 
 void RenderManager::Unregister(MeshRenderer* renderer)
 {
-    pendingRemoval.push_back(renderer);
+    //  ִ  ڽ ε صΰ ĭ  ( Ŵ ProcessQueues)
+    if (renderer->renderIndex >= 0)
+    {
+        renderers[renderer->renderIndex] = nullptr;
+        pendingRemoval.push_back(renderer->renderIndex);
+        renderer->renderIndex = -1;
+        return;
+    }
+
+    //  ߰  
+    auto it = std::find(pendingAddition.begin(), pendingAddition.end(), renderer);
+    if (it != pendingAddition.end())
+    {
+        *it = pendingAddition.back();
+        pendingAddition.pop_back();
+    }
 }
 
 void RenderManager::BeginFrame()
 {
     glClearColor(backGroundColor.x, backGroundColor.y, backGroundColor.z, backGroundColor.a);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    // ̹      GPU  о Ȯ
+    GetStreamBuffer()->BeginFrame();
 }
 
 void RenderManager::Render()
@@ -34,6 +155,32 @@ void RenderManager::Render()
 
     if (!cameraManager) return;
 
+    Uint64 startTicks = SDL_GetPerformanceCounter();
+
+    // GPU ð :        غ ͸ 
+    if (gpuTimerQueries[0] == 0)
+    {
+        glGenQueries(GPU_TIMER_QUERY_COUNT, gpuTimerQueries);
+    }
+    GLuint timerQuery = gpuTimerQueries[gpuTimerIndex];
+    if (gpuTimerIssued[gpuTimerIndex])
+    {
+        GLint available = 0;
+        glGetQueryObjectiv(timerQuery, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (available)
+        {
+            GLuint64 elapsedNs = 0;
+            glGetQueryObjectui64v(timerQuery, GL_QUERY_RESULT, &elapsedNs);
+            gpuRenderMs = static_cast<float>(elapsedNs) / 1000000.0f;
+        }
+    }
+    glBeginQuery(GL_TIME_ELAPSED, timerQuery);
+
+    UploadFrameUniforms();
+    UploadLightBuffer();
+    UpdateRendererBounds();
+    occlusionMs = 0.0f;
+
     //   /׽Ʈ 
     glDepthMask(GL_TRUE);
     glEnable(GL_DEPTH_TEST);
@@ -64,21 +211,33 @@ void RenderManager::Render()
         //  ۸ ʱȭ
         glClear(GL_DEPTH_BUFFER_BIT);
 
+        if (useClustering)
+        {
+            UploadClusterBuffers(camera, glm::vec4(vp.x * static_cast<float>(windowWidth), vp.y * static_cast<float>(windowHeight),
+                vp.z * static_cast<float>(windowWidth), vp.w * static_cast<float>(windowHeight)));
+        }
+
+        UploadCameraUniforms(camera);
+
+        //  ī޶  ο    ( н   )
+        BuildRenderQueue(camera);
+
         //  ü  ī޶  
         if (lights.empty())
         {
             //    ü ׸
-            for (MeshRenderer* renderer : renderers)
-            {
-                renderer->Render(camera, nullptr);
-            }
+            SubmitRenderQueue(camera, nullptr, LightingPass::PerLight);
         }
         else
         {
+            // Ƽ Ʈ: MULTI_LIGHT   ġ ù н   ϰ,
+            //  ʴ ̴ ó   н ׸
+            bool multiLight = enableMultiLight && lightBufferBound;
             int i = 0;
             for (Light* light : lights)
             {
                 if (!light) continue;
+                if (i > 0 && multiLight && !hasFallbackBatches) break;
 
                 // ù °  ƴ ,   Ȱȭ
                 if (i > 0)
@@ -91,10 +250,12 @@ void RenderManager::Render()
                 }
 
                 //    ޾  ü 
-                for (MeshRenderer* renderer : renderers)
+                LightingPass lightingPass = LightingPass::PerLight;
+                if (multiLight)
                 {
-                    renderer->Render(camera, light);
+                    lightingPass = (i == 0) ? LightingPass::MultiLight : LightingPass::FallbackOnly;
                 }
+                SubmitRenderQueue(camera, light, lightingPass);
 
                 //   ߴٸ,  ī޶ 並  ¸  
                 if (i > 0)
@@ -110,27 +271,1017 @@ void RenderManager::Render()
         //   ,  ̳ UI   Ʈ ü ȭ ǵ
         glViewport(0, 0, windowWidth, windowHeight);
     }
+
+    glEndQuery(GL_TIME_ELAPSED);
+    gpuTimerIssued[gpuTimerIndex] = true;
+    gpuTimerIndex = (gpuTimerIndex + 1) % GPU_TIMER_QUERY_COUNT;
+    cpuRenderMs = static_cast<float>(SDL_GetPerformanceCounter() - startTicks) * 1000.0f / static_cast<float>(SDL_GetPerformanceFrequency());
+    lastCullingMs = cullingMs;
+    lastOcclusionMs = occlusionMs;
+}
+
+void RenderManager::UploadFrameUniforms()
+{
+    uint64_t ticks = SDL_GetTicks();
+    float frameSeconds = lastFrameTicks != 0 ? static_cast<float>(ticks - lastFrameTicks) / 1000.0f : 0.0f;
+    lastFrameTicks = ticks;
+    elapsedSeconds += frameSeconds;
+
+    FrameUniforms frame;
+    frame.time = glm::vec4(elapsedSeconds, frameSeconds, 0.0f, 0.0f);
+    frame.params = glm::vec4(exposure, 0.0f, 0.0f, 0.0f);
+    StreamRingBuffer& ring = *GetStreamBuffer();
+    UpdateUniformBuffer(ring, FRAME_UNIFORM_BINDING, &frame, sizeof(frame));
+
+    // Űϴ ο찡 ڱ  ٽ εϱ  BonePalette  ġ  
+    StreamAllocation bonePalette = ring.Allocate(DEFAULT_BONE_PALETTE_BYTES, ring.GetUniformAlignment());
+    if (bonePalette.IsValid())
+    {
+        std::memset(bonePalette.data, 0, DEFAULT_BONE_PALETTE_BYTES);
+        glBindBufferRange(GL_UNIFORM_BUFFER, BONE_PALETTE_UNIFORM_BINDING, bonePalette.buffer,
+            static_cast<GLintptr>(bonePalette.offset), static_cast<GLsizeiptr>(DEFAULT_BONE_PALETTE_BYTES));
+    }
+}
+
+void RenderManager::UploadCameraUniforms(Camera* camera)
+{
+    CameraUniforms cameraUniforms;
+    cameraUniforms.view = camera->GetViewMatrix();
+    cameraUniforms.projection = camera->GetProjectionMatrix();
+    cameraUniforms.position = glm::vec4(camera->GetCameraPosition(), 1.0f);
+    UpdateUniformBuffer(*GetStreamBuffer(), CAMERA_UNIFORM_BINDING, &cameraUniforms, sizeof(cameraUniforms));
+}
+
+void RenderManager::UploadPassLightUniforms(Light* light)
+{
+    //    0  ( 0 Ɽ ȭ  Ƿ)
+    GPULight passLight;
+    passLight.positionType = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+    passLight.color = glm::vec4(0.0f);
+    passLight.intensity = glm::vec4(0.0f);
+    passLight.params = glm::vec4(0.0f);
+    if (light)
+    {
+        bool isPoint = (light->GetType() == LightType::Point);
+        if (isPoint)
+        {
+            passLight.positionType = glm::vec4(light->GetOwner()->transform.GetPosition() + light->GetOffsetForPointL(), 1.0f);
+        }
+        else
+        {
+            passLight.positionType = glm::vec4(light->GetDirection(), 0.0f);
+        }
+        passLight.color = glm::vec4(light->GetColor(), 1.0f);
+        passLight.intensity = glm::vec4(light->GetAmbientIntensity(), light->GetDiffuseIntensity(),
+            light->GetSpecularIntensity(), static_cast<float>(light->GetShininess()));
+        passLight.params = glm::vec4(isPoint ? light->GetRange() : 0.0f, 0.0f, 0.0f, 0.0f);
+    }
+    UpdateUniformBuffer(*GetStreamBuffer(), PASS_LIGHT_UNIFORM_BINDING, &passLight, sizeof(passLight));
+}
+
+void RenderManager::UploadLightBuffer()
+{
+    gpuLights.clear();
+    clusterLightSpheres.clear();
+
+    // ݰ ִ  ʿ, (Ɽ, ݰ  ) ʿ 
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        bool bounded = (pass == 0);
+        for (Light* light : lights)
+        {
+            if (!light) continue;
+
+            bool isPoint = (light->GetType() == LightType::Point);
+            if ((isPoint && light->GetRange() > 0.0f) != bounded) continue;
+
+            GPULight gpuLight;
+            if (isPoint)
+            {
+                gpuLight.positionType = glm::vec4(light->GetOwner()->transform.GetPosition() + light->GetOffsetForPointL(), 1.0f);
+            }
+            else
+            {
+                gpuLight.positionType = glm::vec4(light->GetDirection(), 0.0f);
+            }
+            gpuLight.color = glm::vec4(light->GetColor(), 1.0f);
+            gpuLight.intensity = glm::vec4(light->GetAmbientIntensity(), light->GetDiffuseIntensity(),
+                light->GetSpecularIntensity(), static_cast<float>(light->GetShininess()));
+            gpuLight.params = glm::vec4(isPoint ? light->GetRange() : 0.0f, 0.0f, 0.0f, 0.0f);
+            gpuLights.push_back(gpuLight);
+
+            if (bounded)
+            {
+                clusterLightSpheres.push_back(glm::vec4(glm::vec3(gpuLight.positionType), light->GetRange()));
+            }
+        }
+    }
+    useClustering = enableMultiLight && enableClustering && !clusterLightSpheres.empty();
+
+    // (ivec4, x =  , y = ݰ ִ  ) +  迭
+    glm::ivec4 header(static_cast<int>(gpuLights.size()), static_cast<int>(clusterLightSpheres.size()), 0, 0);
+    size_t bytes = sizeof(header) + gpuLights.size() * sizeof(GPULight);
+    StreamRingBuffer& ring = *GetStreamBuffer();
+    StreamAllocation allocation = ring.Allocate(bytes, ring.GetStorageAlignment());
+    lightBufferBound = allocation.IsValid();
+    if (!lightBufferBound)
+    {
+        return;
+    }
+    unsigned char* data = static_cast<unsigned char*>(allocation.data);
+    std::memcpy(data, &header, sizeof(header));
+    if (!gpuLights.empty())
+    {
+        std::memcpy(data + sizeof(header), gpuLights.data(), gpuLights.size() * sizeof(GPULight));
+    }
+    glBindBufferRange(GL_SHADER_STORAGE_BUFFER, LIGHT_BUFFER_BINDING, allocation.buffer,
+        static_cast<GLintptr>(allocation.offset), static_cast<GLsizeiptr>(bytes));
+}
+
+void RenderManager::UploadClusterBuffers(Camera* camera, const glm::vec4& viewportPixels)
+{
+    ThreadManager* threadManager = Engine::GetInstance().GetThreadManager();
+    ClusterParallelFor parallelFor;
+    if (useClusterThreads && threadManager)
+    {
+        parallelFor = [threadManager](int count, const std::function<void(int, int)>& func)
+        {
+            threadManager->ParallelFor(count, 1, func);
+        };
+    }
+    lightClusters.Build(camera->GetViewMatrix(), camera->GetProjectionMatrix(), camera->GetNear(), camera->GetFar(),
+        clusterLightSpheres, parallelFor);
+
+    // ( ũ,   , Ʈ) + Ŭͺ ( ġ, )
+    struct ClusterHeader
+    {
+        glm::ivec4 dimensions;
+        glm::vec4 depth;
+        glm::vec4 viewport;
+    };
+    ClusterHeader header;
+    header.dimensions = glm::ivec4(lightClusters.GetDimensions(), 0);
+    header.depth = glm::vec4(camera->GetNear(), camera->GetFar(), lightClusters.GetSliceScale(), lightClusters.GetSliceBias());
+    header.viewport = viewportPixels;
+
+    const std::vector<glm::uvec2>& ranges = lightClusters.GetClusterRanges();
+    const std::vector<uint32_t>& indices = lightClusters.GetLightIndices();
+    size_t rangeBytes = ranges.size() * sizeof(glm::uvec2);
+    StreamRingBuffer& ring = *GetStreamBuffer();
+    StreamAllocation clusterAllocation = ring.Allocate(sizeof(header) + rangeBytes, ring.GetStorageAlignment());
+    //      ε ʵ ּ  ĭ Ҵ
+    size_t indexBytes = std::max(indices.size(), size_t(1)) * sizeof(uint32_t);
+    StreamAllocation indexAllocation = ring.Allocate(indexBytes, ring.GetStorageAlignment());
+    if (!clusterAllocation.IsValid() || !indexAllocation.IsValid())
+    {
+        return;
+    }
+
+    unsigned char* clusterData = static_cast<unsigned char*>(clusterAllocation.data);
+    std::memcpy(clusterData, &header, sizeof(header));
+    if (rangeBytes > 0)
+    {
+        std::memcpy(clusterData + sizeof(header), ranges.data(), rangeBytes);
+    }
+    if (!indices.empty())
+    {
+        std::memcpy(indexAllocation.data, indices.data(), indices.size() * sizeof(uint32_t));
+    }
+
+    glBindBufferRange(GL_SHADER_STORAGE_BUFFER, CLUSTER_BUFFER_BINDING, clusterAllocation.buffer,
+        static_cast<GLintptr>(clusterAllocation.offset), static_cast<GLsizeiptr>(sizeof(header) + rangeBytes));
+    glBindBufferRange(GL_SHADER_STORAGE_BUFFER, CLUSTER_INDEX_BUFFER_BINDING, indexAllocation.buffer,
+        static_cast<GLintptr>(indexAllocation.offset), static_cast<GLsizeiptr>(indexBytes));
+}
+
+void RenderManager::UpdateRendererBounds()
+{
+    Uint64 startTicks = SDL_GetPerformanceCounter();
+    cullingMs = 0.0f;
+    if (!enableFrustumCulling || useSpatialTreeCulling)
+    {
+        return;
+    }
+
+    rendererBounds.Resize(renderers.size());
+    for (size_t i = 0; i < renderers.size(); ++i)
+    {
+        AABB worldBounds;
+        if (renderers[i] && renderers[i]->ComputeWorldBounds(worldBounds) && worldBounds.IsValid())
+        {
+            rendererBounds.Set(i, worldBounds);
+        }
+        else
+        {
+            rendererBounds.SetInfinite(i);
+        }
+    }
+    cullingMs += static_cast<float>(SDL_GetPerformanceCounter() - startTicks) * 1000.0f / static_cast<float>(SDL_GetPerformanceFrequency());
+}
+
+void RenderManager::BuildRenderQueue(Camera* camera)
+{
+    renderQueue.Clear();
+
+    //       renderers ̹Ƿ  ٸ ø 
+    bool cull = enableFrustumCulling && (useSpatialTreeCulling || rendererBounds.GetCount() == renderers.size());
+    if (cull)
+    {
+        Uint64 startTicks = SDL_GetPerformanceCounter();
+        Frustum frustum(camera->GetProjectionMatrix() * camera->GetViewMatrix());
+        if (useSpatialTreeCulling)
+        {
+            // ObjectManager AABB Ʈ ̴ Ʈ ã ǥ
+            rendererVisible.assign(renderers.size(), 0);
+            spatialQueryResults.clear();
+            Engine::GetInstance().GetObjectManager()->QueryFrustum(frustum, spatialQueryResults);
+            for (Object* object : spatialQueryResults)
+            {
+                MeshRenderer* renderer = object ? object->GetComponent<MeshRenderer>() : nullptr;
+                if (renderer && renderer->renderIndex >= 0 && renderer->renderIndex < static_cast<int>(renderers.size()))
+                {
+                    rendererVisible[renderer->renderIndex] = 1;
+                }
+            }
+        }
+        else
+        {
+            frustum.CullBoxes(rendererBounds, rendererVisible, useSimdCulling);
+        }
+        cullingMs += static_cast<float>(SDL_GetPerformanceCounter() - startTicks) * 1000.0f / static_cast<float>(SDL_GetPerformanceFrequency());
+    }
+
+    if (enableOcclusionCulling)
+    {
+        if (!cull)
+        {
+            rendererVisible.assign(renderers.size(), 1);
+        }
+        ApplyOcclusionCulling(camera);
+        cull = true;
+    }
+
+    for (size_t i = 0; i < renderers.size(); ++i)
+    {
+        MeshRenderer* renderer = renderers[i];
+        if (!renderer) continue;
+        if (cull && rendererVisible[i] != 1)
+        {
+            if (rendererVisible[i] == 2) ++currentRenderStats.occludedObjects;
+            else ++currentRenderStats.culledObjects;
+            continue;
+        }
+        ++currentRenderStats.visibleObjects;
+        renderer->CollectDrawItems(renderQueue, camera, lodSettings);
+    }
+    if (sortRenderQueue)
+    {
+        renderQueue.Sort();
+    }
+    BuildDrawBatches();
+}
+
+void RenderManager::ApplyOcclusionCulling(Camera* camera)
+{
+    Uint64 startTicks = SDL_GetPerformanceCounter();
+    occlusionCuller.BeginFrame(camera->GetProjectionMatrix() * camera->GetViewMatrix());
+    for (size_t i = 0; i < renderers.size(); ++i)
+    {
+        if (renderers[i] && rendererVisible[i] == 1 && renderers[i]->IsOccluder())
+        {
+            renderers[i]->SubmitOccluder(occlusionCuller);
+        }
+    }
+    if (!occlusionCuller.HasOccluders())
+    {
+        occlusionMs += static_cast<float>(SDL_GetPerformanceCounter() - startTicks) * 1000.0f / static_cast<float>(SDL_GetPerformanceFrequency());
+        return;
+    }
+
+    ThreadManager* threadManager = Engine::GetInstance().GetThreadManager();
+    OcclusionParallelFor parallelFor;
+    if (useOcclusionThreads && threadManager)
+    {
+        parallelFor = [threadManager](int count, const std::function<void(int, int)>& func)
+        {
+            threadManager->ParallelFor(count, 1, func);
+        };
+    }
+    occlusionCuller.Rasterize(parallelFor);
+
+    //     谡  ״ , (BVH ) ü   
+    bool hasLinearBounds = rendererBounds.GetCount() == renderers.size() && enableFrustumCulling && !useSpatialTreeCulling;
+    for (size_t i = 0; i < renderers.size(); ++i)
+    {
+        if (!renderers[i] || rendererVisible[i] != 1)
+        {
+            continue;
+        }
+        AABB worldBounds;
+        if (hasLinearBounds)
+        {
+            glm::vec3 center(rendererBounds.centerX[i], rendererBounds.centerY[i], rendererBounds.centerZ[i]);
+            glm::vec3 extents(rendererBounds.extentX[i], rendererBounds.extentY[i], rendererBounds.extentZ[i]);
+            worldBounds = { center - extents, center + extents };
+        }
+        else if (!renderers[i]->ComputeWorldBounds(worldBounds))
+        {
+            continue;
+        }
+        // 踦    ׸(SetInfinite) 鿡  ׻ ̴  
+        if (!occlusionCuller.TestAABB(worldBounds))
+        {
+            rendererVisible[i] = 2;
+        }
+    }
+    occlusionMs += static_cast<float>(SDL_GetPerformanceCounter() - startTicks) * 1000.0f / static_cast<float>(SDL_GetPerformanceFrequency());
+}
+
+void RenderManager::BuildDrawBatches()
+{
+    const std::vector<DrawItem>& items = renderQueue.GetItems();
+    drawBatches.clear();
+    instanceData.clear();
+    hasFallbackBatches = false;
+
+    size_t index = 0;
+    while (index < items.size())
+    {
+        const DrawItem& first = items[index];
+        DrawBatch batch;
+        batch.firstItem = index;
+        batch.shader = first.shader;
+
+        //     Ʈ/̴/ؽó/ 带   ִ 
+        size_t end = index + 1;
+        Shader* instancedShader = (enableInstancing && first.renderer->CanInstance()) ? GetShaderVariant(first.shader, VARIANT_INSTANCED) : nullptr;
+        if (instancedShader)
+        {
+            while (end < items.size())
+            {
+                const DrawItem& next = items[end];
+                if (next.shader != first.shader || next.texture != first.texture
+                    || !RenderQueue::IsSameGeometry(next.mesh, first.mesh) || next.lod != first.lod
+                    || next.renderer->GetRenderMode() != first.renderer->GetRenderMode()
+                    || !next.renderer->CanInstance())
+                {
+                    break;
+                }
+                ++end;
+            }
+        }
+
+        batch.itemCount = static_cast<int>(end - index);
+        uint32_t variantFlags = 0;
+        // Ǯ ø ޽ô ϳ νϽ Ӽ ׷ ٸ Ʈ  ο ĥ  
+        bool indirectCandidate = useMultiDrawIndirect && instancedShader && first.mesh->IsPooled();
+        if (batch.itemCount > 1 || indirectCandidate)
+        {
+            variantFlags |= VARIANT_INSTANCED;
+            batch.instanced = true;
+            batch.shader = instancedShader;
+            batch.instanceOffset = instanceData.size() * sizeof(InstanceData);
+            for (size_t i = index; i < end; ++i)
+            {
+                InstanceData instance;
+                items[i].renderer->FillInstanceData(instance);
+                instanceData.push_back(instance);
+            }
+        }
+        if (enableMultiLight)
+        {
+            // Ŭ   ̴   ȸϴ MULTI_LIGHT  ׸
+            if (useClustering)
+            {
+                batch.multiLightShader = GetShaderVariant(first.shader, variantFlags | VARIANT_MULTI_LIGHT | VARIANT_CLUSTERED);
+            }
+            if (batch.multiLightShader == nullptr)
+            {
+                batch.multiLightShader = GetShaderVariant(first.shader, variantFlags | VARIANT_MULTI_LIGHT);
+            }
+        }
+        if (batch.multiLightShader == nullptr)
+        {
+            hasFallbackBatches = true;
+        }
+        drawBatches.push_back(batch);
+        index = end;
+    }
+
+    drawCommands.clear();
+    if (useMultiDrawIndirect)
+    {
+        MergeIndirectBatches();
+    }
+
+    // ī޶󸶴  ۿ   ϰ   н 
+    StreamRingBuffer& ring = *GetStreamBuffer();
+    instanceAllocation = StreamAllocation{};
+    commandAllocation = StreamAllocation{};
+    if (!instanceData.empty())
+    {
+        instanceAllocation = ring.Write(instanceData.data(), instanceData.size() * sizeof(InstanceData), 16);
+    }
+    if (!drawCommands.empty())
+    {
+        commandAllocation = ring.Write(drawCommands.data(), drawCommands.size() * sizeof(DrawElementsIndirectCommand), 16);
+    }
+}
+
+void RenderManager::MergeIndirectBatches()
+{
+    const std::vector<DrawItem>& items = renderQueue.GetItems();
+    mergedBatches.clear();
+
+    auto canMerge = [&](const DrawBatch& batch)
+    {
+        return batch.instanced && items[batch.firstItem].mesh->IsPooled();
+    };
+
+    size_t index = 0;
+    while (index < drawBatches.size())
+    {
+        const DrawBatch& first = drawBatches[index];
+        const DrawItem& firstItem = items[first.firstItem];
+        size_t end = index + 1;
+        if (canMerge(first))
+        {
+            //  Ű ̴/ؽó ̹Ƿ ĥ  ִ ġ   
+            while (end < drawBatches.size())
+            {
+                const DrawBatch& next = drawBatches[end];
+                const DrawItem& nextItem = items[next.firstItem];
+                if (!canMerge(next) || next.shader != first.shader || next.multiLightShader != first.multiLightShader
+                    || nextItem.texture != firstItem.texture
+                    || nextItem.renderer->GetRenderMode() != firstItem.renderer->GetRenderMode()
+                    || nextItem.mesh->GetPrimitivePattern() != firstItem.mesh->GetPrimitivePattern()
+                    || nextItem.mesh->GetVertexArray() != firstItem.mesh->GetVertexArray())
+                {
+                    break;
+                }
+                ++end;
+            }
+        }
+        if (end - index < 2)
+        {
+            mergedBatches.push_back(first);
+            index = end;
+            continue;
+        }
+
+        DrawBatch batch = first;
+        batch.indirect = true;
+        batch.firstCommand = drawCommands.size();
+        batch.commandCount = static_cast<int>(end - index);
+        batch.itemCount = 0;
+        for (size_t i = index; i < end; ++i)
+        {
+            const DrawBatch& source = drawBatches[i];
+            const DrawItem& item = items[source.firstItem];
+            const MeshLod lod = item.mesh->GetLod(item.lod);
+            DrawElementsIndirectCommand command;
+            command.count = lod.indexCount;
+            command.instanceCount = static_cast<uint32_t>(source.itemCount);
+            command.firstIndex = lod.firstIndex;
+            command.baseVertex = item.mesh->GetBaseVertex();
+            command.baseInstance = static_cast<uint32_t>(source.instanceOffset / sizeof(InstanceData));
+            drawCommands.push_back(command);
+            batch.itemCount += source.itemCount;
+        }
+        mergedBatches.push_back(batch);
+        index = end;
+    }
+    drawBatches.swap(mergedBatches);
+}
+
+Shader* RenderManager::GetShaderVariant(Shader* shader, uint32_t variantFlags)
+{
+    if (variantFlags == 0)
+    {
+        return shader;
+    }
+
+    auto key = std::make_pair(shader, variantFlags);
+    auto it = shaderVariants.find(key);
+    if (it != shaderVariants.end())
+    {
+        return it->second.get();
+    }
+
+    std::vector<std::string> defines = shader->GetDefines();
+    bool supported = true;
+    if (variantFlags & VARIANT_INSTANCED)
+    {
+        supported = supported && shader->SupportsDefine("INSTANCED");
+        defines.push_back("INSTANCED");
+    }
+    if (variantFlags & VARIANT_MULTI_LIGHT)
+    {
+        supported = supported && shader->SupportsDefine("MULTI_LIGHT");
+        defines.push_back("MULTI_LIGHT");
+    }
+    if (variantFlags & VARIANT_CLUSTERED)
+    {
+        supported = supported && shader->SupportsDefine("CLUSTERED");
+        defines.push_back("CLUSTERED");
+    }
+
+    //  ʰų Ͽ ϸ nullptr Ͽ ٽ õ ʰ ⺻ ̴ ׸
+    std::shared_ptr<Shader> variant;
+    if (supported)
+    {
+        variant = std::make_shared<Shader>(shader->GetVertexPath(), shader->GetFragmentPath(), defines);
+        if (!variant->IsValid())
+        {
+            variant = nullptr;
+        }
+    }
+    return shaderVariants.emplace(key, variant).first->second.get();
+}
+
+void RenderManager::SubmitRenderQueue(Camera* camera, Light* light, LightingPass lightingPass)
+{
+    UploadPassLightUniforms(light);
+
+    Shader* currentShader = nullptr;
+    Texture* currentTexture = nullptr;
+    VertexArray* currentVertexArray = nullptr;
+    RenderMode currentRenderMode = RenderMode::Fill;
+
+    const std::vector<DrawItem>& items = renderQueue.GetItems();
+    if (!drawCommands.empty())
+    {
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commandAllocation.buffer);
+    }
+    for (const DrawBatch& batch : drawBatches)
+    {
+        const DrawItem& item = items[batch.firstItem];
+
+        Shader* shader = batch.shader;
+        if (batch.multiLightShader)
+        {
+            if (lightingPass == LightingPass::FallbackOnly)
+            {
+                continue; // ù н ̹   
+            }
+            if (lightingPass == LightingPass::MultiLight)
+            {
+                shader = batch.multiLightShader;
+            }
+        }
+
+        if (shader != currentShader)
+        {
+            shader->Bind();
+            ApplyPassUniforms(shader, camera);
+            currentShader = shader;
+            ++currentRenderStats.shaderBinds;
+        }
+        else
+        {
+            ++currentRenderStats.skippedBinds;
+        }
+
+        // ؽó  ο useTexture = 0 ̹Ƿ  ؽó εǾ ־ 
+        if (item.texture)
+        {
+            if (item.texture != currentTexture)
+            {
+                item.texture->Bind(0);
+                currentTexture = item.texture;
+                ++currentRenderStats.textureBinds;
+            }
+            else
+            {
+                ++currentRenderStats.skippedBinds;
+            }
+        }
+
+        // ̾  
+        RenderMode renderMode = item.renderer->GetRenderMode();
+        if (renderMode != currentRenderMode)
+        {
+            glPolygonMode(GL_FRONT_AND_BACK, renderMode == RenderMode::Wireframe ? GL_LINE : GL_FILL);
+            currentRenderMode = renderMode;
+        }
+
+        VertexArray* vertexArray = item.mesh->GetVertexArray();
+        if (vertexArray != currentVertexArray)
+        {
+            vertexArray->Bind();
+            currentVertexArray = vertexArray;
+            ++currentRenderStats.vertexArrayBinds;
+        }
+        else
+        {
+            ++currentRenderStats.skippedBinds;
+        }
+
+        // õ LOD ܰ ε  ( ܰ谡  ε ۿ ̾ , Ǯ ޽ô baseVertex  ׸)
+        // ε  VAO(Ǯ) ϳ̹Ƿ  ġ ȿ 
+        const MeshLod lod = item.mesh->GetLod(item.lod);
+        const GLenum indexType = vertexArray->GetIndexType();
+        const void* lodOffset = reinterpret_cast<const void*>(static_cast<uintptr_t>(lod.firstIndex) * vertexArray->GetIndexBuffer().GetIndexSize());
+        const GLenum primitive = static_cast<GLenum>(item.mesh->GetPrimitivePattern());
+
+        if (batch.instanced)
+        {
+            //  // νϽ Ӽ ޵ǹǷ ؽó  θ 
+            int useTextureLocation = shader->GetUniformLocation(USE_TEXTURE_UNIFORM);
+            if (useTextureLocation != -1)
+            {
+                shader->SetUniform1i(useTextureLocation, item.texture ? 1 : 0);
+                if (item.texture)
+                {
+                    shader->SetUniform1i(shader->GetUniformLocation(TEXTURE_UNIFORM), 0);
+                }
+            }
+            //  ο ɸ baseInstance б  ġ ϹǷ ̹ ī޶  ó 
+            GLintptr instanceOffset = static_cast<GLintptr>(instanceAllocation.offset) + (batch.indirect ? 0 : static_cast<GLintptr>(batch.instanceOffset));
+            vertexArray->BindInstanceBuffer(instanceAllocation.buffer, instanceOffset, sizeof(InstanceData), {
+                // layout 6~9: model (mat4 = vec4 4)
+                {.dimension = 4, .layoutLocation = 6, .relativeOffset = (GLuint)offsetof(InstanceData, model) },
+                {.dimension = 4, .layoutLocation = 7, .relativeOffset = (GLuint)(offsetof(InstanceData, model) + sizeof(glm::vec4)) },
+                {.dimension = 4, .layoutLocation = 8, .relativeOffset = (GLuint)(offsetof(InstanceData, model) + sizeof(glm::vec4) * 2) },
+                {.dimension = 4, .layoutLocation = 9, .relativeOffset = (GLuint)(offsetof(InstanceData, model) + sizeof(glm::vec4) * 3) },
+                // layout 10: color, layout 11: metallic/roughness
+                {.dimension = 4, .layoutLocation = 10, .relativeOffset = (GLuint)offsetof(InstanceData, color) },
+                {.dimension = 4, .layoutLocation = 11, .relativeOffset = (GLuint)offsetof(InstanceData, material) }
+                });
+            if (batch.indirect)
+            {
+                const void* commandOffset = reinterpret_cast<const void*>(commandAllocation.offset + batch.firstCommand * sizeof(DrawElementsIndirectCommand));
+                glMultiDrawElementsIndirect(primitive, indexType, commandOffset, batch.commandCount, 0);
+                ++currentRenderStats.multiDrawCalls;
+                currentRenderStats.indirectCommands += batch.commandCount;
+            }
+            else
+            {
+                glDrawElementsInstancedBaseVertex(primitive, static_cast<GLsizei>(lod.indexCount), indexType, lodOffset,
+                    batch.itemCount, item.mesh->GetBaseVertex());
+            }
+            ++currentRenderStats.instancedDrawCalls;
+            currentRenderStats.instancedObjects += batch.itemCount;
+        }
+        else
+        {
+            item.renderer->ApplyDrawUniforms(shader);
+            glDrawElementsBaseVertex(primitive, static_cast<GLsizei>(lod.indexCount), indexType, const_cast<void*>(lodOffset), item.mesh->GetBaseVertex());
+        }
+        ++currentRenderStats.drawCalls;
+
+        //  ġ ۸ ޽/LOD ٸǷ   
+        for (size_t i = batch.firstItem; i < batch.firstItem + static_cast<size_t>(batch.itemCount); ++i)
+        {
+            const DrawItem& countedItem = items[i];
+            const MeshLod countedLod = batch.indirect ? countedItem.mesh->GetLod(countedItem.lod) : lod;
+            if (countedItem.mesh->GetPrimitivePattern() == PrimitivePattern::Triangles)
+            {
+                currentRenderStats.submittedTriangles += static_cast<int>(countedLod.indexCount / 3);
+            }
+            ++currentRenderStats.lodDraws[std::clamp(countedItem.lod, 0, Mesh::MAX_LOD_LEVELS - 1)];
+        }
+    }
+
+    //  
+    if (currentVertexArray)
+    {
+        currentVertexArray->UnBind();
+    }
+    if (!drawCommands.empty())
+    {
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    }
+    if (currentRenderMode == RenderMode::Wireframe)
+    {
+        glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+    }
+    if (currentTexture)
+    {
+        currentTexture->Unbind();
+    }
+}
+
+void RenderManager::ApplyPassUniforms(Shader* shader, Camera* camera)
+{
+    // ī޶//  ۷ ϹǷ,   Ϲ   ̴  
+    //   ġ -1̸ glUniform* -1 ϹǷ  Ȯ 
+    shader->SetUniformMat4f(shader->GetUniformLocation(VIEW_UNIFORM), camera->GetViewMatrix());
+    shader->SetUniformMat4f(shader->GetUniformLocation(PROJECTION_UNIFORM), camera->GetProjectionMatrix());
+    shader->SetUniformVec3(shader->GetUniformLocation(VIEW_POS_UNIFORM), camera->GetCameraPosition());
+
+    // ̴ IBL   ִٸ  ȣ 
+    shader->SetUniform1i(shader->GetUniformLocation(IRRADIANCE_MAP_UNIFORM), static_cast<int>(TextureSlot::IBL_IRRADIANCE));
+    shader->SetUniform1i(shader->GetUniformLocation(PREFILTER_MAP_UNIFORM), static_cast<int>(TextureSlot::IBL_PREFILTER));
+    shader->SetUniform1i(shader->GetUniformLocation(BRDF_LUT_UNIFORM), static_cast<int>(TextureSlot::IBL_BRDF_LUT));
 }
 
 void RenderManager::EndFrame()
 {
+    if (streamBuffer)
+    {
+        streamBuffer->EndFrame();
+    }
     SDL_GL_SwapWindow(Engine::GetInstance().GetSDLWindow());
+    lastRenderStats = currentRenderStats;
+    currentRenderStats = RenderQueueStats{};
+}
+
+void RenderManager::RenderQueueControllerForImGui()
+{
+    ImGui::Begin("Render Queue");
+
+    ImGui::Checkbox("Sort Draw Items", &sortRenderQueue);
+    ImGui::Checkbox("Instancing", &enableInstancing);
+    ImGui::Checkbox("Multi-Draw Indirect", &useMultiDrawIndirect);
+    ImGui::Checkbox("Single-pass Multi Light", &enableMultiLight);
+    ImGui::SliderFloat("Exposure", &exposure, 0.05f, 4.0f);
+    ImGui::Text("Render: CPU %.3f ms / GPU %.3f ms", cpuRenderMs, gpuRenderMs);
+    ImGui::Text("Lights: %zu", gpuLights.size());
+
+    if (ImGui::TreeNode("Clustered Lighting"))
+    {
+        ImGui::Checkbox("Enable Clustering", &enableClustering);
+        bool useSimd = lightClusters.GetUseSimd();
+        if (ImGui::Checkbox("SIMD Assignment", &useSimd))
+        {
+            lightClusters.SetUseSimd(useSimd);
+        }
+        ImGui::Checkbox("Threaded Assignment", &useClusterThreads);
+
+        const LightClusterStats& clusterStats = lightClusters.GetStats();
+        glm::ivec3 dimensions = lightClusters.GetDimensions();
+        ImGui::Text("Grid: %d x %d x %d (max %d lights per cluster)", dimensions.x, dimensions.y, dimensions.z, lightClusters.GetMaxLightsPerCluster());
+        ImGui::Text("Bounded Point Lights: %zu (%s)", clusterLightSpheres.size(), useClustering ? "clustered" : "not clustered");
+        ImGui::Text("Visible Lights: %d", clusterStats.clusteredLights);
+        ImGui::Text("Assignments: %d (max %d in a cluster)", clusterStats.assignments, clusterStats.maxLightsInCluster);
+        ImGui::Text("Overflowed Assignments: %d", clusterStats.overflowedAssignments);
+        ImGui::Text("Assignment Time: %.3f ms", clusterStats.buildMs);
+
+        ImGui::InputInt("Benchmark Lights", &lightClusterBenchmarkCount);
+        lightClusterBenchmarkCount = std::clamp(lightClusterBenchmarkCount, 1, 100000);
+        if (ImGui::Button("Run Assignment Benchmark"))
+        {
+            ThreadManager* threadManager = Engine::GetInstance().GetThreadManager();
+            lastLightClusterBenchmark = RunLightClusterBenchmark(lightClusterBenchmarkCount,
+                [threadManager](int count, const std::function<void(int, int)>& func)
+                {
+                    threadManager->ParallelFor(count, 1, func);
+                });
+        }
+        if (lastLightClusterBenchmark.lightCount > 0)
+        {
+            ImGui::Text("%d lights, %d assignments", lastLightClusterBenchmark.lightCount, lastLightClusterBenchmark.assignments);
+            ImGui::Text("Scalar   : %.3f ms", lastLightClusterBenchmark.scalarMs);
+            ImGui::Text("SIMD     : %.3f ms", lastLightClusterBenchmark.simdMs);
+            ImGui::Text("Threaded : %.3f ms", lastLightClusterBenchmark.parallelMs);
+            ImGui::Text("Brute Force: %.3f ms", lastLightClusterBenchmark.referenceMs);
+            ImGui::Text("Matches Brute Force: %s", lastLightClusterBenchmark.matchesReference ? "Yes" : "No");
+        }
+        ImGui::TreePop();
+    }
+
+    if (ImGui::TreeNode("Uniform Set Benchmark"))
+    {
+        // ο ϳ з (model, useTexture, color, metallic, roughness) ݺ 
+        ImGui::InputInt("Iterations", &uniformBenchmarkIterations);
+        uniformBenchmarkIterations = std::clamp(uniformBenchmarkIterations, 1, 10000000);
+        if (ImGui::Button("Run Uniform Benchmark"))
+        {
+            std::shared_ptr<Shader> benchmarkShader = GetShader("basic");
+            if (!benchmarkShader && !shaders.empty())
+            {
+                benchmarkShader = shaders.begin()->second;
+            }
+            if (benchmarkShader)
+            {
+                lastUniformBenchmark = RunUniformBenchmark(*benchmarkShader, uniformBenchmarkIterations);
+                glUseProgram(0);
+            }
+        }
+        if (lastUniformBenchmark.iterations > 0)
+        {
+            ImGui::Text("%d draws", lastUniformBenchmark.iterations);
+            ImGui::Text("String Lookup + Set : %.3f ms (lookup only %.3f ms)", lastUniformBenchmark.legacyMs, lastUniformBenchmark.legacyLookupMs);
+            ImGui::Text("Handle Lookup + Set : %.3f ms (lookup only %.3f ms)", lastUniformBenchmark.hashedMs, lastUniformBenchmark.hashedLookupMs);
+            ImGui::Text("Cached Location Set : %.3f ms", lastUniformBenchmark.cachedMs);
+        }
+        ImGui::TreePop();
+    }
+
+    if (ImGui::TreeNode("Frustum Culling"))
+    {
+        ImGui::Checkbox("Enable Culling", &enableFrustumCulling);
+        ImGui::Checkbox("SIMD Plane Tests", &useSimdCulling);
+        ImGui::Checkbox("Use Spatial Tree (BVH)", &useSpatialTreeCulling);
+        ImGui::Text("Visible Objects: %d", lastRenderStats.visibleObjects);
+        ImGui::Text("Culled Objects: %d", lastRenderStats.culledObjects);
+        ImGui::Text("Culling Time: %.3f ms", lastCullingMs);
+        ImGui::TreePop();
+    }
+
+    if (ImGui::TreeNode("Occlusion Culling"))
+    {
+        ImGui::Checkbox("Enable Occlusion Culling", &enableOcclusionCulling);
+        bool useSimdOcclusion = occlusionCuller.GetUseSimd();
+        if (ImGui::Checkbox("SIMD Rasterization", &useSimdOcclusion))
+        {
+            occlusionCuller.SetUseSimd(useSimdOcclusion);
+        }
+        ImGui::Checkbox("Threaded Tiles", &useOcclusionThreads);
+
+        const OcclusionStats& occlusionStats = occlusionCuller.GetStats();
+        ImGui::Text("Depth Buffer: %d x %d (%d x %d tiles)", occlusionCuller.GetWidth(), occlusionCuller.GetHeight(),
+            OcclusionCuller::TILE_WIDTH, OcclusionCuller::TILE_HEIGHT);
+        ImGui::Text("Occluders: %d (%d triangles, %d rasterized)", occlusionStats.occluders, occlusionStats.occluderTriangles, occlusionStats.rasterizedTriangles);
+        ImGui::Text("Occluded Objects: %d", lastRenderStats.occludedObjects);
+        ImGui::Text("Rasterize Time: %.3f ms", occlusionStats.rasterMs);
+        ImGui::Text("Total Time: %.3f ms", lastOcclusionMs);
+
+        //  ī޶   ( =  )
+        ImGui::Checkbox("Show Depth Buffer", &showOcclusionBuffer);
+        if (showOcclusionBuffer)
+        {
+            if (occlusionDebugTexture == 0)
+            {
+                glCreateTextures(GL_TEXTURE_2D, 1, &occlusionDebugTexture);
+                glTextureStorage2D(occlusionDebugTexture, 1, GL_R32F, occlusionCuller.GetWidth(), occlusionCuller.GetHeight());
+                glTextureParameteri(occlusionDebugTexture, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+                glTextureParameteri(occlusionDebugTexture, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+                GLint swizzle[4] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+                glTextureParameteriv(occlusionDebugTexture, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+            }
+            glTextureSubImage2D(occlusionDebugTexture, 0, 0, 0, occlusionCuller.GetWidth(), occlusionCuller.GetHeight(),
+                GL_RED, GL_FLOAT, occlusionCuller.GetDepthBuffer().data());
+            //  y = 0 Ʒ̹Ƿ  ǥ
+            ImGui::Image((ImTextureID)(intptr_t)occlusionDebugTexture,
+                ImVec2(static_cast<float>(occlusionCuller.GetWidth() * 2), static_cast<float>(occlusionCuller.GetHeight() * 2)),
+                ImVec2(0.0f, 1.0f), ImVec2(1.0f, 0.0f));
+        }
+
+        ImGui::InputInt("Benchmark Objects", &occlusionBenchmarkCount);
+        occlusionBenchmarkCount = std::clamp(occlusionBenchmarkCount, 1, 1000000);
+        if (ImGui::Button("Run Occlusion Benchmark"))
+        {
+            ThreadManager* threadManager = Engine::GetInstance().GetThreadManager();
+            lastOcclusionBenchmark = RunOcclusionBenchmark(occlusionBenchmarkCount,
+                [threadManager](int count, const std::function<void(int, int)>& func)
+                {
+                    threadManager->ParallelFor(count, 1, func);
+                });
+        }
+        if (lastOcclusionBenchmark.occludeeCount > 0)
+        {
+            ImGui::Text("%d occluder triangles, %d / %d objects occluded", lastOcclusionBenchmark.occluderTriangles,
+                lastOcclusionBenchmark.occludedCount, lastOcclusionBenchmark.occludeeCount);
+            ImGui::Text("Raster Scalar   : %.3f ms", lastOcclusionBenchmark.scalarRasterMs);
+            ImGui::Text("Raster SIMD     : %.3f ms", lastOcclusionBenchmark.simdRasterMs);
+            ImGui::Text("Raster Threaded : %.3f ms", lastOcclusionBenchmark.parallelRasterMs);
+            ImGui::Text("Occlusion Tests : %.3f ms", lastOcclusionBenchmark.testMs);
+            ImGui::Text("Matches Scalar: %s", lastOcclusionBenchmark.matchesReference ? "Yes" : "No");
+            ImGui::Text("Known Cases: %s", lastOcclusionBenchmark.knownCasesPassed ? "Passed" : "Failed");
+        }
+        ImGui::TreePop();
+    }
+
+    if (ImGui::TreeNode("Mesh LOD"))
+    {
+        ImGui::Checkbox("Enable LOD", &lodSettings.enabled);
+        ImGui::SliderInt("Force Level", &lodSettings.forcedLevel, -1, Mesh::MAX_LOD_LEVELS - 1);
+        for (int i = 0; i < Mesh::MAX_LOD_LEVELS - 1; ++i)
+        {
+            std::string label = "LOD " + std::to_string(i + 1) + " Below Screen Size";
+            ImGui::SliderFloat(label.c_str(), &lodSettings.screenThresholds[i], 0.001f, 1.0f, "%.3f", ImGuiSliderFlags_Logarithmic);
+        }
+        // ܰ ȭ ũⰡ ۾  
+        for (int i = 1; i < Mesh::MAX_LOD_LEVELS - 1; ++i)
+        {
+            lodSettings.screenThresholds[i] = std::min(lodSettings.screenThresholds[i], lodSettings.screenThresholds[i - 1]);
+        }
+        ImGui::SliderFloat("Hysteresis", &lodSettings.hysteresis, 0.0f, 0.5f);
+        ImGui::Text("Submitted Triangles: %d", lastRenderStats.submittedTriangles);
+        for (int i = 0; i < Mesh::MAX_LOD_LEVELS; ++i)
+        {
+            ImGui::Text("LOD %d Draws: %d", i, lastRenderStats.lodDraws[i]);
+        }
+        ImGui::TreePop();
+    }
+
+    if (ImGui::TreeNode("Import Optimization"))
+    {
+        //  ޽ø Ʈ  ȭ   ĳ ȿ (FIFO 16 ùķ̼,      )
+        std::vector<const Model*> listedModels;
+        for (const MeshRenderer* renderer : renderers)
+        {
+            const Model* model = renderer ? renderer->GetModel() : nullptr;
+            if (!model || std::find(listedModels.begin(), listedModels.end(), model) != listedModels.end())
+            {
+                continue;
+            }
+            listedModels.push_back(model);
+            for (size_t i = 0; i < model->GetMeshes().size(); ++i)
+            {
+                const Mesh& mesh = *model->GetMeshes()[i];
+                const MeshOptimizationStats& stats = mesh.GetOptimizationStats();
+                ImGui::Text("Model %zu / Mesh %zu: %d tris, %zu verts, %s indices", listedModels.size() - 1, i,
+                    mesh.GetIndicesCount() / 3, mesh.GetVertices().size(), mesh.GetIndexType() == GL_UNSIGNED_SHORT ? "16-bit" : "32-bit");
+                if (stats.optimized)
+                {
+                    ImGui::Text("  ACMR %.3f -> %.3f, ATVR %.3f -> %.3f, %zu overdraw clusters",
+                        stats.before.acmr, stats.after.acmr, stats.before.atvr, stats.after.atvr, stats.overdrawClusters);
+                }
+            }
+        }
+        ImGui::TreePop();
+    }
+
+    if (ImGui::TreeNode("Procedural Meshes"))
+    {
+        //  û   ׸ ǳʶ ( GetProceduralMesh)
+        size_t liveMeshes = 0;
+        for (const auto& [key, cached] : proceduralMeshes)
+        {
+            liveMeshes += cached.expired() ? 0 : 1;
+        }
+        ImGui::Text("Live Meshes: %zu (built %d for %d requests)", liveMeshes, proceduralMeshBuilds, proceduralMeshRequests);
+        for (const auto& [key, cached] : proceduralMeshes)
+        {
+            // ĳ     (lock  þ 1 )
+            std::shared_ptr<const Mesh> mesh = cached.lock();
+            if (!mesh)
+            {
+                continue;
+            }
+            ImGui::Text("Key %016llx: %zu verts, %d tris, %ld users", static_cast<unsigned long long>(key),
+                mesh->GetVertices().size(), mesh->GetIndicesCount() / 3, mesh.use_count() - 1);
+        }
+        ImGui::TreePop();
+    }
+
+    ImGui::Text("Draw Items: %zu", renderQueue.GetCount());
+    ImGui::Text("Draw Calls: %d", lastRenderStats.drawCalls);
+    ImGui::Text("Instanced Draw Calls: %d (%d objects)", lastRenderStats.instancedDrawCalls, lastRenderStats.instancedObjects);
+    ImGui::Text("Shader Binds: %d", lastRenderStats.shaderBinds);
+    ImGui::Text("Texture Binds: %d", lastRenderStats.textureBinds);
+    ImGui::Text("VAO Binds: %d", lastRenderStats.vertexArrayBinds);
+    ImGui::Text("Skipped Binds: %d", lastRenderStats.skippedBinds);
+    ImGui::Text("Multi-Draw Calls: %d (%d commands)", lastRenderStats.multiDrawCalls, lastRenderStats.indirectCommands);
+    for (int skinned = 0; skinned < 2; ++skinned)
+    {
+        for (int shortIndex = 0; shortIndex < 2; ++shortIndex)
+        {
+            const GeometryPool* pool = geometryPools[skinned][shortIndex].get();
+            if (!pool)
+            {
+                continue;
+            }
+            ImGui::Text("%s Pool (%s indices): %d meshes, vertices %zu / %zu, indices %zu / %zu (grown %d times)",
+                skinned ? "Skinned" : "Static", shortIndex ? "16-bit" : "32-bit",
+                pool->GetAllocationCount(), pool->GetUsedVertices(), pool->GetVertexCapacity(),
+                pool->GetUsedIndices(), pool->GetIndexCapacity(), pool->GetGrowCount());
+            //  İ CPU  Vertex( Ӽ float/int) ״ ÷    ũ
+            ImGui::Text("  Vertex Data: %.1f KB (%d B/vertex, %.1f KB as Vertex), Index Data: %.1f KB",
+                static_cast<float>(pool->GetUsedVertexBytes()) / 1024.0f, pool->GetVertexFormat().GetVertexSize(),
+                static_cast<float>(pool->GetUsedVertices() * sizeof(Vertex)) / 1024.0f,
+                static_cast<float>(pool->GetUsedIndices() * (shortIndex ? sizeof(uint16_t) : sizeof(unsigned int))) / 1024.0f);
+        }
+    }
+    if (streamBuffer)
+    {
+        // /SSBO/νϽ/ /        뷮
+        const StreamRingStats& ringStats = streamBuffer->GetStats();
+        ImGui::Text("Stream Ring: %.1f KB / frame (peak %.1f KB, segment %.1f KB), %d allocations, grown %d times",
+            static_cast<float>(ringStats.frameBytes) / 1024.0f, static_cast<float>(ringStats.peakFrameBytes) / 1024.0f,
+            static_cast<float>(ringStats.segmentSize) / 1024.0f, ringStats.frameAllocations, ringStats.growCount);
+        ImGui::Text("Fence Waits: %d this frame (%.3f ms), %d total", ringStats.frameFenceWaits, ringStats.fenceWaitMs, ringStats.totalFenceWaits);
+    }
+
+    ImGui::End();
 }
 
 void RenderManager::ProcessQueues()
 {
     if (!pendingRemoval.empty()) {
-        renderers.erase(
-            std::remove_if(renderers.begin(), renderers.end(),
-                [&](MeshRenderer* renderer) {
-            return std::find(pendingRemoval.begin(), pendingRemoval.end(), renderer) != pendingRemoval.end();
-        }),
-            renderers.end()
-        );
+        //  ε swap-and-pop: ó  ĭ ڿ ִ  ְ 
+        std::sort(pendingRemoval.begin(), pendingRemoval.end(), std::greater<int>());
+        for (int index : pendingRemoval)
+        {
+            MeshRenderer* last = renderers.back();
+            renderers[index] = last;
+            if (last)
+            {
+                last->renderIndex = index;
+            }
+            renderers.pop_back();
+        }
         pendingRemoval.clear();
     }
     if (!pendingAddition.empty()) {
-        renderers.insert(renderers.end(), pendingAddition.begin(), pendingAddition.end());
+        for (MeshRenderer* renderer : pendingAddition)
+        {
+            renderer->renderIndex = static_cast<int>(renderers.size());
+            renderers.push_back(renderer);
+        }
         pendingAddition.clear();
     }
 }
@@ -174,6 +1325,7 @@ std::shared_ptr<Texture> RenderManager::GetTexture(const std::string& name)
 void RenderManager::ResetShaders()
 {
     shaders.clear();
+    shaderVariants.clear();
 }
 
 void RenderManager::ResetTextures()
@@ -185,6 +1337,38 @@ void RenderManager::ResetAllResources()
 {
     ResetShaders();
     ResetTextures();
+
+    instanceAllocation = StreamAllocation{};
+    commandAllocation = StreamAllocation{};
+    streamBuffer.reset();
+    //  ִ ޽ð Ǯ ϰ ־ GL ۴ ؽƮ Բ 
+    proceduralMeshes.clear();
+    for (auto& poolsByIndexType : geometryPools)
+    {
+        for (std::shared_ptr<GeometryPool>& pool : poolsByIndexType)
+        {
+            if (pool)
+            {
+                pool->Release();
+                pool = nullptr;
+            }
+        }
+    }
+    lightBufferBound = false;
+    if (occlusionDebugTexture != 0)
+    {
+        glDeleteTextures(1, &occlusionDebugTexture);
+        occlusionDebugTexture = 0;
+    }
+    if (gpuTimerQueries[0] != 0)
+    {
+        glDeleteQueries(GPU_TIMER_QUERY_COUNT, gpuTimerQueries);
+        for (int i = 0; i < GPU_TIMER_QUERY_COUNT; ++i)
+        {
+            gpuTimerQueries[i] = 0;
+            gpuTimerIssued[i] = false;
+        }
+    }
 }
 
 void RenderManager::RegisterLight(Light* light)
@@ -0,0 +1,158 @@
+﻿#include "RenderQueue.hpp"
+#include "Mesh.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    constexpr int SHADER_BITS = 11;
+    constexpr int TEXTURE_BITS = 10;
+    constexpr int MESH_BITS = 16;
+    constexpr int DEPTH_BITS = 24;
+
+    constexpr uint64_t Mask(int bits) { return (uint64_t(1) << bits) - 1; }
+
+    uint64_t ToResourceKey(const void* resource) { return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(resource)); }
+
+    uint64_t ToMeshKey(const Mesh* mesh)
+    {
+        if (mesh && mesh->GetGeometryKey() != 0)
+        {
+            return mesh->GetGeometryKey();
+        }
+        return ToResourceKey(mesh);
+    }
+}
+
+void RenderQueue::Clear()
+{
+    items.clear();
+    shaderIds.clear();
+    textureIds.clear();
+    meshIds.clear();
+}
+
+bool RenderQueue::IsSameGeometry(const Mesh* a, const Mesh* b)
+{
+    return ToMeshKey(a) == ToMeshKey(b);
+}
+
+uint32_t RenderQueue::GetResourceId(std::unordered_map<uint64_t, uint32_t>& table, uint64_t resource, uint32_t maxId)
+{
+    if (resource == 0)
+    {
+        return 0;
+    }
+    auto it = table.find(resource);
+    if (it != table.end())
+    {
+        return it->second;
+    }
+    // 0은 '없음'으로 사용, 비트 수를 넘으면 마지막 번호를 공유 (정렬 품질만 떨어지고 결과는 동일)
+    uint32_t id = std::min(static_cast<uint32_t>(table.size()) + 1, maxId);
+    table.emplace(resource, id);
+    return id;
+}
+
+uint32_t RenderQueue::QuantizeDepth(float viewDepth)
+{
+    // 양수 float의 비트 패턴은 값의 크기 순서와 같으므로 상위 24비트를 그대로 사용
+    // -0과 NaN은 부호 비트가 깊이 칸 밖으로 넘치므로 비교로 0으로 만듦 (std::max는 -0/NaN을 그대로 돌려줌)
+    float depth = viewDepth > 0.0f ? viewDepth : 0.0f;
+    uint32_t bits;
+    std::memcpy(&bits, &depth, sizeof(bits));
+    return std::min(bits >> (32 - 1 - DEPTH_BITS), static_cast<uint32_t>(Mask(DEPTH_BITS)));
+}
+
+void RenderQueue::Add(RenderPass pass, bool transparent, float viewDepth, MeshRenderer* renderer, const Mesh* mesh, Shader* shader, Texture* texture, int lod)
+{
+    uint64_t shaderId = GetResourceId(shaderIds, ToResourceKey(shader), static_cast<uint32_t>(Mask(SHADER_BITS)));
+    uint64_t textureId = GetResourceId(textureIds, ToResourceKey(texture), static_cast<uint32_t>(Mask(TEXTURE_BITS)));
+    // 포인터(48비트 이하)와 지오메트리 키(63, 48~55비트) 모두 56~62비트를 쓰지 않으므로 LOD 단계를 그 자리에 넣음
+    uint64_t meshId = GetResourceId(meshIds, ToMeshKey(mesh) | (static_cast<uint64_t>(lod & 0x7F) << 56), static_cast<uint32_t>(Mask(MESH_BITS)));
+    uint64_t depth = QuantizeDepth(viewDepth);
+
+    uint64_t key = static_cast<uint64_t>(pass) << 62;
+    if (transparent)
+    {
+        key |= uint64_t(1) << 61;
+        key |= (Mask(DEPTH_BITS) - depth) << (SHADER_BITS + TEXTURE_BITS + MESH_BITS);
+        key |= shaderId << (TEXTURE_BITS + MESH_BITS);
+        key |= textureId << MESH_BITS;
+        key |= meshId;
+    }
+    else
+    {
+        key |= shaderId << (TEXTURE_BITS + MESH_BITS + DEPTH_BITS);
+        key |= textureId << (MESH_BITS + DEPTH_BITS);
+        key |= meshId << DEPTH_BITS;
+        key |= depth;
+    }
+
+    DrawItem item;
+    item.key = key;
+    item.renderer = renderer;
+    item.mesh = mesh;
+    item.shader = shader;
+    item.texture = texture;
+    item.lod = lod;
+    items.push_back(item);
+}
+
+void RenderQueue::Sort()
+{
+    size_t count = items.size();
+    if (count < 2)
+    {
+        return;
+    }
+
+    entries.resize(count);
+    entriesScratch.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        entries[i] = { items[i].key, static_cast<uint32_t>(i) };
+    }
+
+    // 8비트씩 8번 LSD 기수 정렬 (안정 정렬이므로 키가 같으면 등록 순서 유지)
+    // 히스토그램은 한 번에 모두 구하고, 모든 키의 해당 바이트가 같으면 그 자리는 건너뜀
+    uint32_t histograms[8][256] = {};
+    for (const SortEntry& entry : entries)
+    {
+        for (int digit = 0; digit < 8; ++digit)
+        {
+            ++histograms[digit][(entry.key >> (digit * 8)) & 0xFF];
+        }
+    }
+
+    SortEntry* source = entries.data();
+    SortEntry* destination = entriesScratch.data();
+    for (int digit = 0; digit < 8; ++digit)
+    {
+        uint32_t* histogram = histograms[digit];
+        if (histogram[(source[0].key >> (digit * 8)) & 0xFF] == count)
+        {
+            continue;
+        }
+
+        uint32_t offset = 0;
+        for (int bucket = 0; bucket < 256; ++bucket)
+        {
+            uint32_t bucketCount = histogram[bucket];
+            histogram[bucket] = offset;
+            offset += bucketCount;
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            destination[histogram[(source[i].key >> (digit * 8)) & 0xFF]++] = source[i];
+        }
+        std::swap(source, destination);
+    }
+
+    sortedItems.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        sortedItems[i] = items[source[i].index];
+    }
+    items.swap(sortedItems);
+}
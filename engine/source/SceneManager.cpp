@@ -3,6 +3,7 @@
 #include "ObjectManager.hpp"
 #include "RenderManager.hpp"
 #include "CameraManager.hpp"
+#include "ThreadManager.hpp"
 #include "Scene.hpp"
 #include <iostream>
 
@@ -91,6 +92,11 @@ void SceneManager::RenderMainMenuBar()
                 ChangeScene(SceneTag::MOCAP);
             }
 
+            if (ImGui::MenuItem("Light Stress"))
+            {
+                ChangeScene(SceneTag::LIGHT_STRESS);
+            }
+
             ImGui::Separator();
             if (ImGui::MenuItem("Exit"))
             {
@@ -99,10 +105,29 @@ void SceneManager::RenderMainMenuBar()
 
             ImGui::EndMenu();
         }
+
+        if (ImGui::BeginMenu("Debug"))
+        {
+            ImGui::MenuItem("Job System", nullptr, &showJobSystemWindow);
+            ImGui::MenuItem("Render Queue", nullptr, &showRenderQueueWindow);
+            ImGui::EndMenu();
+        }
         ImGui::EndMainMenuBar();
     }
 }
 
+void SceneManager::RenderDebugWindows()
+{
+    if (showJobSystemWindow)
+    {
+        Engine::GetInstance().GetThreadManager()->JobSystemControllerForImGui();
+    }
+    if (showRenderQueueWindow)
+    {
+        Engine::GetInstance().GetRenderManager()->RenderQueueControllerForImGui();
+    }
+}
+
 
 void SceneManager::Update(float dt)
 {
@@ -140,6 +165,7 @@ void SceneManager::Update(float dt)
         {
             ImGuiBeginFrame();
             RenderMainMenuBar();
+            RenderDebugWindows();
 
             ObjectManager* objectManager = Engine::GetInstance().GetObjectManager();
             RenderManager* renderManager = Engine::GetInstance().GetRenderManager();
@@ -8,16 +8,302 @@
 #include "imgui_impl_sdl3.h"
 
 #include <iostream>
+#include <future>
+#include <cmath>
+
+namespace
+{
+    //  尡 ϴ  ť ȣ (  = 0)
+    thread_local int currentQueueIndex = 0;
+    thread_local bool isWorkerThread = false;
+
+    float TicksToMs(Uint64 ticks)
+    {
+        return static_cast<float>(ticks) * 1000.0f / static_cast<float>(SDL_GetPerformanceFrequency());
+    }
+}
+
+ThreadManager::~ThreadManager()
+{
+    Stop();
+}
 
 void ThreadManager::Start()
 {
+    if (running)
+    {
+        return;
+    }
     running = true;
+
+    //  带  ھ ŭ Ŀ 
+    unsigned int hardwareThreads = std::thread::hardware_concurrency();
+    int workerCount = hardwareThreads > 1 ? static_cast<int>(hardwareThreads) - 1 : 1;
+
+    queues.clear();
+    for (int i = 0; i < workerCount + 1; ++i)
+    {
+        queues.push_back(std::make_unique<JobQueue>());
+    }
+    for (int i = 1; i <= workerCount; ++i)
+    {
+        workers.emplace_back(&ThreadManager::WorkerLoop, this, i);
+    }
+    std::cout << "[INFO] Job System | Workers: " << workerCount << std::endl;
 }
 
 void ThreadManager::Stop()
 {
-    running = false;
-    //  join  ִٸ ⼭ ó
+    if (!running)
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        running = false;
+    }
+    wakeCondition.notify_all();
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+    workers.clear();
+
+    //    忡  ó (ī͸ ٸ   ʵ)
+    while (TryRunJob(0)) {}
+}
+
+bool ThreadManager::IsWorkerThread() const
+{
+    return isWorkerThread;
+}
+
+JobSystemStats ThreadManager::GetStats() const
+{
+    JobSystemStats stats;
+    stats.executedJobs = executedJobs.load(std::memory_order_relaxed);
+    stats.stolenJobs = stolenJobs.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void ThreadManager::Schedule(std::function<void()> func, JobCounter* counter, JobCounter* dependency)
+{
+    if (counter)
+    {
+        counter->pending.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    if (dependency)
+    {
+        std::lock_guard<std::mutex> lock(dependency->continuationMutex);
+        if (!dependency->IsDone())
+        {
+            //  īͰ 0   FinishJob ť ־
+            dependency->continuations.push_back({ std::move(func), counter });
+            return;
+        }
+    }
+
+    Enqueue(Job{ std::move(func), counter });
+}
+
+void ThreadManager::Wait(JobCounter& counter)
+{
+    while (!counter.IsDone())
+    {
+        if (!TryRunJob(currentQueueIndex))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    //    尡 ī    
+    std::lock_guard<std::mutex> lock(counter.continuationMutex);
+}
+
+void ThreadManager::Enqueue(Job&& job)
+{
+    if (queues.empty())
+    {
+        // Ŀ   
+        job.func();
+        executedJobs.fetch_add(1, std::memory_order_relaxed);
+        FinishJob(job.counter);
+        return;
+    }
+
+    queues[currentQueueIndex]->Push(std::move(job));
+    queuedJobs.fetch_add(1, std::memory_order_release);
+    {
+        // Ŀ  ˻    ˸  ʵ    ħ
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+    wakeCondition.notify_one();
+}
+
+bool ThreadManager::TryRunJob(int queueIndex)
+{
+    if (queues.empty())
+    {
+        return false;
+    }
+
+    Job job;
+    bool found = queues[queueIndex]->Pop(job);
+    if (!found)
+    {
+        // ڱ ť  ٸ ť ʿ Ŀ
+        int queueCount = static_cast<int>(queues.size());
+        for (int offset = 1; offset < queueCount && !found; ++offset)
+        {
+            found = queues[(queueIndex + offset) % queueCount]->Steal(job);
+        }
+        if (found)
+        {
+            stolenJobs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    if (!found)
+    {
+        return false;
+    }
+
+    queuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+    job.func();
+    executedJobs.fetch_add(1, std::memory_order_relaxed);
+    FinishJob(job.counter);
+    return true;
+}
+
+void ThreadManager::FinishJob(JobCounter* counter)
+{
+    if (counter == nullptr)
+    {
+        return;
+    }
+    //   ƴϸ   
+    int pending = counter->pending.load(std::memory_order_acquire);
+    while (pending > 1)
+    {
+        if (counter->pending.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel))
+        {
+            return;
+        }
+    }
+
+    // 0  Ҵ  ȿ ó (Wait   ģ  ȯϹǷ,   īͰ ҸǾ )
+    std::vector<JobCounter::Continuation> ready;
+    {
+        std::lock_guard<std::mutex> lock(counter->continuationMutex);
+        if (counter->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            ready.swap(counter->continuations);
+        }
+    }
+    for (JobCounter::Continuation& continuation : ready)
+    {
+        Enqueue(Job{ std::move(continuation.func), continuation.counter });
+    }
+}
+
+void ThreadManager::WorkerLoop(int queueIndex)
+{
+    currentQueueIndex = queueIndex;
+    isWorkerThread = true;
+
+    while (running)
+    {
+        if (TryRunJob(queueIndex))
+        {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wakeCondition.wait(lock, [this]() { return !running || queuedJobs.load(std::memory_order_acquire) > 0; });
+    }
+}
+
+JobBenchmarkResult ThreadManager::RunJobBenchmark(int jobCount)
+{
+    JobBenchmarkResult result;
+    result.jobCount = jobCount;
+
+    // ٸ  巯   ۾ 
+    std::vector<float> output(static_cast<size_t>(jobCount), 0.0f);
+    auto work = [&output](int index)
+    {
+        float value = 0.0f;
+        for (int i = 0; i < 64; ++i)
+        {
+            value += std::sqrt(static_cast<float>(index + i));
+        }
+        output[index] = value;
+    };
+
+    Uint64 startTicks = SDL_GetPerformanceCounter();
+    {
+        JobCounter counter;
+        for (int i = 0; i < jobCount; ++i)
+        {
+            Schedule([&work, i]() { work(i); }, &counter);
+        }
+        Wait(counter);
+    }
+    result.jobSystemMs = TicksToMs(SDL_GetPerformanceCounter() - startTicks);
+
+    startTicks = SDL_GetPerformanceCounter();
+    ParallelFor(jobCount, 1, [&work](int begin, int end)
+    {
+        for (int i = begin; i < end; ++i)
+        {
+            work(i);
+        }
+    });
+    result.parallelForMs = TicksToMs(SDL_GetPerformanceCounter() - startTicks);
+
+    startTicks = SDL_GetPerformanceCounter();
+    {
+        std::vector<std::future<void>> futures;
+        futures.reserve(static_cast<size_t>(jobCount));
+        for (int i = 0; i < jobCount; ++i)
+        {
+            futures.push_back(std::async(std::launch::async, [&work, i]() { work(i); }));
+        }
+        for (std::future<void>& future : futures)
+        {
+            future.get();
+        }
+    }
+    result.asyncMs = TicksToMs(SDL_GetPerformanceCounter() - startTicks);
+
+    return result;
+}
+
+void ThreadManager::JobSystemControllerForImGui()
+{
+    ImGui::Begin("Job System");
+
+    JobSystemStats stats = GetStats();
+    ImGui::Text("Workers: %d", GetWorkerCount());
+    ImGui::Text("Executed Jobs: %llu", stats.executedJobs);
+    ImGui::Text("Stolen Jobs: %llu", stats.stolenJobs);
+    ImGui::Text("Queued Jobs: %d", queuedJobs.load());
+
+    ImGui::Separator();
+    ImGui::SliderInt("Job Count", &benchmarkJobCount, 100, 10000);
+    if (ImGui::Button("Run Benchmark"))
+    {
+        lastBenchmark = RunJobBenchmark(benchmarkJobCount);
+    }
+    if (lastBenchmark.jobCount > 0)
+    {
+        ImGui::Text("Jobs: %d", lastBenchmark.jobCount);
+        ImGui::Text("Job System  : %.3f ms", lastBenchmark.jobSystemMs);
+        ImGui::Text("ParallelFor : %.3f ms", lastBenchmark.parallelForMs);
+        ImGui::Text("std::async  : %.3f ms", lastBenchmark.asyncMs);
+    }
+
+    ImGui::End();
 }
 
 void ThreadManager::ProcessEvents()
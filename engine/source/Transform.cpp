@@ -0,0 +1,158 @@
+#include "Transform.hpp"
+#include <algorithm>
+
+Transform::~Transform()
+{
+    // 자식은 최상위로 분리하고, 부모의 자식 목록에서 자신을 제거
+    for (Transform* child : children)
+    {
+        child->parent = nullptr;
+        child->worldDirty = true;
+    }
+    children.clear();
+    SetParent(nullptr);
+}
+
+void Transform::SetParent(Transform* newParent)
+{
+    if (newParent == parent || newParent == this)
+    {
+        return;
+    }
+
+    // 자신의 자손을 부모로 지정하면 순환이 생기므로 무시
+    for (Transform* ancestor = newParent; ancestor != nullptr; ancestor = ancestor->parent)
+    {
+        if (ancestor == this)
+        {
+            return;
+        }
+    }
+
+    if (parent)
+    {
+        auto it = std::find(parent->children.begin(), parent->children.end(), this);
+        if (it != parent->children.end())
+        {
+            parent->children.erase(it);
+        }
+    }
+
+    parent = newParent;
+    if (parent)
+    {
+        parent->children.push_back(this);
+    }
+    worldDirty = true;
+    hierarchyVersion.fetch_add(1, std::memory_order_relaxed);
+}
+
+int Transform::GetDepth() const
+{
+    int depth = 0;
+    for (const Transform* ancestor = parent; ancestor != nullptr; ancestor = ancestor->parent)
+    {
+        ++depth;
+    }
+    return depth;
+}
+
+bool Transform::UpdateWorldMatrixFromParent() const
+{
+    bool parentChanged = parent && parent->worldVersion != parentVersion;
+    if (!localDirty && !worldDirty && !parentChanged)
+    {
+        return false;
+    }
+
+    if (localDirty)
+    {
+        localMatrix = ComposeTransformMatrix(position, rotation, scale);
+        localDirty = false;
+    }
+
+    if (parent)
+    {
+        worldMatrix = parent->worldMatrix * localMatrix;
+        parentVersion = parent->worldVersion;
+    }
+    else
+    {
+        worldMatrix = localMatrix;
+    }
+    worldDirty = false;
+    ++worldVersion;
+    return true;
+}
+
+glm::mat4 Transform::ComputeModelMatrix() const
+{
+    if (!IsDirty())
+    {
+        return worldMatrix;
+    }
+    glm::mat4 local = localDirty ? ComposeTransformMatrix(position, rotation, scale) : localMatrix;
+    return parent ? parent->ComputeModelMatrix() * local : local;
+}
+
+void Transform::UpdateWorldMatrix() const
+{
+    // 일괄 갱신 이전에 조회된 경우: 바뀐 조상부터 차례로 갱신
+    if (parent && parent->IsDirty())
+    {
+        parent->UpdateWorldMatrix();
+    }
+    UpdateWorldMatrixFromParent();
+}
+
+int Transform::UpdateWorldMatrices(const std::vector<Transform*>& sortedTransforms, BatchScratch& scratch)
+{
+    // 1. 로컬 값이 바뀐 Transform만 성분별 배열로 모아 SIMD 커널로 로컬 행렬 계산
+    scratch.localDirtyTransforms.clear();
+    for (const Transform* transform : sortedTransforms)
+    {
+        if (transform->localDirty)
+        {
+            scratch.localDirtyTransforms.push_back(transform);
+        }
+    }
+
+    size_t dirtyCount = scratch.localDirtyTransforms.size();
+    if (dirtyCount > 0)
+    {
+        scratch.streams.Resize(dirtyCount);
+        for (size_t i = 0; i < dirtyCount; ++i)
+        {
+            const Transform* transform = scratch.localDirtyTransforms[i];
+            scratch.streams.Set(i, transform->position, transform->rotation, transform->scale);
+        }
+        scratch.localMatrices.resize(dirtyCount);
+        ComposeTransformMatrices(scratch.streams, 0, dirtyCount, scratch.localMatrices.data());
+
+        for (size_t i = 0; i < dirtyCount; ++i)
+        {
+            const Transform* transform = scratch.localDirtyTransforms[i];
+            transform->localMatrix = scratch.localMatrices[i];
+            transform->localDirty = false;
+            transform->worldDirty = true;
+        }
+    }
+
+    // 2. 부모가 먼저 갱신되므로 자식은 부모의 캐시된 월드 행렬만 사용
+    int updated = 0;
+    scratch.changedIndices.clear();
+    for (size_t i = 0; i < sortedTransforms.size(); ++i)
+    {
+        const Transform* transform = sortedTransforms[i];
+        if (transform->UpdateWorldMatrixFromParent())
+        {
+            ++updated;
+        }
+        if (transform->worldVersion != transform->reportedWorldVersion)
+        {
+            transform->reportedWorldVersion = transform->worldVersion;
+            scratch.changedIndices.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    return updated;
+}
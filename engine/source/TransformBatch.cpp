@@ -0,0 +1,496 @@
+﻿#include "TransformBatch.hpp"
+#include <gtc/matrix_transform.hpp>
+#include <gtc/quaternion.hpp>
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <random>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define TRANSFORM_SIMD_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+// MSVC는 /arch 옵션 없이도 AVX2 내장 함수를 사용할 수 있음
+#define TRANSFORM_TARGET_AVX2
+#else
+#define TRANSFORM_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#else
+#define TRANSFORM_SIMD_X86 0
+#endif
+
+namespace
+{
+    constexpr float PI = 3.14159265358979f;
+    constexpr float HALF_PI = 1.57079632679490f;
+    constexpr float TWO_PI = 6.28318530717959f;
+    constexpr float INV_TWO_PI = 0.159154943091895f;
+    constexpr float DEG_TO_HALF_RAD = 3.14159265358979f / 360.0f; // 도 -> 라디안의 절반 (쿼터니언용)
+
+    // sin: x * (1 + x^2 * (S0 + x^2 * (S1 + ...))), cos: 1 + x^2 * (C0 + x^2 * (C1 + ...)), |x| <= pi/2
+    constexpr float SIN0 = -0.16666667f, SIN1 = 0.0083333310f, SIN2 = -0.00019840874f, SIN3 = 2.7525562e-06f, SIN4 = -2.3889859e-08f;
+    constexpr float COS0 = -0.5f, COS1 = 0.041666638f, COS2 = -0.0013888378f, COS3 = 2.4760495e-05f, COS4 = -2.6051615e-07f;
+
+    std::atomic<int> activeLevel{ -1 }; // -1이면 아직 지정되지 않음 (지원 수준 사용)
+
+    float TicksToMs(Uint64 ticks)
+    {
+        return static_cast<float>(ticks) * 1000.0f / static_cast<float>(SDL_GetPerformanceFrequency());
+    }
+
+    // [-pi, pi]로 줄인 뒤 [-pi/2, pi/2]로 접어서 다항식 근사
+    inline void SinCosScalar(float x, float& outSin, float& outCos)
+    {
+        float quotient = std::nearbyint(x * INV_TWO_PI);
+        x = x - quotient * TWO_PI;
+
+        float cosSign = 1.0f;
+        if (std::fabs(x) > HALF_PI)
+        {
+            x = std::copysign(PI, x) - x;
+            cosSign = -1.0f;
+        }
+
+        float x2 = x * x;
+        float s = SIN4;
+        s = s * x2 + SIN3;
+        s = s * x2 + SIN2;
+        s = s * x2 + SIN1;
+        s = s * x2 + SIN0;
+        s = s * x2 + 1.0f;
+        outSin = s * x;
+
+        float c = COS4;
+        c = c * x2 + COS3;
+        c = c * x2 + COS2;
+        c = c * x2 + COS1;
+        c = c * x2 + COS0;
+        c = c * x2 + 1.0f;
+        outCos = c * cosSign;
+    }
+
+    void ComposeScalar(const TransformStreams& streams, size_t begin, size_t end, glm::mat4* outMatrices)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            outMatrices[i] = ComposeTransformMatrix(
+                glm::vec3(streams.Get(TransformStreams::PositionX)[i], streams.Get(TransformStreams::PositionY)[i], streams.Get(TransformStreams::PositionZ)[i]),
+                glm::vec3(streams.Get(TransformStreams::RotationX)[i], streams.Get(TransformStreams::RotationY)[i], streams.Get(TransformStreams::RotationZ)[i]),
+                glm::vec3(streams.Get(TransformStreams::ScaleX)[i], streams.Get(TransformStreams::ScaleY)[i], streams.Get(TransformStreams::ScaleZ)[i]));
+        }
+    }
+
+#if TRANSFORM_SIMD_X86
+    // ---------------- SSE (4개씩) ----------------
+    inline __m128 BlendSSE(__m128 mask, __m128 a, __m128 b)
+    {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+
+    inline void SinCosSSE(__m128 x, __m128& outSin, __m128& outCos)
+    {
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+
+        __m128 quotient = _mm_cvtepi32_ps(_mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(INV_TWO_PI))));
+        x = _mm_sub_ps(x, _mm_mul_ps(quotient, _mm_set1_ps(TWO_PI)));
+
+        __m128 reflected = _mm_sub_ps(_mm_or_ps(_mm_and_ps(x, signMask), _mm_set1_ps(PI)), x);
+        __m128 inRange = _mm_cmple_ps(_mm_andnot_ps(signMask, x), _mm_set1_ps(HALF_PI));
+        x = BlendSSE(inRange, x, reflected);
+        __m128 cosSign = BlendSSE(inRange, _mm_set1_ps(1.0f), _mm_set1_ps(-1.0f));
+
+        __m128 x2 = _mm_mul_ps(x, x);
+        __m128 s = _mm_set1_ps(SIN4);
+        s = _mm_add_ps(_mm_mul_ps(s, x2), _mm_set1_ps(SIN3));
+        s = _mm_add_ps(_mm_mul_ps(s, x2), _mm_set1_ps(SIN2));
+        s = _mm_add_ps(_mm_mul_ps(s, x2), _mm_set1_ps(SIN1));
+        s = _mm_add_ps(_mm_mul_ps(s, x2), _mm_set1_ps(SIN0));
+        s = _mm_add_ps(_mm_mul_ps(s, x2), _mm_set1_ps(1.0f));
+        outSin = _mm_mul_ps(s, x);
+
+        __m128 c = _mm_set1_ps(COS4);
+        c = _mm_add_ps(_mm_mul_ps(c, x2), _mm_set1_ps(COS3));
+        c = _mm_add_ps(_mm_mul_ps(c, x2), _mm_set1_ps(COS2));
+        c = _mm_add_ps(_mm_mul_ps(c, x2), _mm_set1_ps(COS1));
+        c = _mm_add_ps(_mm_mul_ps(c, x2), _mm_set1_ps(COS0));
+        c = _mm_add_ps(_mm_mul_ps(c, x2), _mm_set1_ps(1.0f));
+        outCos = _mm_mul_ps(c, cosSign);
+    }
+
+    // 레인별 열 성분 4개를 전치하여 4개 행렬의 같은 열에 기록
+    inline void StoreColumnSSE(glm::mat4* outMatrices, int column, __m128 x, __m128 y, __m128 z, __m128 w)
+    {
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+        _mm_storeu_ps(&outMatrices[0][column][0], x);
+        _mm_storeu_ps(&outMatrices[1][column][0], y);
+        _mm_storeu_ps(&outMatrices[2][column][0], z);
+        _mm_storeu_ps(&outMatrices[3][column][0], w);
+    }
+
+    size_t ComposeSSE(const TransformStreams& streams, size_t begin, size_t end, glm::mat4* outMatrices)
+    {
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 two = _mm_set1_ps(2.0f);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 degToHalfRad = _mm_set1_ps(DEG_TO_HALF_RAD);
+
+        size_t i = begin;
+        for (; i + 4 <= end; i += 4)
+        {
+            __m128 sx, cx, sy, cy, sz, cz;
+            SinCosSSE(_mm_mul_ps(_mm_loadu_ps(streams.Get(TransformStreams::RotationX) + i), degToHalfRad), sx, cx);
+            SinCosSSE(_mm_mul_ps(_mm_loadu_ps(streams.Get(TransformStreams::RotationY) + i), degToHalfRad), sy, cy);
+            SinCosSSE(_mm_mul_ps(_mm_loadu_ps(streams.Get(TransformStreams::RotationZ) + i), degToHalfRad), sz, cz);
+
+            // 오일러(XYZ) -> 쿼터니언
+            __m128 cycz = _mm_mul_ps(cy, cz);
+            __m128 sysz = _mm_mul_ps(sy, sz);
+            __m128 sycz = _mm_mul_ps(sy, cz);
+            __m128 cysz = _mm_mul_ps(cy, sz);
+            __m128 qw = _mm_add_ps(_mm_mul_ps(cx, cycz), _mm_mul_ps(sx, sysz));
+            __m128 qx = _mm_sub_ps(_mm_mul_ps(sx, cycz), _mm_mul_ps(cx, sysz));
+            __m128 qy = _mm_add_ps(_mm_mul_ps(cx, sycz), _mm_mul_ps(sx, cysz));
+            __m128 qz = _mm_sub_ps(_mm_mul_ps(cx, cysz), _mm_mul_ps(sx, sycz));
+
+            // 쿼터니언 -> 회전 행렬
+            __m128 xx = _mm_mul_ps(qx, qx), yy = _mm_mul_ps(qy, qy), zz = _mm_mul_ps(qz, qz);
+            __m128 xy = _mm_mul_ps(qx, qy), xz = _mm_mul_ps(qx, qz), yz = _mm_mul_ps(qy, qz);
+            __m128 wx = _mm_mul_ps(qw, qx), wy = _mm_mul_ps(qw, qy), wz = _mm_mul_ps(qw, qz);
+
+            __m128 scaleX = _mm_loadu_ps(streams.Get(TransformStreams::ScaleX) + i);
+            __m128 scaleY = _mm_loadu_ps(streams.Get(TransformStreams::ScaleY) + i);
+            __m128 scaleZ = _mm_loadu_ps(streams.Get(TransformStreams::ScaleZ) + i);
+
+            // T * R * S : 회전 행렬의 각 열에 스케일을 곱하고 4번째 열에 위치
+            StoreColumnSSE(outMatrices + i, 0,
+                _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), scaleX),
+                _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), scaleX),
+                _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), scaleX),
+                zero);
+            StoreColumnSSE(outMatrices + i, 1,
+                _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), scaleY),
+                _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), scaleY),
+                _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), scaleY),
+                zero);
+            StoreColumnSSE(outMatrices + i, 2,
+                _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), scaleZ),
+                _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), scaleZ),
+                _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), scaleZ),
+                zero);
+            StoreColumnSSE(outMatrices + i, 3,
+                _mm_loadu_ps(streams.Get(TransformStreams::PositionX) + i),
+                _mm_loadu_ps(streams.Get(TransformStreams::PositionY) + i),
+                _mm_loadu_ps(streams.Get(TransformStreams::PositionZ) + i),
+                one);
+        }
+        return i;
+    }
+
+    // ---------------- AVX2 (8개씩) ----------------
+    TRANSFORM_TARGET_AVX2 inline __m256 BlendAVX2(__m256 mask, __m256 a, __m256 b)
+    {
+        return _mm256_blendv_ps(b, a, mask);
+    }
+
+    TRANSFORM_TARGET_AVX2 inline void SinCosAVX2(__m256 x, __m256& outSin, __m256& outCos)
+    {
+        const __m256 signMask = _mm256_set1_ps(-0.0f);
+
+        __m256 quotient = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(INV_TWO_PI)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        x = _mm256_sub_ps(x, _mm256_mul_ps(quotient, _mm256_set1_ps(TWO_PI)));
+
+        __m256 reflected = _mm256_sub_ps(_mm256_or_ps(_mm256_and_ps(x, signMask), _mm256_set1_ps(PI)), x);
+        __m256 inRange = _mm256_cmp_ps(_mm256_andnot_ps(signMask, x), _mm256_set1_ps(HALF_PI), _CMP_LE_OQ);
+        x = BlendAVX2(inRange, x, reflected);
+        __m256 cosSign = BlendAVX2(inRange, _mm256_set1_ps(1.0f), _mm256_set1_ps(-1.0f));
+
+        __m256 x2 = _mm256_mul_ps(x, x);
+        __m256 s = _mm256_set1_ps(SIN4);
+        s = _mm256_add_ps(_mm256_mul_ps(s, x2), _mm256_set1_ps(SIN3));
+        s = _mm256_add_ps(_mm256_mul_ps(s, x2), _mm256_set1_ps(SIN2));
+        s = _mm256_add_ps(_mm256_mul_ps(s, x2), _mm256_set1_ps(SIN1));
+        s = _mm256_add_ps(_mm256_mul_ps(s, x2), _mm256_set1_ps(SIN0));
+        s = _mm256_add_ps(_mm256_mul_ps(s, x2), _mm256_set1_ps(1.0f));
+        outSin = _mm256_mul_ps(s, x);
+
+        __m256 c = _mm256_set1_ps(COS4);
+        c = _mm256_add_ps(_mm256_mul_ps(c, x2), _mm256_set1_ps(COS3));
+        c = _mm256_add_ps(_mm256_mul_ps(c, x2), _mm256_set1_ps(COS2));
+        c = _mm256_add_ps(_mm256_mul_ps(c, x2), _mm256_set1_ps(COS1));
+        c = _mm256_add_ps(_mm256_mul_ps(c, x2), _mm256_set1_ps(COS0));
+        c = _mm256_add_ps(_mm256_mul_ps(c, x2), _mm256_set1_ps(1.0f));
+        outCos = _mm256_mul_ps(c, cosSign);
+    }
+
+    // 앞 4레인과 뒤 4레인을 각각 전치하여 8개 행렬의 같은 열에 기록
+    TRANSFORM_TARGET_AVX2 inline void StoreColumnAVX2(glm::mat4* outMatrices, int column, __m256 x, __m256 y, __m256 z, __m256 w)
+    {
+        __m128 x0 = _mm256_castps256_ps128(x), y0 = _mm256_castps256_ps128(y), z0 = _mm256_castps256_ps128(z), w0 = _mm256_castps256_ps128(w);
+        __m128 x1 = _mm256_extractf128_ps(x, 1), y1 = _mm256_extractf128_ps(y, 1), z1 = _mm256_extractf128_ps(z, 1), w1 = _mm256_extractf128_ps(w, 1);
+        _MM_TRANSPOSE4_PS(x0, y0, z0, w0);
+        _MM_TRANSPOSE4_PS(x1, y1, z1, w1);
+        _mm_storeu_ps(&outMatrices[0][column][0], x0);
+        _mm_storeu_ps(&outMatrices[1][column][0], y0);
+        _mm_storeu_ps(&outMatrices[2][column][0], z0);
+        _mm_storeu_ps(&outMatrices[3][column][0], w0);
+        _mm_storeu_ps(&outMatrices[4][column][0], x1);
+        _mm_storeu_ps(&outMatrices[5][column][0], y1);
+        _mm_storeu_ps(&outMatrices[6][column][0], z1);
+        _mm_storeu_ps(&outMatrices[7][column][0], w1);
+    }
+
+    TRANSFORM_TARGET_AVX2 size_t ComposeAVX2(const TransformStreams& streams, size_t begin, size_t end, glm::mat4* outMatrices)
+    {
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 two = _mm256_set1_ps(2.0f);
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 degToHalfRad = _mm256_set1_ps(DEG_TO_HALF_RAD);
+
+        size_t i = begin;
+        for (; i + 8 <= end; i += 8)
+        {
+            __m256 sx, cx, sy, cy, sz, cz;
+            SinCosAVX2(_mm256_mul_ps(_mm256_loadu_ps(streams.Get(TransformStreams::RotationX) + i), degToHalfRad), sx, cx);
+            SinCosAVX2(_mm256_mul_ps(_mm256_loadu_ps(streams.Get(TransformStreams::RotationY) + i), degToHalfRad), sy, cy);
+            SinCosAVX2(_mm256_mul_ps(_mm256_loadu_ps(streams.Get(TransformStreams::RotationZ) + i), degToHalfRad), sz, cz);
+
+            __m256 cycz = _mm256_mul_ps(cy, cz);
+            __m256 sysz = _mm256_mul_ps(sy, sz);
+            __m256 sycz = _mm256_mul_ps(sy, cz);
+            __m256 cysz = _mm256_mul_ps(cy, sz);
+            __m256 qw = _mm256_add_ps(_mm256_mul_ps(cx, cycz), _mm256_mul_ps(sx, sysz));
+            __m256 qx = _mm256_sub_ps(_mm256_mul_ps(sx, cycz), _mm256_mul_ps(cx, sysz));
+            __m256 qy = _mm256_add_ps(_mm256_mul_ps(cx, sycz), _mm256_mul_ps(sx, cysz));
+            __m256 qz = _mm256_sub_ps(_mm256_mul_ps(cx, cysz), _mm256_mul_ps(sx, sycz));
+
+            __m256 xx = _mm256_mul_ps(qx, qx), yy = _mm256_mul_ps(qy, qy), zz = _mm256_mul_ps(qz, qz);
+            __m256 xy = _mm256_mul_ps(qx, qy), xz = _mm256_mul_ps(qx, qz), yz = _mm256_mul_ps(qy, qz);
+            __m256 wx = _mm256_mul_ps(qw, qx), wy = _mm256_mul_ps(qw, qy), wz = _mm256_mul_ps(qw, qz);
+
+            __m256 scaleX = _mm256_loadu_ps(streams.Get(TransformStreams::ScaleX) + i);
+            __m256 scaleY = _mm256_loadu_ps(streams.Get(TransformStreams::ScaleY) + i);
+            __m256 scaleZ = _mm256_loadu_ps(streams.Get(TransformStreams::ScaleZ) + i);
+
+            StoreColumnAVX2(outMatrices + i, 0,
+                _mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(yy, zz))), scaleX),
+                _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xy, wz)), scaleX),
+                _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xz, wy)), scaleX),
+                zero);
+            StoreColumnAVX2(outMatrices + i, 1,
+                _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xy, wz)), scaleY),
+                _mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(xx, zz))), scaleY),
+                _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(yz, wx)), scaleY),
+                zero);
+            StoreColumnAVX2(outMatrices + i, 2,
+                _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xz, wy)), scaleZ),
+                _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(yz, wx)), scaleZ),
+                _mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(xx, yy))), scaleZ),
+                zero);
+            StoreColumnAVX2(outMatrices + i, 3,
+                _mm256_loadu_ps(streams.Get(TransformStreams::PositionX) + i),
+                _mm256_loadu_ps(streams.Get(TransformStreams::PositionY) + i),
+                _mm256_loadu_ps(streams.Get(TransformStreams::PositionZ) + i),
+                one);
+        }
+        return i;
+    }
+#endif
+
+    TransformSimdLevel DetectSimdLevel()
+    {
+#if TRANSFORM_SIMD_X86
+#if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        int maxLeaf = info[0];
+        __cpuid(info, 1);
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool avx = (info[2] & (1 << 28)) != 0;
+        bool avx2 = false;
+        if (maxLeaf >= 7)
+        {
+            __cpuidex(info, 7, 0);
+            avx2 = (info[1] & (1 << 5)) != 0;
+        }
+        // OS가 YMM 레지스터를 문맥 전환 시 저장하는지도 확인해야 함
+        bool ymmEnabled = osxsave && (_xgetbv(0) & 0x6) == 0x6;
+        if (avx && avx2 && ymmEnabled)
+        {
+            return TransformSimdLevel::AVX2;
+        }
+        return TransformSimdLevel::SSE;
+#else
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return TransformSimdLevel::AVX2;
+        }
+        return TransformSimdLevel::SSE;
+#endif
+#else
+        return TransformSimdLevel::Scalar;
+#endif
+    }
+}
+
+const char* TransformSimdLevelToString(TransformSimdLevel level)
+{
+    switch (level)
+    {
+    case TransformSimdLevel::Scalar: return "Scalar";
+    case TransformSimdLevel::SSE: return "SSE";
+    case TransformSimdLevel::AVX2: return "AVX2";
+    }
+    return "Unknown";
+}
+
+void TransformStreams::Resize(size_t count_)
+{
+    count = count_;
+    for (std::vector<float>& stream : streams)
+    {
+        stream.resize(count);
+    }
+}
+
+glm::mat4 ComposeTransformMatrix(const glm::vec3& position, const glm::vec3& rotation, const glm::vec3& scale)
+{
+    float sx, cx, sy, cy, sz, cz;
+    SinCosScalar(rotation.x * DEG_TO_HALF_RAD, sx, cx);
+    SinCosScalar(rotation.y * DEG_TO_HALF_RAD, sy, cy);
+    SinCosScalar(rotation.z * DEG_TO_HALF_RAD, sz, cz);
+
+    float cycz = cy * cz;
+    float sysz = sy * sz;
+    float sycz = sy * cz;
+    float cysz = cy * sz;
+    float qw = cx * cycz + sx * sysz;
+    float qx = sx * cycz - cx * sysz;
+    float qy = cx * sycz + sx * cysz;
+    float qz = cx * cysz - sx * sycz;
+
+    float xx = qx * qx, yy = qy * qy, zz = qz * qz;
+    float xy = qx * qy, xz = qx * qz, yz = qy * qz;
+    float wx = qw * qx, wy = qw * qy, wz = qw * qz;
+
+    glm::mat4 result;
+    result[0] = glm::vec4((1.0f - 2.0f * (yy + zz)) * scale.x, 2.0f * (xy + wz) * scale.x, 2.0f * (xz - wy) * scale.x, 0.0f);
+    result[1] = glm::vec4(2.0f * (xy - wz) * scale.y, (1.0f - 2.0f * (xx + zz)) * scale.y, 2.0f * (yz + wx) * scale.y, 0.0f);
+    result[2] = glm::vec4(2.0f * (xz + wy) * scale.z, 2.0f * (yz - wx) * scale.z, (1.0f - 2.0f * (xx + yy)) * scale.z, 0.0f);
+    result[3] = glm::vec4(position, 1.0f);
+    return result;
+}
+
+void ComposeTransformMatrices(const TransformStreams& streams, size_t begin, size_t end, glm::mat4* outMatrices)
+{
+    ComposeTransformMatrices(streams, begin, end, outMatrices, GetTransformSimdLevel());
+}
+
+void ComposeTransformMatrices(const TransformStreams& streams, size_t begin, size_t end, glm::mat4* outMatrices, TransformSimdLevel level)
+{
+    level = std::min(level, GetSupportedTransformSimdLevel());
+    size_t i = begin;
+#if TRANSFORM_SIMD_X86
+    if (level == TransformSimdLevel::AVX2)
+    {
+        i = ComposeAVX2(streams, i, end, outMatrices);
+    }
+    if (level >= TransformSimdLevel::SSE)
+    {
+        i = ComposeSSE(streams, i, end, outMatrices);
+    }
+#endif
+    // 레인 수로 나누어 떨어지지 않는 나머지
+    ComposeScalar(streams, i, end, outMatrices);
+}
+
+TransformSimdLevel GetSupportedTransformSimdLevel()
+{
+    static const TransformSimdLevel supported = DetectSimdLevel();
+    return supported;
+}
+
+TransformSimdLevel GetTransformSimdLevel()
+{
+    int level = activeLevel.load(std::memory_order_relaxed);
+    if (level < 0)
+    {
+        return GetSupportedTransformSimdLevel();
+    }
+    return std::min(static_cast<TransformSimdLevel>(level), GetSupportedTransformSimdLevel());
+}
+
+void SetTransformSimdLevel(TransformSimdLevel level)
+{
+    activeLevel.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+TransformBenchmarkResult RunTransformBenchmark(int transformCount)
+{
+    constexpr int ITERATIONS = 10;
+
+    TransformBenchmarkResult result;
+    result.transformCount = transformCount;
+    size_t count = static_cast<size_t>(std::max(transformCount, 0));
+
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> positionRange(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> rotationRange(-720.0f, 720.0f);
+    std::uniform_real_distribution<float> scaleRange(0.1f, 4.0f);
+
+    std::vector<glm::vec3> positions(count), rotations(count), scales(count);
+    TransformStreams streams;
+    streams.Resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        positions[i] = glm::vec3(positionRange(random), positionRange(random), positionRange(random));
+        rotations[i] = glm::vec3(rotationRange(random), rotationRange(random), rotationRange(random));
+        scales[i] = glm::vec3(scaleRange(random), scaleRange(random), scaleRange(random));
+        streams.Set(i, positions[i], rotations[i], scales[i]);
+    }
+
+    // 기존 Transform::GetModelMatrix 계산 방식
+    std::vector<glm::mat4> reference(count);
+    Uint64 startTicks = SDL_GetPerformanceCounter();
+    for (int iteration = 0; iteration < ITERATIONS; ++iteration)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            glm::mat4 scaleMat = glm::scale(glm::mat4(1.0f), scales[i]);
+            glm::mat4 rotationMat = glm::mat4_cast(glm::quat(glm::radians(rotations[i])));
+            glm::mat4 translateMat = glm::translate(glm::mat4(1.0f), positions[i]);
+            reference[i] = translateMat * rotationMat * scaleMat;
+        }
+    }
+    result.glmMs = TicksToMs(SDL_GetPerformanceCounter() - startTicks) / ITERATIONS;
+
+    std::vector<glm::mat4> output(count);
+    auto measure = [&](TransformSimdLevel level)
+    {
+        Uint64 begin = SDL_GetPerformanceCounter();
+        for (int iteration = 0; iteration < ITERATIONS; ++iteration)
+        {
+            ComposeTransformMatrices(streams, 0, count, output.data(), level);
+        }
+        float ms = TicksToMs(SDL_GetPerformanceCounter() - begin) / ITERATIONS;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            for (int column = 0; column < 4; ++column)
+            {
+                for (int row = 0; row < 4; ++row)
+                {
+                    result.maxError = std::max(result.maxError, std::fabs(output[i][column][row] - reference[i][column][row]));
+                }
+            }
+        }
+        return ms;
+    };
+
+    result.scalarMs = measure(TransformSimdLevel::Scalar);
+    result.sseMs = GetSupportedTransformSimdLevel() >= TransformSimdLevel::SSE ? measure(TransformSimdLevel::SSE) : -1.0f;
+    result.avx2Ms = GetSupportedTransformSimdLevel() >= TransformSimdLevel::AVX2 ? measure(TransformSimdLevel::AVX2) : -1.0f;
+    return result;
+}
@@ -19,24 +19,26 @@ public:
     Bone(const std::string& name, int ID, const aiNodeAnim* channel);
 
     void Update(float animationTime);
+    //  ¸ ٲ ʰ  ȯ  ( Animator  Animation ÿ ص )
+    glm::mat4 CalculateLocalTransform(float animationTime) const;
 
     // Getter Լ
     glm::mat4 GetLocalTransform() const { return localTransform; }
     const std::string& GetBoneName() const { return name; }
     int GetBoneID() const { return id; }
 
-    glm::vec3 GetInterpolatedPosition(float animationTime);
-    glm::quat GetInterpolatedRotation(float animationTime);
-    glm::vec3 GetInterpolatedScale(float animationTime);
+    glm::vec3 GetInterpolatedPosition(float animationTime) const;
+    glm::quat GetInterpolatedRotation(float animationTime) const;
+    glm::vec3 GetInterpolatedScale(float animationTime) const;
 private:
-    glm::mat4 InterpolatePosition(float animationTime);
-    glm::mat4 InterpolateRotation(float animationTime);
-    glm::mat4 InterpolateScaling(float animationTime);
-
-    int GetPositionIndex(float animationTime);
-    int GetRotationIndex(float animationTime);
-    int GetScaleIndex(float animationTime);
-    float GetScaleFactor(float lastTimeStamp, float nextTimeStamp, float animationTime);
+    glm::mat4 InterpolatePosition(float animationTime) const;
+    glm::mat4 InterpolateRotation(float animationTime) const;
+    glm::mat4 InterpolateScaling(float animationTime) const;
+
+    int GetPositionIndex(float animationTime) const;
+    int GetRotationIndex(float animationTime) const;
+    int GetScaleIndex(float animationTime) const;
+    float GetScaleFactor(float lastTimeStamp, float nextTimeStamp, float animationTime) const;
 
     std::vector<KeyPosition> positions;
     std::vector<KeyRotation> rotations;
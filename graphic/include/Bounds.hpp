@@ -0,0 +1,105 @@
+﻿#pragma once
+#include <glm.hpp>
+#include <vector>
+#include <cstdint>
+
+// 축 정렬 경계 상자 (비어 있으면 min > max)
+struct AABB
+{
+    glm::vec3 min = glm::vec3(1e30f);
+    glm::vec3 max = glm::vec3(-1e30f);
+
+    bool IsValid() const { return min.x <= max.x && min.y <= max.y && min.z <= max.z; }
+    glm::vec3 GetCenter() const { return (min + max) * 0.5f; }
+    glm::vec3 GetExtents() const { return (max - min) * 0.5f; }
+
+    void Expand(const glm::vec3& point);
+    void Expand(const AABB& other);
+    // 변환한 상자를 다시 감싸는 AABB (8개 꼭짓점 대신 행렬 성분의 절댓값으로 계산)
+    AABB Transform(const glm::mat4& matrix) const;
+    // 원점을 기준으로 scale배 (scale >= 0)
+    AABB Scale(float scale) const { return { min * scale, max * scale }; }
+    // 모든 방향으로 amount만큼 늘림
+    AABB Inflate(const glm::vec3& amount) const { return { min - amount, max + amount }; }
+
+    bool Contains(const AABB& other) const
+    {
+        return min.x <= other.min.x && min.y <= other.min.y && min.z <= other.min.z
+            && max.x >= other.max.x && max.y >= other.max.y && max.z >= other.max.z;
+    }
+    bool Overlaps(const AABB& other) const
+    {
+        return min.x <= other.max.x && max.x >= other.min.x && min.y <= other.max.y && max.y >= other.min.y
+            && min.z <= other.max.z && max.z >= other.min.z;
+    }
+    bool OverlapsSphere(const glm::vec3& center, float radius) const;
+    // 광선(origin + t * direction, inverseDirection = 1 / direction)이 [0, maxDistance] 안에서 만나면 true
+    // 출발점이 상자 안이면 hitDistance = 0
+    bool IntersectRay(const glm::vec3& origin, const glm::vec3& inverseDirection, float maxDistance, float& hitDistance) const;
+    // 표면적 (BVH의 SAH 비용)
+    float GetSurfaceArea() const
+    {
+        glm::vec3 size = max - min;
+        return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+    }
+
+    static AABB Union(const AABB& a, const AABB& b) { return { glm::min(a.min, b.min), glm::max(a.max, b.max) }; }
+};
+
+struct BoundingSphere
+{
+    glm::vec3 center = glm::vec3(0.0f);
+    float radius = -1.0f; // 음수면 비어 있음
+
+    bool IsValid() const { return radius >= 0.0f; }
+    // 균등하지 않은 스케일은 가장 큰 축의 배율로 반지름을 늘림
+    BoundingSphere Transform(const glm::mat4& matrix) const;
+};
+
+// 여러 AABB를 중심/반폭 성분별 배열(SoA)로 모아둔 것 (SIMD로 4개씩 판정)
+struct BoundsArray
+{
+    std::vector<float> centerX, centerY, centerZ;
+    std::vector<float> extentX, extentY, extentZ;
+
+    void Resize(size_t count);
+    void Set(size_t index, const AABB& bounds);
+    // 경계를 알 수 없는 항목 (모든 평면 안쪽으로 판정되어 항상 보임)
+    void SetInfinite(size_t index);
+    size_t GetCount() const { return centerX.size(); }
+};
+
+enum class FrustumTest { Outside, Intersect, Inside };
+
+// view * projection에서 추출한 6개 평면 (법선은 안쪽, xyz = 법선, w = 거리)
+class Frustum
+{
+public:
+    Frustum() = default;
+    explicit Frustum(const glm::mat4& viewProjection) { Extract(viewProjection); }
+
+    void Extract(const glm::mat4& viewProjection);
+
+    bool TestAABB(const glm::vec3& center, const glm::vec3& extents) const;
+    bool TestAABB(const AABB& bounds) const { return TestAABB(bounds.GetCenter(), bounds.GetExtents()); }
+    bool TestSphere(const BoundingSphere& sphere) const;
+    static constexpr uint8_t ALL_PLANES = 0x3F;
+    // 완전히 안쪽인지까지 구분 (BVH에서 완전히 안쪽인 노드는 자식 판정을 생략)
+    // planeMask: 판정할 평면 비트, 완전히 안쪽으로 판정된 평면의 비트는 지워서 돌려줌 (자식은 그 평면을 건너뜀)
+    FrustumTest ClassifyAABB(const AABB& bounds, uint8_t& planeMask) const;
+    FrustumTest ClassifyAABB(const AABB& bounds) const
+    {
+        uint8_t planeMask = ALL_PLANES;
+        return ClassifyAABB(bounds, planeMask);
+    }
+
+    // visible[i] = 1이면 절두체와 겹침, 반환값 = 보이는 개수 (SIMD와 스칼라는 같은 식이라 결과가 동일)
+    int CullBoxes(const BoundsArray& bounds, std::vector<uint8_t>& visible, bool useSimd = true) const;
+
+    const glm::vec4* GetPlanes() const { return planes; }
+
+private:
+    int CullBoxesScalar(const BoundsArray& bounds, size_t begin, uint8_t* visible) const;
+
+    glm::vec4 planes[6] = {};
+};
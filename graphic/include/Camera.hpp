@@ -1,5 +1,7 @@
 #pragma once
 #include "glm.hpp"
+#include <atomic>
+#include <cstdint>
 
 enum class CameraMoveDir
 {
@@ -20,6 +22,9 @@ public:
 	void Update();
 	void Reset();
 
+	// 카메라마다 고유한 번호 (해제된 카메라의 주소가 재사용되어도 겹치지 않음, 카메라별 상태의 키로 사용)
+	uint32_t GetId() const noexcept { return id; }
+
 	void SetCameraPosition(glm::vec3 cameraPosition) noexcept;
 	void SetViewSize(int width, int height) noexcept;
 	void SetZoom(float amount) noexcept;
@@ -55,6 +60,9 @@ public:
 
 	void SetRelativeViewport(float x, float y, float width, float height){	relativeViewportRect = { x, y, width, height }; }
 private:
+	uint32_t id = nextId.fetch_add(1, std::memory_order_relaxed);
+	static inline std::atomic<uint32_t> nextId{ 1 };
+
 	glm::vec3 cameraPosition{ 0.0f, 0.0f, 0.0f };
 	glm::vec2 cameraViewSize{ 0.0f, 0.0f };
 	glm::vec4 relativeViewportRect{ 0.f, 0.f, 1.f, 1.f };
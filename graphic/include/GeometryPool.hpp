@@ -0,0 +1,92 @@
+﻿#pragma once
+#include "VertexArray.hpp"
+#include "VertexFormat.hpp"
+#include <map>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <span>
+
+// 풀 안에서 메시 하나가 차지하는 구간 (정점/인덱스 단위)
+struct GeometryRange
+{
+    unsigned int baseVertex = 0;
+    unsigned int vertexCount = 0;
+    unsigned int firstIndex = 0;
+    unsigned int indexCount = 0;
+};
+
+// 한 정점 형식의 메시들이 함께 쓰는 큰 정점/인덱스 버퍼와 VAO
+// - 형식의 스트림마다 정점 버퍼를 하나씩 두고, 모든 스트림이 같은 정점 구간(baseVertex)을 사용
+// - 인덱스 형식은 풀마다 하나 (16비트 풀에는 정점이 65536개 미만인 메시만 올라감)
+// - 메시는 버퍼들에서 구간을 나눠 받고, 인덱스는 메시 기준 그대로 두고 baseVertex로 그림
+// - 모든 메시가 같은 VAO를 쓰므로 드로우 사이에 VAO를 바꾸지 않고, 여러 메시를 glMultiDrawElementsIndirect 한 번으로 그릴 수 있음
+// - 공간이 모자라면 두 배로 늘린 새 버퍼에 기존 내용을 GPU에서 복사하고 VAO를 새로 만듦 (GetVertexArray는 매번 새로 얻어야 함)
+// - 해제된 구간은 인접 구간과 합쳐 다음 할당에 재사용 (처음 맞는 구간)
+class GeometryPool
+{
+public:
+    // vertexFormat_은 GetStaticVertexFormat 등이 돌려주는 정적 객체, indexType_은 GL_UNSIGNED_SHORT 또는 GL_UNSIGNED_INT
+    GeometryPool(const VertexFormat& vertexFormat_, GLenum indexType_ = GL_UNSIGNED_INT,
+        size_t initialVertexCapacity = 1 << 16, size_t initialIndexCapacity = 1 << 18);
+    ~GeometryPool() = default;
+
+    GeometryPool(const GeometryPool&) = delete;
+    GeometryPool& operator=(const GeometryPool&) = delete;
+
+    // streamData는 형식의 스트림 순서대로 vertexCount * 스트림 stride 바이트씩
+    // 인덱스는 메시 기준 32비트로 받아 풀의 형식으로 기록, 실패하면(해제된 풀, 스트림 수가 다름, 16비트에 담을 수 없음) false
+    bool Allocate(std::span<const void* const> streamData, size_t vertexCount, const unsigned int* indexData, size_t indexCount, GeometryRange& range);
+    void Free(const GeometryRange& range);
+    // GL 컨텍스트를 없애기 전에 버퍼를 해제 (이후 Allocate는 실패하고 Free는 무시됨)
+    void Release();
+
+    VertexArray* GetVertexArray() const { return vertexArray.get(); }
+    const VertexFormat& GetVertexFormat() const { return *vertexFormat; }
+    GLenum GetIndexType() const { return indexType; }
+
+    size_t GetUsedVertices() const { return vertexRanges.GetUsed(); }
+    // 모든 스트림을 합친 사용 중인 정점 데이터 크기
+    size_t GetUsedVertexBytes() const { return vertexRanges.GetUsed() * static_cast<size_t>(vertexFormat->GetVertexSize()); }
+    size_t GetVertexCapacity() const { return vertexRanges.GetCapacity(); }
+    size_t GetUsedIndices() const { return indexRanges.GetUsed(); }
+    size_t GetIndexCapacity() const { return indexRanges.GetCapacity(); }
+    int GetAllocationCount() const { return allocationCount; }
+    int GetGrowCount() const { return growCount; }
+
+private:
+    // [0, capacity)에서 연속 구간을 나눠 주는 할당기 (GL과 무관)
+    class RangeAllocator
+    {
+    public:
+        void Reset(size_t capacity_);
+        // 맞는 구간이 없으면 NO_SPACE
+        size_t Allocate(size_t size);
+        void Free(size_t offset, size_t size);
+        // 끝에 빈 공간을 늘림 (마지막 빈 구간과 합침)
+        void Grow(size_t newCapacity);
+
+        size_t GetCapacity() const { return capacity; }
+        size_t GetUsed() const { return used; }
+        // 끝에서 이어지는 빈 공간 크기 (늘릴 때 필요한 양 계산용)
+        size_t GetTailFree() const;
+
+        static constexpr size_t NO_SPACE = static_cast<size_t>(-1);
+
+    private:
+        std::map<size_t, size_t> freeRanges; // 시작 -> 크기
+        size_t capacity = 0;
+        size_t used = 0;
+    };
+
+    // 버퍼를 새 용량으로 다시 만들고 기존 내용을 복사
+    void Reallocate(size_t vertexCapacity, size_t indexCapacity);
+
+    const VertexFormat* vertexFormat = nullptr;
+    GLenum indexType = GL_UNSIGNED_INT;
+    std::unique_ptr<VertexArray> vertexArray;
+    RangeAllocator vertexRanges;
+    RangeAllocator indexRanges;
+    int allocationCount = 0;
+    int growCount = 0;
+};
@@ -1,11 +1,17 @@
 #pragma once
 #include <span>
+#include <cstdint>
+#include <glew.h>
 
 class IndexBuffer
 {
 public:
 	IndexBuffer() = default;
 	IndexBuffer(std::span<const unsigned int> indices);
+	// 16비트 인덱스 (정점이 65536개 미만인 메시)
+	IndexBuffer(std::span<const uint16_t> indices);
+	// 내용 없이 인덱스 count_개 크기만 할당
+	explicit IndexBuffer(unsigned int count_, GLenum type_ = GL_UNSIGNED_INT);
 	~IndexBuffer();
 
 	IndexBuffer(const IndexBuffer&) = delete;
@@ -19,7 +25,11 @@ public:
 
 	unsigned int GetCount() const { return count; }
 	unsigned int GetIndicesHandle() const { return indicesHandle; }
+	// GL_UNSIGNED_SHORT 또는 GL_UNSIGNED_INT (glDrawElements*의 type 인자)
+	GLenum GetType() const { return type; }
+	size_t GetIndexSize() const { return type == GL_UNSIGNED_SHORT ? sizeof(uint16_t) : sizeof(unsigned int); }
 private:
 	unsigned int indicesHandle = 0;
 	unsigned int count = 0;
+	GLenum type = GL_UNSIGNED_INT;
 };
\ No newline at end of file
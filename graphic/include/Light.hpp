@@ -12,7 +12,12 @@ enum class LightType
 class Light : public Component
 {
 public:
-    Light() : Component(ComponentTypes::LIGHT) {}
+    static constexpr ComponentTypes StaticType = ComponentTypes::LIGHT;
+    static constexpr UpdatePhase Phase = UpdatePhase::LateUpdate;
+    static constexpr bool ParallelUpdate = false;
+    static constexpr bool HasUpdate = false; // Update  
+
+    Light() : Component(StaticType) {}
     
     void Init() override;
     void End() override;
@@ -43,6 +48,10 @@ public:
     void SetOffsetForPointL(const glm::vec3 pos) { offsetForPointL = pos; }
     const glm::vec3& GetOffsetForPointL() const { return offsetForPointL; }
 
+    //   ݰ (0̸ , ݰ ִ  Ŭ  )
+    void SetRange(float range_) { range = range_; }
+    float GetRange() const { return range; }
+
 private:
     LightType type = LightType::Directional;
 
@@ -55,4 +64,5 @@ private:
 
     glm::vec3 direction = { 0.f,0.f,0.f }; // Ɽ   
     glm::vec3 offsetForPointL = { 0.f,0.f,0.f }; //    
+    float range = 0.0f; //   ݰ (ݰ濡 0 ǵ )
 };
\ No newline at end of file
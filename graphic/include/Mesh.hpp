@@ -2,7 +2,11 @@
 #include <vector>
 #include <memory>
 #include <glm.hpp>
+#include <cstdint>
 #include "VertexArray.hpp"
+#include "GeometryPool.hpp"
+#include "Bounds.hpp"
+#include "MeshOptimizer.hpp"
 
 #define MAX_BONE_INFLUENCE 4 //   ִ 4     
 
@@ -28,30 +32,128 @@ struct Vertex
     float weights[MAX_BONE_INFLUENCE]; //  κ ޴ (ġ)
 };
 
+// Create* Լ    (Ʈ Ű  ޽ ĳ Ű )
+enum class ProceduralShape : uint64_t { Plane = 1, Cube, Sphere, Diamond, Cylinder, Capsule, Cone };
+
+//   ġ ޴  ε   (  ķ Ű Ű  踦  )
+struct BoneBounds
+{
+    int boneID;
+    AABB bounds;
+};
+
+// ε  ȿ  LOD ܰ谡 ϴ  (0ܰ =  ε, Ǯ ø ޽ô Ǯ ε  )
+struct MeshLod
+{
+    unsigned int firstIndex = 0;
+    unsigned int indexCount = 0;
+    float error = 0.0f; //     (޽   밢  )
+};
+
+// Ʈ   ĳ/ο ȭ  ( ε )
+struct MeshOptimizationStats
+{
+    bool optimized = false;
+    VertexCacheStats before;
+    VertexCacheStats after;
+    size_t overdrawClusters = 0;
+};
+
 class Mesh
 {
 public:
     Mesh() = default;
-    ~Mesh() = default;
+    ~Mesh();
     Mesh(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, PrimitivePattern pattern = PrimitivePattern::Triangles);
 
+    static constexpr int DEFAULT_SPHERE_STACKS = 18;
+    static constexpr int DEFAULT_SPHERE_SLICES = 36;
+    static constexpr int DEFAULT_CYLINDER_SEGMENTS = 32;
+
     void CreatePlane();
     void CreateCube();
-    void CreateSphere(int stacks = 18, int slices = 36);
+    void CreateSphere(int stacks = DEFAULT_SPHERE_STACKS, int slices = DEFAULT_SPHERE_SLICES);
     void CreateDiamond(); 
-    void CreateCylinder(int segments_= 32);
+    void CreateCylinder(int segments_= DEFAULT_CYLINDER_SEGMENTS);
     void CreateCapsule();
     void CreateCone();
+    // ¿ ´ Create* ȣ (: param0 = stacks, param1 = slices / : param0 = segments /   )
+    void CreateProcedural(ProceduralShape shape, int param0 = 0, int param1 = 0);
+    // CreateProcedural(shape, param0, param1)  ޽ GetGeometryKey  (°  ʴ Ķʹ )
+    static uint64_t MakeProceduralKey(ProceduralShape shape, int param0 = 0, int param1 = 0);
+
+    //  GetVertexFormat   ȯ ø (CPU  vertices Vertex ״ )
+    // pool  /ε ̸ Ǯ  ۿ  ޾ ø, ƴϸ ޽  VAO/۸ 
+    void UploadToGPU(const std::shared_ptr<GeometryPool>& pool = nullptr);
+    // Ű   ⺻ + Ű Ʈ,  ⺻ Ʈ (踦  ڿ ȿ)
+    const VertexFormat& GetVertexFormat() const { return hasSkinnedVertices ? GetSkinnedVertexFormat() : GetStaticVertexFormat(); }
 
-    void UploadToGPU();
+    // ﰢ   ĳ -> ο  ȭϰ,  ó ̴  ٽ ġ (Ʈ   , GenerateLods/UploadToGPU )
+    // ﰢ  ƴϸ  
+    void OptimizeForGpu();
+    const MeshOptimizationStats& GetOptimizationStats() const { return optimizationStats; }
 
-    VertexArray* GetVertexArray() const { return vertexArray.get(); }
+    static constexpr int MAX_LOD_LEVELS = 4;
+    //  ε QEM ܼȭ ܰ踶 ﰢ    LOD  (UploadToGPU  ȣ)
+    //  ۴  ܰ谡 ϰ ε  ڿ ̾ ,  ġ ũ ٸ  ġ 
+    //   ( ޽, ֱ/ ޽)  ܰ迡 ߹Ƿ levelCount   
+    void GenerateLods(int levelCount = MAX_LOD_LEVELS);
+    int GetLodCount() const { return 1 + static_cast<int>(lods.size()); }
+    //     ܰ
+    MeshLod GetLod(int level) const;
+
+    VertexArray* GetVertexArray() const { return geometryPool ? geometryPool->GetVertexArray() : vertexArray.get(); }
+    bool IsPooled() const { return geometryPool != nullptr; }
+    // Ǯ  ۿ  ޽   ( ۸ 0, ε  ׸)
+    GLint GetBaseVertex() const { return static_cast<GLint>(geometryRange.baseVertex); }
     PrimitivePattern GetPrimitivePattern() const { return primitivePattern; }
     GLsizei GetIndicesCount() const { return static_cast<GLsizei>(indices.size()); }
+    //  65536 ̸̸ 16Ʈ ε ø (ο  İ Ʈ  꿡 )
+    GLenum GetIndexType() const { return vertices.size() < 65536 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT; }
+    size_t GetIndexSize() const { return GetIndexType() == GL_UNSIGNED_SHORT ? sizeof(uint16_t) : sizeof(unsigned int); }
+    // CPU  /ε ( ȭ  GPU  Ʈ  )
+    const std::vector<Vertex>& GetVertices() const { return vertices; }
+    const std::vector<unsigned int>& GetIndices() const { return indices; }
+    // Create* Լ  ޽ô ¿    Ű  ( Ű =  Ʈ)
+    // 0̸  ѱ ͷ   ޽
+    uint64_t GetGeometryKey() const { return geometryKey; }
+
+    //  ġ  (UploadToGPU Ǵ ͸ ޴ ڿ )
+    void ComputeBounds();
+    const AABB& GetBounds() const { return bounds; }
+    const BoundingSphere& GetBoundingSphere() const { return boundingSphere; }
+
+    // Ű (weights.x > 0, ̴  ) ִ  
+    bool HasSkinnedVertices() const { return hasSkinnedVertices; }
+    // Ű׵ ʴ   (model ķ ȯ)
+    const AABB& GetUnskinnedBounds() const { return unskinnedBounds; }
+    const std::vector<BoneBounds>& GetBoneBounds() const { return boneBounds; }
+    //  ġ   ( 1 ƴϸ Ű   /ٱ  ɸ)
+    float GetMinSkinWeightSum() const { return minSkinWeightSum; }
+    float GetMaxSkinWeightSum() const { return maxSkinWeightSum; }
+    //   (Animator,  ȯ ) Ű  δ  AABB
+    // ̴ó ġ     Ƿ,  踦 ű ڵ   ׻ 
+    //     ȣ  false
+    bool ComputeSkinnedBounds(const std::vector<glm::mat4>& finalBoneMatrices, AABB& skinnedBounds) const;
 private:
     std::vector<Vertex> vertices;
     std::vector<unsigned int> indices;
     PrimitivePattern primitivePattern = PrimitivePattern::Triangles;
+    uint64_t geometryKey = 0;
+    std::vector<MeshLod> lods;            // 1ܰ
+    std::vector<unsigned int> lodIndices; // ε ۿ indices ڿ 
+    MeshOptimizationStats optimizationStats;
+
+    AABB bounds;
+    BoundingSphere boundingSphere;
+    bool boundsDirty = true;
+    bool hasSkinnedVertices = false;
+    AABB unskinnedBounds;
+    std::vector<BoneBounds> boneBounds;
+    float minSkinWeightSum = 1.0f;
+    float maxSkinWeightSum = 1.0f;
 
     std::unique_ptr<VertexArray> vertexArray;
+    std::shared_ptr<GeometryPool> geometryPool; // ޽ð  ִ  Ǯ   ʰ 
+    GeometryRange geometryRange;
 };
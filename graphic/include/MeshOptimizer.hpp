@@ -0,0 +1,29 @@
+﻿#pragma once
+#include <vector>
+#include <cstddef>
+
+// 변환 후 정점 캐시 효율 (FIFO 캐시 시뮬레이션)
+// - ACMR: 삼각형당 캐시 미스 수 (0.5 근처가 이상적, 최악 3)
+// - ATVR: 사용된 정점당 캐시 미스 수 (1이 이상적)
+struct VertexCacheStats
+{
+    float acmr = 0.0f;
+    float atvr = 0.0f;
+};
+
+// 임포트 시 한 번 실행하는 인덱스/정점 순서 최적화 (삼각형 목록 전용, 지오메트리는 바꾸지 않음)
+// 보통 OptimizeVertexCache -> OptimizeOverdraw -> BuildVertexFetchRemap 순서로 적용
+
+VertexCacheStats AnalyzeVertexCache(const std::vector<unsigned int>& indices, size_t vertexCount, int cacheSize = 16);
+
+// Forsyth 알고리즘: 캐시(LRU 32)에 남은 정점과 남은 삼각형이 적은 정점을 우선해 삼각형 순서를 다시 정함
+void OptimizeVertexCache(std::vector<unsigned int>& indices, size_t vertexCount);
+
+// 캐시가 비워지는 지점에서 삼각형을 클러스터로 나누고(클러스터 ACMR이 threshold배를 넘지 않게 더 잘게 나눔),
+// 바깥을 향한 클러스터를 먼저 그리도록 정렬해 앞쪽 면이 뒤쪽 면을 먼저 가리게 함 (OptimizeVertexCache 뒤에 호출)
+// positions: 정점 위치(vec3)가 stride 바이트 간격으로 놓인 배열, 반환값은 클러스터 수
+size_t OptimizeOverdraw(std::vector<unsigned int>& indices, const float* positions, size_t stride, size_t vertexCount, float threshold = 1.05f);
+
+// 인덱스에서 처음 쓰이는 순서대로 정점 번호를 다시 매기는 표 (remap[기존 번호] = 새 번호, 쓰이지 않는 정점은 맨 뒤)
+// 정점을 읽는 순서가 메모리 순서와 같아져 정점 페치가 연속적으로 일어남
+std::vector<unsigned int> BuildVertexFetchRemap(const std::vector<unsigned int>& indices, size_t vertexCount);
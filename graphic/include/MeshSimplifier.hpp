@@ -0,0 +1,15 @@
+﻿#pragma once
+#include <vector>
+#include <functional>
+#include <cstddef>
+
+// 이차 오차(QEM) 기반 간선 붕괴로 삼각형 수를 줄인 인덱스 목록을 만듦
+// - 정점은 새로 만들지 않고 한 끝점을 다른 끝점으로 합치기만 하므로(half-edge collapse) 정점 버퍼/스킨 가중치를 그대로 공유
+// - 위치가 같은 정점은 하나로 보고 위상을 구하며, 열린 경계와 UV/법선 솔기(같은 위치에 정점이 여러 개)는 움직이지 않음
+// - 오차는 메시 경계 상자 대각선 길이에 대한 비율 (0.01 = 대각선의 1%)
+// positions: 정점 위치(vec3)가 stride 바이트 간격으로 놓인 배열
+// canCollapse(from, to): from 정점을 to 정점으로 합쳐도 되는지 (스킨 가중치가 크게 다른 정점끼리 합치지 않을 때 사용)
+// resultError: 실제로 적용된 붕괴의 최대 오차
+std::vector<unsigned int> SimplifyMesh(const float* positions, size_t stride, size_t vertexCount,
+    const std::vector<unsigned int>& indices, size_t targetIndexCount, float maxError,
+    const std::function<bool(unsigned int, unsigned int)>& canCollapse = {}, float* resultError = nullptr);
@@ -21,6 +21,9 @@ class Model
 public:
     Model(const std::string& path);
     const std::vector<std::shared_ptr<Mesh>>& GetMeshes() const { return meshes; }
+    //  ޽ ε   (ε  )
+    const AABB& GetBounds() const { return bounds; }
+    const BoundingSphere& GetBoundingSphere() const { return boundingSphere; }
 
     auto& GetBoneInfoMap() { return m_BoneInfoMap; }
     int& GetBoneCount() { return m_BoneCounter; }
@@ -28,6 +31,8 @@ public:
 private:
     std::vector<std::shared_ptr<Mesh>> meshes;
     std::string directory;
+    AABB bounds;
+    BoundingSphere boundingSphere;
 
     std::map<std::string, BoneInfo> m_BoneInfoMap; 
     Assimp::Importer importer;
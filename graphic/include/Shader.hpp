@@ -1,13 +1,36 @@
 #pragma once
 #include <string>
-#include <unordered_map>
 #include <unordered_set>
+#include <vector>
+#include <string_view>
+#include <cstdint>
 #include <glm.hpp>
+#include "StringHash.hpp"
+
+// 유니폼 이름의 FNV-1a 해시 (문자열 리터럴이면 컴파일 타임에 계산됨)
+// 예: constexpr UniformHandle MODEL_UNIFORM("model");
+struct UniformHandle
+{
+    constexpr explicit UniformHandle(std::string_view name) : hash(HashString(name)) {}
+    uint64_t hash;
+};
+
+// 유니폼 설정 비용 비교 결과 (반복 횟수만큼 드로우 하나 분량의 유니폼을 설정)
+struct UniformBenchmarkResult
+{
+    int iterations = 0;
+    float legacyMs = 0.0f;       // std::string 생성 + unordered_set/map 조회 (기존 방식) + glUniform
+    float hashedMs = 0.0f;       // 핸들(해시)로 평면 테이블 조회 + glUniform
+    float cachedMs = 0.0f;       // 미리 찾아둔 위치로 바로 glUniform
+    float legacyLookupMs = 0.0f; // 조회만 (glUniform 제외)
+    float hashedLookupMs = 0.0f;
+};
 
 class Shader
 {
 public:
-    Shader(const std::string& vertexPath, const std::string& fragmentPath);
+    // defines: #version 줄 바로 뒤에 "#define 이름"으로 삽입되어 같은 파일에서 변형 셰이더를 만듦 (예: INSTANCED)
+    Shader(const std::string& vertexPath_, const std::string& fragmentPath_, const std::vector<std::string>& defines_ = {});
     ~Shader();
 
     Shader(const Shader&) = delete;
@@ -19,24 +42,70 @@ public:
     void Bind() const;
     void Unbind() const;
 
-    void SetUniform1i(const std::string& name, int value);
-    void SetUniform1f(const std::string& name, float value);
-    void SetUniform3f(const std::string& name, float v0, float v1, float v2);
-    void SetUniform4f(const std::string& name, float v0, float v1, float v2, float v3);
-    void SetUniformVec3(const std::string& name, const glm::vec3& vector);
-    void SetUniformVec4(const std::string& name, const glm::vec4& vector);
-    void SetUniformMat4f(const std::string& name, const glm::mat4& matrix);
-    void SetUniformMat4fv(const std::string& name, int count, const glm::mat4& matrix);
+    // 이름으로 설정 (문자열 할당 없이 해시로 조회, 없는 유니폼이면 한 번만 경고)
+    void SetUniform1i(std::string_view name, int value) { SetUniform1i(FindUniformLocation(name), value); }
+    void SetUniform1f(std::string_view name, float value) { SetUniform1f(FindUniformLocation(name), value); }
+    void SetUniform3f(std::string_view name, float v0, float v1, float v2) { SetUniform3f(FindUniformLocation(name), v0, v1, v2); }
+    void SetUniform4f(std::string_view name, float v0, float v1, float v2, float v3) { SetUniform4f(FindUniformLocation(name), v0, v1, v2, v3); }
+    void SetUniformVec3(std::string_view name, const glm::vec3& vector) { SetUniformVec3(FindUniformLocation(name), vector); }
+    void SetUniformVec4(std::string_view name, const glm::vec4& vector) { SetUniformVec4(FindUniformLocation(name), vector); }
+    void SetUniformMat4f(std::string_view name, const glm::mat4& matrix) { SetUniformMat4f(FindUniformLocation(name), matrix); }
+    void SetUniformMat4fv(std::string_view name, int count, const glm::mat4& matrix) { SetUniformMat4fv(FindUniformLocation(name), count, matrix); }
+
+    // 위치로 바로 설정 (GetUniformLocation으로 한 번 찾아둔 값, -1이면 무시)
+    void SetUniform1i(int location, int value) const;
+    void SetUniform1f(int location, float value) const;
+    void SetUniform3f(int location, float v0, float v1, float v2) const;
+    void SetUniform4f(int location, float v0, float v1, float v2, float v3) const;
+    void SetUniformVec3(int location, const glm::vec3& vector) const;
+    void SetUniformVec4(int location, const glm::vec4& vector) const;
+    void SetUniformMat4f(int location, const glm::mat4& matrix) const;
+    void SetUniformMat4fv(int location, int count, const glm::mat4& matrix) const;
+
+    // 핸들로 위치를 찾음 (배열은 "이름"과 "이름[0]" 모두 가능, 없으면 -1)
+    int GetUniformLocation(UniformHandle handle) const;
+    bool HasUniform(UniformHandle handle) const { return GetUniformLocation(handle) != -1; }
+    bool HasUniform(std::string_view name) const { return HasUniform(UniformHandle(name)); }
+    // 활성 유니폼 블록의 크기(바이트, glBindBufferRange에 넘길 최소 크기), 블록이 없으면 0
+    int GetUniformBlockSize(UniformHandle handle) const;
+    bool HasUniformBlock(UniformHandle handle) const { return GetUniformBlockSize(handle) > 0; }
 
     int GetShaderID() { return rendererID; }
-    bool HasUniform(const std::string& name) const;
+    bool IsValid() const { return rendererID != 0; }
+    // 셰이더마다 고유한 번호 (주소나 프로그램 ID와 달리 재사용되지 않으므로 위치 캐시의 키로 사용)
+    uint32_t GetSerial() const { return serial; }
+
+    const std::string& GetVertexPath() const { return vertexPath; }
+    const std::string& GetFragmentPath() const { return fragmentPath; }
+    const std::vector<std::string>& GetDefines() const { return defines; }
+    // 소스에 "#ifdef 이름" 분기가 있어 해당 정의로 변형 셰이더를 만들 수 있는지 (예: INSTANCED, MULTI_LIGHT)
+    bool SupportsDefine(const std::string& define) const { return optionalDefines.count(define) > 0; }
 private:
     std::string ReadFile(const std::string& filepath);
+    static std::string InjectDefines(const std::string& source, const std::vector<std::string>& defines);
+    static void CollectOptionalDefines(const std::string& source, std::unordered_set<std::string>& outDefines);
     unsigned int CompileShader(unsigned int type, const std::string& source);
     unsigned int CreateProgram(const std::string& vertexShader, const std::string& fragmentShader);
-    int GetUniformLocation(const std::string& name);
+    void BuildUniformTable();
+    int FindUniformLocation(std::string_view name);
+
+    struct UniformSlot
+    {
+        uint64_t hash;
+        int location;
+    };
 
     unsigned int rendererID;
-    std::unordered_map<std::string, int> uniformLocationCache;
-    std::unordered_set<std::string> activeUniforms;
+    uint32_t serial;
+    std::vector<UniformSlot> uniformSlots; // 해시 순으로 정렬된 활성 유니폼 위치 (작아서 이진 탐색이 해시맵보다 빠름)
+    std::vector<UniformSlot> uniformBlockSlots; // 활성 유니폼 블록 (location 대신 블록 크기)
+    std::vector<uint64_t> reportedMissingUniforms;
+
+    std::string vertexPath;
+    std::string fragmentPath;
+    std::vector<std::string> defines;
+    std::unordered_set<std::string> optionalDefines; // 소스에서 찾은 #ifdef 이름들
 };
+
+// 기존 문자열 방식과 핸들/위치 캐시 방식의 유니폼 설정 비용 비교 (셰이더를 바인딩한 상태로 실행됨)
+UniformBenchmarkResult RunUniformBenchmark(Shader& shader, int iterations);
@@ -0,0 +1,75 @@
+﻿#pragma once
+#include <glew.h>
+#include <vector>
+#include <cstddef>
+
+// 링 버퍼에서 받은 구간 (buffer + offset을 glBindBufferRange / 인스턴스 버퍼 / 간접 명령 버퍼에 그대로 사용)
+struct StreamAllocation
+{
+    GLuint buffer = 0;
+    size_t offset = 0;
+    void* data = nullptr; // 매핑된 주소 (받은 직후에 기록, 버퍼가 커지면 이전 버퍼의 매핑은 해제됨)
+    bool IsValid() const { return buffer != 0; }
+};
+
+struct StreamRingStats
+{
+    size_t segmentSize = 0;     // 프레임 하나가 쓸 수 있는 바이트
+    size_t frameBytes = 0;      // 지난 프레임에 기록한 바이트 (정렬로 생긴 빈 공간 포함)
+    size_t peakFrameBytes = 0;
+    int frameAllocations = 0;   // 지난 프레임의 할당 횟수
+    int frameFenceWaits = 0;    // 지난 프레임 시작에서 GPU를 기다렸는지 (0 또는 1)
+    int totalFenceWaits = 0;
+    float fenceWaitMs = 0.0f;   // 지난 프레임 시작에서 기다린 시간
+    int growCount = 0;
+};
+
+// 프레임마다 새로 채우는 GPU 데이터(유니폼 블록, 라이트/클러스터 SSBO, 인스턴스, 간접 명령, 뼈 행렬)를 위한 스트리밍 버퍼
+// - 한 번 만든 버퍼를 영구 매핑(PERSISTENT | COHERENT)해 두고 memcpy로 기록하므로 glBufferSubData / 버퍼 재할당이 없음
+// - 버퍼를 FRAME_COUNT개의 구간으로 나눠 프레임마다 다음 구간을 쓰고, 프레임 끝에 펜스를 넣어
+//   같은 구간을 다시 쓰기 전에 GPU가 다 읽었는지 확인 (보통 이미 끝나 있어 기다리지 않음)
+// - 한 프레임에 구간이 모자라면 두 배 크기의 새 버퍼를 만들고, 이전 버퍼는 이번 프레임의 바인딩이 끝난 다음 프레임에 삭제
+class StreamRingBuffer
+{
+public:
+    static constexpr int FRAME_COUNT = 3;
+
+    explicit StreamRingBuffer(size_t segmentSize_ = 4 << 20);
+    ~StreamRingBuffer();
+
+    StreamRingBuffer(const StreamRingBuffer&) = delete;
+    StreamRingBuffer& operator=(const StreamRingBuffer&) = delete;
+
+    // 다음 프레임 구간으로 넘어감 (GPU가 아직 그 구간을 읽는 중이면 기다림)
+    void BeginFrame();
+    // 이번 프레임의 명령 뒤에 펜스를 넣음 (SwapWindow 전에 호출)
+    void EndFrame();
+
+    // alignment는 2의 거듭제곱 (유니폼 블록은 GetUniformAlignment, SSBO는 GetStorageAlignment)
+    StreamAllocation Allocate(size_t bytes, size_t alignment);
+    // 할당 후 data를 복사
+    StreamAllocation Write(const void* data, size_t bytes, size_t alignment);
+
+    size_t GetUniformAlignment() const { return uniformAlignment; }
+    size_t GetStorageAlignment() const { return storageAlignment; }
+    const StreamRingStats& GetStats() const { return stats; }
+
+private:
+    void CreateBuffer(size_t newSegmentSize);
+    void DeleteFences();
+
+    GLuint buffer = 0;
+    unsigned char* mappedData = nullptr;
+    size_t segmentSize = 0;
+    int segmentIndex = 0;
+    size_t head = 0; // 현재 구간 안에서 다음에 쓸 위치
+    GLsync fences[FRAME_COUNT] = {};
+    std::vector<GLuint> retiredBuffers; // 커지기 전 버퍼 (이번 프레임의 바인딩이 끝나면 삭제)
+
+    size_t uniformAlignment = 256;
+    size_t storageAlignment = 256;
+
+    StreamRingStats stats;
+    size_t currentFrameBytes = 0;
+    int currentFrameAllocations = 0;
+};
@@ -26,12 +26,18 @@ public:
 	void UnBind();
 
 	void AddVertexBuffer(VertexBuffer&& buffer, std::initializer_list<GLVertexArrayAttribFormat> bufferLayout);
+	void AddVertexBuffer(VertexBuffer&& buffer, const std::vector<GLVertexArrayAttribFormat>& bufferLayout);
 	void AddIndexBuffer(IndexBuffer&& buffer);
 
+	// 인스턴스 단위 속성 버퍼 연결 (divisor = 1)
+	// 속성 형식은 처음 한 번만 설정하고, 이후에는 버퍼와 오프셋만 바꿈
+	void BindInstanceBuffer(GLuint bufferHandle, GLintptr offset, GLsizei stride, std::initializer_list<GLVertexArrayAttribFormat> instanceLayout);
+
 	GLuint GetHandle() const noexcept { return arrayHandle; }
 	std::vector<VertexBuffer>& GetVertexBuffers() { return vertexBuffers; }
 	IndexBuffer& GetIndexBuffer() { return indexBuffer; }
 	GLsizei GetIndicesCount() const noexcept { return numIndices; }
+	GLenum GetIndexType() const noexcept { return indexBuffer.GetType(); }
 	GLsizei GetVertexCount() const { return numVertices; }
 	
 	void SetVertexCount(int count) { numVertices = count; }
@@ -41,4 +47,7 @@ private:
 	GLsizei                   numVertices = 0;
 	GLsizei                   numIndices = 0;
 	GLuint					  arrayHandle = 0;
+	bool					  instanceAttributesEnabled = false;
+
+	static constexpr GLuint INSTANCE_BINDING_INDEX = 15; // 정점 속성은 location과 같은 binding index를 사용하므로 겹치지 않는 번호
 };
\ No newline at end of file
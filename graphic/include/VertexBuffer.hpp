@@ -5,6 +5,8 @@ class VertexBuffer
 {
 public:
 	VertexBuffer() = default;
+	//   size_ Ʈ Ҵ (߿ SetData   ä)
+	explicit VertexBuffer(size_t size_);
 	template <typename T, auto N = std::dynamic_extent>
 	VertexBuffer(std::span<T, N> data, size_t size_)
 	{
@@ -0,0 +1,58 @@
+﻿#pragma once
+#include "VertexArray.hpp"
+#include "glm.hpp"
+#include <vector>
+#include <cstdint>
+
+struct Vertex;
+
+// 버텍스 버퍼 하나에 들어가는 속성들 (AddVertexBuffer에 그대로 넘기는 레이아웃, offset/stride 포함)
+struct VertexStreamFormat
+{
+    GLsizei stride = 0;
+    std::vector<GLVertexArrayAttribFormat> attributes;
+};
+
+// 메시가 GPU에 올라가는 형식: 스트림마다 별도의 버텍스 버퍼를 사용
+// 정적 메시는 기본 스트림만, 스키닝 메시는 기본 + 스키닝 스트림을 가지므로 정적 메시는 뼈 데이터를 읽지 않음
+// 형식은 아래 함수가 돌려주는 정적 객체만 사용 (주소로 같은 형식인지 비교)
+struct VertexFormat
+{
+    std::vector<VertexStreamFormat> streams;
+    // 모든 스트림을 합친 정점 하나의 크기
+    GLsizei GetVertexSize() const;
+};
+
+// 기본 스트림 (layout 0~3, 24바이트)
+// - 위치: float3
+// - 법선: 팔면체(octahedral) 사상 snorm16x2 (셰이더에서 DecodeOctahedralNormal로 복원)
+// - 색상: unorm8x4
+// - UV: half2
+struct PackedVertex
+{
+    glm::vec3 position;
+    int16_t normal[2];
+    uint8_t color[4];
+    uint16_t texCoord[2];
+};
+
+// 스키닝 스트림 (layout 4~5, 8바이트)
+// - 뼈 번호: uint8x4 (셰이더의 MAX_BONES 이하), 쓰지 않는 칸은 번호 0 / 가중치 0
+// - 가중치: unorm8x4 (합이 1이던 정점은 양자화 후에도 합이 정확히 255)
+struct PackedSkin
+{
+    uint8_t boneIDs[4];
+    uint8_t weights[4];
+};
+
+const VertexFormat& GetStaticVertexFormat();
+const VertexFormat& GetSkinnedVertexFormat();
+
+void EncodeOctahedralNormal(const glm::vec3& normal, int16_t encoded[2]);
+glm::vec3 DecodeOctahedralNormal(const int16_t encoded[2]);
+
+// Vertex 배열을 스트림별 배열로 변환 (skin이 nullptr이면 뼈 데이터는 버림)
+void PackVertices(const std::vector<Vertex>& vertices, std::vector<PackedVertex>& packed, std::vector<PackedSkin>* skin);
+
+// 스키닝 스트림이 없는 VAO에서 layout 4~5는 현재 일반 속성 값을 읽으므로 가중치 0으로 맞춤 (VAO가 아닌 컨텍스트 상태)
+void ResetSkinAttributeDefaults();
@@ -32,14 +32,19 @@ Bone::Bone(const std::string& name, int ID, const aiNodeAnim* channel)
 }
 
 void Bone::Update(float animationTime)
+{
+    localTransform = CalculateLocalTransform(animationTime);
+}
+
+glm::mat4 Bone::CalculateLocalTransform(float animationTime) const
 {
     glm::mat4 translation = InterpolatePosition(animationTime);
     glm::mat4 rotation = InterpolateRotation(animationTime);
     glm::mat4 scale = InterpolateScaling(animationTime);
-    localTransform = translation * rotation * scale;
+    return translation * rotation * scale;
 }
 
-glm::mat4 Bone::InterpolatePosition(float animationTime)
+glm::mat4 Bone::InterpolatePosition(float animationTime) const
 {
     if (numPositions == 1)
         return glm::translate(glm::mat4(1.0f), positions[0].position);
@@ -51,7 +56,7 @@ glm::mat4 Bone::InterpolatePosition(float animationTime)
     return glm::translate(glm::mat4(1.0f), finalPosition);
 }
 
-glm::mat4 Bone::InterpolateRotation(float animationTime)
+glm::mat4 Bone::InterpolateRotation(float animationTime) const
 {
     if (numRotations == 1) {
         auto rotation = glm::normalize(rotations[0].orientation);
@@ -66,7 +71,7 @@ glm::mat4 Bone::InterpolateRotation(float animationTime)
     return glm::toMat4(finalRotation);
 }
 
-glm::mat4 Bone::InterpolateScaling(float animationTime)
+glm::mat4 Bone::InterpolateScaling(float animationTime) const
 {
     if (numScales == 1)
         return glm::scale(glm::mat4(1.0f), scales[0].scale);
@@ -79,7 +84,7 @@ glm::mat4 Bone::InterpolateScaling(float animationTime)
 }
 
 
-glm::vec3 Bone::GetInterpolatedPosition(float animationTime)
+glm::vec3 Bone::GetInterpolatedPosition(float animationTime) const
 {
     if (numPositions == 1)
         return positions[0].position;
@@ -90,7 +95,7 @@ glm::vec3 Bone::GetInterpolatedPosition(float animationTime)
     return glm::mix(positions[p0Index].position, positions[p1Index].position, scaleFactor);
 }
 
-glm::quat Bone::GetInterpolatedRotation(float animationTime)
+glm::quat Bone::GetInterpolatedRotation(float animationTime) const
 {
     if (numRotations == 1)
         return glm::normalize(rotations[0].orientation);
@@ -102,7 +107,7 @@ glm::quat Bone::GetInterpolatedRotation(float animationTime)
     return glm::normalize(finalRotation);
 }
 
-glm::vec3 Bone::GetInterpolatedScale(float animationTime)
+glm::vec3 Bone::GetInterpolatedScale(float animationTime) const
 {
     if (numScales == 1)
         return scales[0].scale;
@@ -113,7 +118,7 @@ glm::vec3 Bone::GetInterpolatedScale(float animationTime)
     return glm::mix(scales[p0Index].scale, scales[p1Index].scale, scaleFactor);
 }
 
-int Bone::GetPositionIndex(float animationTime)
+int Bone::GetPositionIndex(float animationTime) const
 {
     for (int index = 0; index < numPositions - 1; ++index) {
         if (animationTime < positions[index + 1].timeStamp)
@@ -123,7 +128,7 @@ int Bone::GetPositionIndex(float animationTime)
     return 0;
 }
 
-int Bone::GetRotationIndex(float animationTime)
+int Bone::GetRotationIndex(float animationTime) const
 {
     for (int index = 0; index < numRotations - 1; ++index) {
         if (animationTime < rotations[index + 1].timeStamp)
@@ -132,7 +137,7 @@ int Bone::GetRotationIndex(float animationTime)
     return 0;
 }
 
-int Bone::GetScaleIndex(float animationTime)
+int Bone::GetScaleIndex(float animationTime) const
 {
     for (int index = 0; index < numScales - 1; ++index) {
         if (animationTime < scales[index + 1].timeStamp)
@@ -141,7 +146,7 @@ int Bone::GetScaleIndex(float animationTime)
     return 0;
 }
 
-float Bone::GetScaleFactor(float lastTimeStamp, float nextTimeStamp, float animationTime)
+float Bone::GetScaleFactor(float lastTimeStamp, float nextTimeStamp, float animationTime) const
 {
     float scaleFactor = 0.0f;
     float midWayLength = animationTime - lastTimeStamp;
@@ -0,0 +1,266 @@
+﻿#include "Bounds.hpp"
+#include <algorithm>
+#include <cmath>
+
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define BOUNDS_SIMD_SSE 1
+#include <emmintrin.h>
+#else
+#define BOUNDS_SIMD_SSE 0
+#endif
+
+namespace
+{
+    constexpr float INFINITE_EXTENT = 1e30f;
+}
+
+void AABB::Expand(const glm::vec3& point)
+{
+    min = glm::min(min, point);
+    max = glm::max(max, point);
+}
+
+void AABB::Expand(const AABB& other)
+{
+    min = glm::min(min, other.min);
+    max = glm::max(max, other.max);
+}
+
+AABB AABB::Transform(const glm::mat4& matrix) const
+{
+    if (!IsValid())
+    {
+        return *this;
+    }
+
+    // 새 중심 = M * 중심, 새 반폭 = |M의 3x3| * 반폭 (Arvo)
+    glm::vec3 center = GetCenter();
+    glm::vec3 extents = GetExtents();
+    glm::vec3 newCenter = glm::vec3(matrix * glm::vec4(center, 1.0f));
+    glm::vec3 newExtents(0.0f);
+    for (int column = 0; column < 3; ++column)
+    {
+        newExtents += glm::abs(glm::vec3(matrix[column])) * extents[column];
+    }
+    return { newCenter - newExtents, newCenter + newExtents };
+}
+
+bool AABB::OverlapsSphere(const glm::vec3& center, float radius) const
+{
+    glm::vec3 closest = glm::clamp(center, min, max);
+    glm::vec3 offset = closest - center;
+    return glm::dot(offset, offset) <= radius * radius;
+}
+
+bool AABB::IntersectRay(const glm::vec3& origin, const glm::vec3& inverseDirection, float maxDistance, float& hitDistance) const
+{
+    // 슬래브 판정: 축마다 들어가고 나오는 t를 구해 구간을 좁힘 (방향 성분이 0이면 무한대가 되어 해당 축은 제한하지 않음)
+    float tMin = 0.0f;
+    float tMax = maxDistance;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        float t0 = (min[axis] - origin[axis]) * inverseDirection[axis];
+        float t1 = (max[axis] - origin[axis]) * inverseDirection[axis];
+        if (t0 > t1)
+        {
+            std::swap(t0, t1);
+        }
+        // 출발점이 경계 평면 위에 있으면 0 * 무한대 = NaN이 되므로 fmax/fmin으로 무시
+        tMin = std::fmax(tMin, t0);
+        tMax = std::fmin(tMax, t1);
+        if (tMin > tMax)
+        {
+            return false;
+        }
+    }
+    hitDistance = tMin;
+    return true;
+}
+
+BoundingSphere BoundingSphere::Transform(const glm::mat4& matrix) const
+{
+    if (!IsValid())
+    {
+        return *this;
+    }
+    float scaleSq = std::max({ glm::dot(glm::vec3(matrix[0]), glm::vec3(matrix[0])),
+        glm::dot(glm::vec3(matrix[1]), glm::vec3(matrix[1])),
+        glm::dot(glm::vec3(matrix[2]), glm::vec3(matrix[2])) });
+    return { glm::vec3(matrix * glm::vec4(center, 1.0f)), radius * std::sqrt(scaleSq) };
+}
+
+void BoundsArray::Resize(size_t count)
+{
+    centerX.resize(count);
+    centerY.resize(count);
+    centerZ.resize(count);
+    extentX.resize(count);
+    extentY.resize(count);
+    extentZ.resize(count);
+}
+
+void BoundsArray::Set(size_t index, const AABB& bounds)
+{
+    glm::vec3 center = bounds.GetCenter();
+    glm::vec3 extents = bounds.GetExtents();
+    centerX[index] = center.x;
+    centerY[index] = center.y;
+    centerZ[index] = center.z;
+    extentX[index] = extents.x;
+    extentY[index] = extents.y;
+    extentZ[index] = extents.z;
+}
+
+void BoundsArray::SetInfinite(size_t index)
+{
+    centerX[index] = centerY[index] = centerZ[index] = 0.0f;
+    extentX[index] = extentY[index] = extentZ[index] = INFINITE_EXTENT;
+}
+
+void Frustum::Extract(const glm::mat4& viewProjection)
+{
+    // Gribb-Hartmann: 클립 공간의 -w <= x, y, z <= w 조건을 행 조합으로 표현 (glm은 열 우선이라 m[열][행])
+    glm::vec4 row0(viewProjection[0][0], viewProjection[1][0], viewProjection[2][0], viewProjection[3][0]);
+    glm::vec4 row1(viewProjection[0][1], viewProjection[1][1], viewProjection[2][1], viewProjection[3][1]);
+    glm::vec4 row2(viewProjection[0][2], viewProjection[1][2], viewProjection[2][2], viewProjection[3][2]);
+    glm::vec4 row3(viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3]);
+
+    planes[0] = row3 + row0; // 왼쪽
+    planes[1] = row3 - row0; // 오른쪽
+    planes[2] = row3 + row1; // 아래
+    planes[3] = row3 - row1; // 위
+    planes[4] = row3 + row2; // 가까운 면
+    planes[5] = row3 - row2; // 먼 면
+
+    for (glm::vec4& plane : planes)
+    {
+        float length = glm::length(glm::vec3(plane));
+        if (length > 0.0f)
+        {
+            plane /= length;
+        }
+    }
+}
+
+bool Frustum::TestAABB(const glm::vec3& center, const glm::vec3& extents) const
+{
+    // 상자를 평면 법선 방향으로 투영한 반지름보다 중심이 더 바깥이면 완전히 밖 (보수적: 모서리 근처는 보이는 것으로 판정)
+    for (const glm::vec4& plane : planes)
+    {
+        float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+        float radius = std::fabs(plane.x) * extents.x + std::fabs(plane.y) * extents.y + std::fabs(plane.z) * extents.z;
+        if (distance < -radius)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Frustum::TestSphere(const BoundingSphere& sphere) const
+{
+    for (const glm::vec4& plane : planes)
+    {
+        if (glm::dot(glm::vec3(plane), sphere.center) + plane.w < -sphere.radius)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+FrustumTest Frustum::ClassifyAABB(const AABB& bounds, uint8_t& planeMask) const
+{
+    glm::vec3 center = bounds.GetCenter();
+    glm::vec3 extents = bounds.GetExtents();
+    for (int p = 0; p < 6; ++p)
+    {
+        if ((planeMask & (1 << p)) == 0)
+        {
+            continue;
+        }
+        const glm::vec4& plane = planes[p];
+        float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+        float radius = std::fabs(plane.x) * extents.x + std::fabs(plane.y) * extents.y + std::fabs(plane.z) * extents.z;
+        if (distance < -radius)
+        {
+            return FrustumTest::Outside;
+        }
+        if (distance >= radius)
+        {
+            planeMask &= static_cast<uint8_t>(~(1 << p));
+        }
+    }
+    return planeMask == 0 ? FrustumTest::Inside : FrustumTest::Intersect;
+}
+
+int Frustum::CullBoxesScalar(const BoundsArray& bounds, size_t begin, uint8_t* visible) const
+{
+    int visibleCount = 0;
+    for (size_t i = begin; i < bounds.GetCount(); ++i)
+    {
+        bool inside = TestAABB(glm::vec3(bounds.centerX[i], bounds.centerY[i], bounds.centerZ[i]),
+            glm::vec3(bounds.extentX[i], bounds.extentY[i], bounds.extentZ[i]));
+        visible[i] = inside ? 1 : 0;
+        visibleCount += inside ? 1 : 0;
+    }
+    return visibleCount;
+}
+
+int Frustum::CullBoxes(const BoundsArray& bounds, std::vector<uint8_t>& visible, bool useSimd) const
+{
+    size_t count = bounds.GetCount();
+    visible.resize(count);
+    if (!useSimd)
+    {
+        return CullBoxesScalar(bounds, 0, visible.data());
+    }
+
+#if BOUNDS_SIMD_SSE
+    // 상자 4개 x 평면 6개: 평면 성분은 브로드캐스트, 상자 성분은 SoA 배열에서 그대로 읽음
+    __m128 planeX[6], planeY[6], planeZ[6], planeW[6], absX[6], absY[6], absZ[6];
+    __m128 signMask = _mm_set1_ps(-0.0f);
+    for (int p = 0; p < 6; ++p)
+    {
+        planeX[p] = _mm_set1_ps(planes[p].x);
+        planeY[p] = _mm_set1_ps(planes[p].y);
+        planeZ[p] = _mm_set1_ps(planes[p].z);
+        planeW[p] = _mm_set1_ps(planes[p].w);
+        absX[p] = _mm_andnot_ps(signMask, planeX[p]);
+        absY[p] = _mm_andnot_ps(signMask, planeY[p]);
+        absZ[p] = _mm_andnot_ps(signMask, planeZ[p]);
+    }
+
+    int visibleCount = 0;
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 cx = _mm_loadu_ps(bounds.centerX.data() + i);
+        __m128 cy = _mm_loadu_ps(bounds.centerY.data() + i);
+        __m128 cz = _mm_loadu_ps(bounds.centerZ.data() + i);
+        __m128 ex = _mm_loadu_ps(bounds.extentX.data() + i);
+        __m128 ey = _mm_loadu_ps(bounds.extentY.data() + i);
+        __m128 ez = _mm_loadu_ps(bounds.extentZ.data() + i);
+
+        // 스칼라 TestAABB와 같은 순서로 더해 결과가 같게 함
+        __m128 outside = _mm_setzero_ps();
+        for (int p = 0; p < 6; ++p)
+        {
+            __m128 distance = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(planeX[p], cx), _mm_mul_ps(planeY[p], cy)), _mm_mul_ps(planeZ[p], cz)), planeW[p]);
+            __m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(absX[p], ex), _mm_mul_ps(absY[p], ey)), _mm_mul_ps(absZ[p], ez));
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, _mm_xor_ps(radius, signMask)));
+        }
+
+        int outsideMask = _mm_movemask_ps(outside);
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            uint8_t inside = (outsideMask & (1 << lane)) ? 0 : 1;
+            visible[i + lane] = inside;
+            visibleCount += inside;
+        }
+    }
+    return visibleCount + CullBoxesScalar(bounds, i, visible.data());
+#else
+    return CullBoxesScalar(bounds, 0, visible.data());
+#endif
+}
@@ -0,0 +1,216 @@
+﻿#include "GeometryPool.hpp"
+#include <algorithm>
+
+void GeometryPool::RangeAllocator::Reset(size_t capacity_)
+{
+    freeRanges.clear();
+    capacity = capacity_;
+    used = 0;
+    if (capacity > 0)
+    {
+        freeRanges.emplace(0, capacity);
+    }
+}
+
+size_t GeometryPool::RangeAllocator::Allocate(size_t size)
+{
+    if (size == 0)
+    {
+        return 0;
+    }
+    for (auto it = freeRanges.begin(); it != freeRanges.end(); ++it)
+    {
+        if (it->second < size)
+        {
+            continue;
+        }
+        size_t offset = it->first;
+        size_t remaining = it->second - size;
+        freeRanges.erase(it);
+        if (remaining > 0)
+        {
+            freeRanges.emplace(offset + size, remaining);
+        }
+        used += size;
+        return offset;
+    }
+    return NO_SPACE;
+}
+
+void GeometryPool::RangeAllocator::Free(size_t offset, size_t size)
+{
+    if (size == 0)
+    {
+        return;
+    }
+    used -= size;
+    auto next = freeRanges.lower_bound(offset);
+    // 뒤쪽 빈 구간과 합침
+    if (next != freeRanges.end() && offset + size == next->first)
+    {
+        size += next->second;
+        next = freeRanges.erase(next);
+    }
+    // 앞쪽 빈 구간과 합침
+    if (next != freeRanges.begin())
+    {
+        auto previous = std::prev(next);
+        if (previous->first + previous->second == offset)
+        {
+            previous->second += size;
+            return;
+        }
+    }
+    freeRanges.emplace(offset, size);
+}
+
+void GeometryPool::RangeAllocator::Grow(size_t newCapacity)
+{
+    if (newCapacity <= capacity)
+    {
+        return;
+    }
+    size_t added = newCapacity - capacity;
+    size_t oldCapacity = capacity;
+    capacity = newCapacity;
+    if (!freeRanges.empty())
+    {
+        auto last = std::prev(freeRanges.end());
+        if (last->first + last->second == oldCapacity)
+        {
+            last->second += added;
+            return;
+        }
+    }
+    freeRanges.emplace(oldCapacity, added);
+}
+
+size_t GeometryPool::RangeAllocator::GetTailFree() const
+{
+    if (freeRanges.empty())
+    {
+        return 0;
+    }
+    auto last = std::prev(freeRanges.end());
+    return last->first + last->second == capacity ? last->second : 0;
+}
+
+GeometryPool::GeometryPool(const VertexFormat& vertexFormat_, GLenum indexType_, size_t initialVertexCapacity, size_t initialIndexCapacity)
+    : vertexFormat(&vertexFormat_), indexType(indexType_)
+{
+    vertexRanges.Reset(0);
+    indexRanges.Reset(0);
+    Reallocate(initialVertexCapacity, initialIndexCapacity);
+}
+
+void GeometryPool::Reallocate(size_t vertexCapacity, size_t indexCapacity)
+{
+    auto newVertexArray = std::make_unique<VertexArray>();
+    IndexBuffer newIndexBuffer(static_cast<unsigned int>(indexCapacity), indexType);
+
+    // 기존 내용은 CPU를 거치지 않고 GPU에서 복사 (해제된 구간도 함께 복사되지만 쓰이지 않음)
+    for (size_t stream = 0; stream < vertexFormat->streams.size(); ++stream)
+    {
+        const VertexStreamFormat& streamFormat = vertexFormat->streams[stream];
+        VertexBuffer newVertexBuffer(vertexCapacity * static_cast<size_t>(streamFormat.stride));
+        if (vertexArray)
+        {
+            glCopyNamedBufferSubData(vertexArray->GetVertexBuffers()[stream].GetHandle(), newVertexBuffer.GetHandle(), 0, 0,
+                static_cast<GLsizeiptr>(vertexRanges.GetCapacity() * static_cast<size_t>(streamFormat.stride)));
+        }
+        newVertexArray->AddVertexBuffer(std::move(newVertexBuffer), streamFormat.attributes);
+    }
+    if (vertexArray)
+    {
+        glCopyNamedBufferSubData(vertexArray->GetIndexBuffer().GetIndicesHandle(), newIndexBuffer.GetIndicesHandle(), 0, 0,
+            static_cast<GLsizeiptr>(indexRanges.GetCapacity() * newIndexBuffer.GetIndexSize()));
+        ++growCount;
+    }
+    newVertexArray->AddIndexBuffer(std::move(newIndexBuffer));
+    vertexArray = std::move(newVertexArray);
+
+    vertexRanges.Grow(vertexCapacity);
+    indexRanges.Grow(indexCapacity);
+}
+
+bool GeometryPool::Allocate(std::span<const void* const> streamData, size_t vertexCount, const unsigned int* indexData, size_t indexCount, GeometryRange& range)
+{
+    if (!vertexArray || streamData.size() != vertexFormat->streams.size()
+        || (indexType == GL_UNSIGNED_SHORT && vertexCount > 65536))
+    {
+        return false;
+    }
+
+    size_t vertexOffset = vertexRanges.Allocate(vertexCount);
+    size_t indexOffset = indexRanges.Allocate(indexCount);
+    if (vertexOffset == RangeAllocator::NO_SPACE || indexOffset == RangeAllocator::NO_SPACE)
+    {
+        if (vertexOffset != RangeAllocator::NO_SPACE) vertexRanges.Free(vertexOffset, vertexCount);
+        if (indexOffset != RangeAllocator::NO_SPACE) indexRanges.Free(indexOffset, indexCount);
+
+        // 끝의 빈 공간에 이어 붙일 수 있을 만큼 늘림 (최소 두 배)
+        size_t vertexCapacity = vertexRanges.GetCapacity();
+        size_t indexCapacity = indexRanges.GetCapacity();
+        if (vertexOffset == RangeAllocator::NO_SPACE)
+        {
+            vertexCapacity = std::max(vertexCapacity * 2, vertexCapacity + vertexCount - vertexRanges.GetTailFree());
+        }
+        if (indexOffset == RangeAllocator::NO_SPACE)
+        {
+            indexCapacity = std::max(indexCapacity * 2, indexCapacity + indexCount - indexRanges.GetTailFree());
+        }
+        Reallocate(vertexCapacity, indexCapacity);
+
+        vertexOffset = vertexRanges.Allocate(vertexCount);
+        indexOffset = indexRanges.Allocate(indexCount);
+    }
+
+    range.baseVertex = static_cast<unsigned int>(vertexOffset);
+    range.vertexCount = static_cast<unsigned int>(vertexCount);
+    range.firstIndex = static_cast<unsigned int>(indexOffset);
+    range.indexCount = static_cast<unsigned int>(indexCount);
+
+    if (vertexCount > 0)
+    {
+        for (size_t stream = 0; stream < streamData.size(); ++stream)
+        {
+            size_t stride = static_cast<size_t>(vertexFormat->streams[stream].stride);
+            glNamedBufferSubData(vertexArray->GetVertexBuffers()[stream].GetHandle(),
+                static_cast<GLintptr>(vertexOffset * stride), static_cast<GLsizeiptr>(vertexCount * stride), streamData[stream]);
+        }
+    }
+    if (indexCount > 0)
+    {
+        std::vector<uint16_t> shortIndices;
+        const void* uploadData = indexData;
+        if (indexType == GL_UNSIGNED_SHORT)
+        {
+            shortIndices.assign(indexData, indexData + indexCount);
+            uploadData = shortIndices.data();
+        }
+        size_t indexSize = vertexArray->GetIndexBuffer().GetIndexSize();
+        glNamedBufferSubData(vertexArray->GetIndexBuffer().GetIndicesHandle(),
+            static_cast<GLintptr>(indexOffset * indexSize), static_cast<GLsizeiptr>(indexCount * indexSize), uploadData);
+    }
+    ++allocationCount;
+    return true;
+}
+
+void GeometryPool::Free(const GeometryRange& range)
+{
+    if (!vertexArray)
+    {
+        return;
+    }
+    vertexRanges.Free(range.baseVertex, range.vertexCount);
+    indexRanges.Free(range.firstIndex, range.indexCount);
+    --allocationCount;
+}
+
+void GeometryPool::Release()
+{
+    vertexArray.reset();
+    vertexRanges.Reset(0);
+    indexRanges.Reset(0);
+    allocationCount = 0;
+}
@@ -8,13 +8,27 @@ IndexBuffer::IndexBuffer(std::span<const unsigned int> indices)
 	glNamedBufferStorage(indicesHandle, indices.size_bytes(), indices.data(), GL_DYNAMIC_STORAGE_BIT);
 }
 
+IndexBuffer::IndexBuffer(std::span<const uint16_t> indices)
+	: count(static_cast<int>(indices.size())), type(GL_UNSIGNED_SHORT)
+{
+	glCreateBuffers(1, &indicesHandle);
+	glNamedBufferStorage(indicesHandle, indices.size_bytes(), indices.data(), GL_DYNAMIC_STORAGE_BIT);
+}
+
+IndexBuffer::IndexBuffer(unsigned int count_, GLenum type_)
+	: count(count_), type(type_)
+{
+	glCreateBuffers(1, &indicesHandle);
+	glNamedBufferStorage(indicesHandle, static_cast<GLsizeiptr>(count_ * GetIndexSize()), nullptr, GL_DYNAMIC_STORAGE_BIT);
+}
+
 IndexBuffer::~IndexBuffer()
 {
 	glDeleteBuffers(1, &indicesHandle);
 }
 
 IndexBuffer::IndexBuffer(IndexBuffer&& other) noexcept
-    : indicesHandle(other.indicesHandle), count(other.count)
+    : indicesHandle(other.indicesHandle), count(other.count), type(other.type)
 {
     other.indicesHandle = 0;
     other.count = 0;
@@ -27,6 +41,7 @@ IndexBuffer& IndexBuffer::operator=(IndexBuffer&& other) noexcept
         glDeleteBuffers(1, &indicesHandle);
         indicesHandle = other.indicesHandle;
         count = other.count;
+        type = other.type;
         other.indicesHandle = 0;
         other.count = 0;
     }
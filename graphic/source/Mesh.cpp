@@ -1,44 +1,365 @@
 #include "Mesh.hpp"
 #define _USE_MATH_DEFINES
 #include <math.h>
+#include <algorithm>
+#include <map>
+#include <cmath>
+#include <functional>
+#include "MeshSimplifier.hpp"
+
+namespace
+{
+    // ֻ Ʈ Ѽ  ť ޽   ġ ʰ 
+    uint64_t MakeGeometryKey(ProceduralShape shape, int param0 = 0, int param1 = 0)
+    {
+        return (uint64_t(1) << 63) | (static_cast<uint64_t>(shape) << 48)
+            | (static_cast<uint64_t>(static_cast<uint32_t>(param0) & 0xFFFFFF) << 24)
+            | (static_cast<uint32_t>(param1) & 0xFFFFFF);
+    }
+}
+
+uint64_t Mesh::MakeProceduralKey(ProceduralShape shape, int param0, int param1)
+{
+    //  Create* Լ geometryKey  İ ƾ 
+    switch (shape)
+    {
+    case ProceduralShape::Sphere:   return MakeGeometryKey(shape, param0, param1);
+    case ProceduralShape::Cylinder: return MakeGeometryKey(shape, param0);
+    default:                        return MakeGeometryKey(shape);
+    }
+}
+
+void Mesh::CreateProcedural(ProceduralShape shape, int param0, int param1)
+{
+    switch (shape)
+    {
+    case ProceduralShape::Plane:    CreatePlane(); break;
+    case ProceduralShape::Cube:     CreateCube(); break;
+    case ProceduralShape::Sphere:   CreateSphere(param0, param1); break;
+    case ProceduralShape::Diamond:  CreateDiamond(); break;
+    case ProceduralShape::Cylinder: CreateCylinder(param0); break;
+    case ProceduralShape::Capsule:  CreateCapsule(); break;
+    case ProceduralShape::Cone:     CreateCone(); break;
+    }
+}
 
 Mesh::Mesh(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, PrimitivePattern pattern)
     : vertices(vertices), indices(indices), primitivePattern(pattern)
 {
+    ComputeBounds();
 }
 
-void Mesh::UploadToGPU()
+Mesh::~Mesh()
 {
-    VertexBuffer vb(std::span{ vertices }, vertices.size() * sizeof(Vertex));
-    IndexBuffer ib(std::span{ indices });
+    if (geometryPool)
+    {
+        geometryPool->Free(geometryRange);
+    }
+}
+
+void Mesh::UploadToGPU(const std::shared_ptr<GeometryPool>& pool)
+{
+    if (boundsDirty)
+    {
+        ComputeBounds();
+    }
+
+    // ٽ ø   /۸ ݳ
+    if (geometryPool)
+    {
+        geometryPool->Free(geometryRange);
+        geometryPool = nullptr;
+        geometryRange = GeometryRange();
+    }
+    vertexArray = nullptr;
+
+    // LOD   ڿ ̾ ٿ ϳ ε  ø (ܰ ο   )
+    std::vector<unsigned int> combinedIndices;
+    if (!lodIndices.empty())
+    {
+        combinedIndices.reserve(indices.size() + lodIndices.size());
+        combinedIndices.insert(combinedIndices.end(), indices.begin(), indices.end());
+        combinedIndices.insert(combinedIndices.end(), lodIndices.begin(), lodIndices.end());
+    }
+    const std::vector<unsigned int>& uploadIndices = lodIndices.empty() ? indices : combinedIndices;
+
+    // Ʈ   ( ޽ô  ͸ ø )
+    const VertexFormat& format = GetVertexFormat();
+    std::vector<PackedVertex> packedVertices;
+    std::vector<PackedSkin> packedSkin;
+    PackVertices(vertices, packedVertices, hasSkinnedVertices ? &packedSkin : nullptr);
+    if (!hasSkinnedVertices)
+    {
+        ResetSkinAttributeDefaults();
+    }
+    std::vector<const void*> streamData = { packedVertices.data() };
+    if (hasSkinnedVertices)
+    {
+        streamData.push_back(packedSkin.data());
+    }
+
+    if (pool && &pool->GetVertexFormat() == &format && pool->GetIndexType() == GetIndexType()
+        && pool->Allocate(streamData, vertices.size(), uploadIndices.data(), uploadIndices.size(), geometryRange))
+    {
+        geometryPool = pool;
+        return;
+    }
+
+    std::vector<uint16_t> shortIndices;
+    if (GetIndexType() == GL_UNSIGNED_SHORT)
+    {
+        shortIndices.assign(uploadIndices.begin(), uploadIndices.end());
+    }
+    IndexBuffer ib = GetIndexType() == GL_UNSIGNED_SHORT
+        ? IndexBuffer(std::span<const uint16_t>{ shortIndices })
+        : IndexBuffer(std::span<const unsigned int>{ uploadIndices });
 
     // VertexArray 
     vertexArray = std::make_unique<VertexArray>();
 
-    // VertexArray VertexBuffer   ̾ƿ 
-    vertexArray->AddVertexBuffer(std::move(vb), {
-            // layout 0: Position (vec3)
-        {.dimension = 3, .layoutLocation = 0, .offset = (GLintptr)offsetof(Vertex, position), .stride = sizeof(Vertex) },
-            // layout 1: normal (vec3)
-        {.dimension = 3, .layoutLocation = 1, .offset = (GLintptr)offsetof(Vertex, normal),   .stride = sizeof(Vertex) },
-            // layout 2: Color (vec3)
-        {.dimension = 3, .layoutLocation = 2, .offset = (GLintptr)offsetof(Vertex, color),    .stride = sizeof(Vertex) },
-            // layout 3: Texture Coordinate (vec2)
-        {.dimension = 2, .layoutLocation = 3, .offset = (GLintptr)offsetof(Vertex, texCoord), .stride = sizeof(Vertex) } ,
-            // layout 4 : Bone IDs
-        {.dimension = 4, .layoutLocation = 4, .type = GL_INT, .offset = (GLintptr)offsetof(Vertex, boneIDs), .stride = sizeof(Vertex), .isIntegerType = true },
-            // layout 5 : Weights
-        {.dimension = 4, .layoutLocation = 5, .offset = (GLintptr)offsetof(Vertex, weights), .stride = sizeof(Vertex) }
-        });
+    // Ʈ VertexBuffer   ̾ƿ 
+    vertexArray->AddVertexBuffer(VertexBuffer(std::span{ packedVertices }, packedVertices.size() * sizeof(PackedVertex)), format.streams[0].attributes);
+    if (hasSkinnedVertices)
+    {
+        vertexArray->AddVertexBuffer(VertexBuffer(std::span{ packedSkin }, packedSkin.size() * sizeof(PackedSkin)), format.streams[1].attributes);
+    }
 
     // VertexArray IndexBuffer 
     vertexArray->AddIndexBuffer(std::move(ib));
 }
 
+void Mesh::OptimizeForGpu()
+{
+    optimizationStats = MeshOptimizationStats();
+    if (primitivePattern != PrimitivePattern::Triangles || indices.size() < 3 || vertices.empty())
+    {
+        return;
+    }
+
+    optimizationStats.before = AnalyzeVertexCache(indices, vertices.size());
+    OptimizeVertexCache(indices, vertices.size());
+    optimizationStats.overdrawClusters = OptimizeOverdraw(indices, &vertices[0].position.x, sizeof(Vertex), vertices.size());
+
+    //  ε ó ̴  ű  ε  ȣ ٲ
+    std::vector<unsigned int> remap = BuildVertexFetchRemap(indices, vertices.size());
+    std::vector<Vertex> reordered(vertices.size());
+    for (size_t i = 0; i < vertices.size(); ++i)
+    {
+        reordered[remap[i]] = vertices[i];
+    }
+    vertices = std::move(reordered);
+    for (unsigned int& index : indices)
+    {
+        index = remap[index];
+    }
+    for (unsigned int& index : lodIndices)
+    {
+        index = remap[index];
+    }
+
+    optimizationStats.after = AnalyzeVertexCache(indices, vertices.size());
+    optimizationStats.optimized = true;
+}
+
+void Mesh::GenerateLods(int levelCount)
+{
+    // ̺  ޽ô ܼȭص ο   
+    constexpr size_t MIN_LOD_TRIANGLES = 64;
+    //  ܰ迡 ̸ŭ     
+    constexpr float MIN_REDUCTION = 0.85f;
+    // ܰ踶 ϴ  ( 밢 )
+    constexpr float MAX_LEVEL_ERROR = 0.02f;
+    //  ġ  (L1) ̺ ũ ġ  ( α  ޶ ʰ)
+    constexpr float MAX_SKIN_WEIGHT_DIFFERENCE = 0.5f;
+
+    lods.clear();
+    lodIndices.clear();
+    if (primitivePattern != PrimitivePattern::Triangles || indices.size() < MIN_LOD_TRIANGLES * 3)
+    {
+        return;
+    }
+
+    std::function<bool(unsigned int, unsigned int)> canCollapse;
+    if (hasSkinnedVertices)
+    {
+        canCollapse = [this](unsigned int from, unsigned int to)
+        {
+            const Vertex& a = vertices[from];
+            const Vertex& b = vertices[to];
+            float difference = 0.0f;
+            for (int i = 0; i < MAX_BONE_INFLUENCE; ++i)
+            {
+                float weightA = a.boneIDs[i] >= 0 ? a.weights[i] : 0.0f;
+                float weightB = 0.0f;
+                for (int j = 0; j < MAX_BONE_INFLUENCE; ++j)
+                {
+                    if (a.boneIDs[i] >= 0 && b.boneIDs[j] == a.boneIDs[i])
+                    {
+                        weightB = b.weights[j];
+                    }
+                }
+                difference += std::abs(weightA - weightB);
+            }
+            // b ִ 
+            for (int j = 0; j < MAX_BONE_INFLUENCE; ++j)
+            {
+                if (b.boneIDs[j] < 0)
+                {
+                    continue;
+                }
+                bool shared = false;
+                for (int i = 0; i < MAX_BONE_INFLUENCE; ++i)
+                {
+                    shared = shared || a.boneIDs[i] == b.boneIDs[j];
+                }
+                if (!shared)
+                {
+                    difference += b.weights[j];
+                }
+            }
+            return difference <= MAX_SKIN_WEIGHT_DIFFERENCE;
+        };
+    }
+
+    //  ܰ踦 ٽ ܼȭϹǷ  ܰ踶   
+    std::vector<unsigned int> previous = indices;
+    float accumulatedError = 0.0f;
+    for (int level = 1; level < std::min(levelCount, MAX_LOD_LEVELS); ++level)
+    {
+        if (previous.size() < MIN_LOD_TRIANGLES * 3)
+        {
+            break;
+        }
+        float levelError = 0.0f;
+        std::vector<unsigned int> simplified = SimplifyMesh(&vertices[0].position.x, sizeof(Vertex), vertices.size(),
+            previous, previous.size() / 6 * 3, MAX_LEVEL_ERROR, canCollapse, &levelError);
+        if (simplified.empty() || static_cast<float>(simplified.size()) > static_cast<float>(previous.size()) * MIN_REDUCTION)
+        {
+            break;
+        }
+        accumulatedError += levelError;
+        // ܼȭ ٲ ﰢ  ĳÿ ° ٽ 
+        OptimizeVertexCache(simplified, vertices.size());
+
+        MeshLod lod;
+        lod.firstIndex = static_cast<unsigned int>(indices.size() + lodIndices.size());
+        lod.indexCount = static_cast<unsigned int>(simplified.size());
+        lod.error = accumulatedError;
+        lods.push_back(lod);
+        lodIndices.insert(lodIndices.end(), simplified.begin(), simplified.end());
+        previous = std::move(simplified);
+    }
+}
+
+MeshLod Mesh::GetLod(int level) const
+{
+    MeshLod lod;
+    if (level <= 0 || lods.empty())
+    {
+        lod.indexCount = static_cast<unsigned int>(indices.size());
+    }
+    else
+    {
+        lod = lods[std::min(level, static_cast<int>(lods.size())) - 1];
+    }
+    lod.firstIndex += geometryRange.firstIndex;
+    return lod;
+}
+
+void Mesh::ComputeBounds()
+{
+    bounds = AABB();
+    unskinnedBounds = AABB();
+    boneBounds.clear();
+    hasSkinnedVertices = false;
+    minSkinWeightSum = 1.0f;
+    maxSkinWeightSum = 1.0f;
+
+    std::map<int, AABB> boundsPerBone;
+    for (const Vertex& vertex : vertices)
+    {
+        bounds.Expand(vertex.position);
+
+        // ̴ weights.x > 0   ķ Ű
+        if (vertex.weights[0] <= 0.0f)
+        {
+            unskinnedBounds.Expand(vertex.position);
+            continue;
+        }
+
+        float weightSum = 0.0f;
+        for (int i = 0; i < MAX_BONE_INFLUENCE; ++i)
+        {
+            if (vertex.boneIDs[i] != -1 && vertex.weights[i] > 0.0f)
+            {
+                boundsPerBone[vertex.boneIDs[i]].Expand(vertex.position);
+                weightSum += vertex.weights[i];
+            }
+        }
+        if (!hasSkinnedVertices)
+        {
+            minSkinWeightSum = maxSkinWeightSum = weightSum;
+            hasSkinnedVertices = true;
+        }
+        minSkinWeightSum = std::min(minSkinWeightSum, weightSum);
+        maxSkinWeightSum = std::max(maxSkinWeightSum, weightSum);
+    }
+    for (const auto& [boneID, boneBox] : boundsPerBone)
+    {
+        boneBounds.push_back({ boneID, boneBox });
+    }
+
+    //  AABB ߽ɿ    (  )
+    boundingSphere = BoundingSphere();
+    if (bounds.IsValid())
+    {
+        boundingSphere.center = bounds.GetCenter();
+        float radiusSq = 0.0f;
+        for (const Vertex& vertex : vertices)
+        {
+            glm::vec3 offset = vertex.position - boundingSphere.center;
+            radiusSq = std::max(radiusSq, glm::dot(offset, offset));
+        }
+        boundingSphere.radius = std::sqrt(radiusSq);
+    }
+    boundsDirty = false;
+}
+
+bool Mesh::ComputeSkinnedBounds(const std::vector<glm::mat4>& finalBoneMatrices, AABB& skinnedBounds) const
+{
+    AABB blended;
+    for (const BoneBounds& boneBox : boneBounds)
+    {
+        if (boneBox.boneID < 0 || boneBox.boneID >= static_cast<int>(finalBoneMatrices.size()))
+        {
+            return false;
+        }
+        blended.Expand(boneBox.bounds.Transform(finalBoneMatrices[boneBox.boneID]));
+    }
+
+    //  = ġ  s x (   )̹Ƿ s ּ/ִ  ø ڸ ħ (s  1̸ ״)
+    skinnedBounds = blended;
+    if (minSkinWeightSum != 1.0f || maxSkinWeightSum != 1.0f)
+    {
+        skinnedBounds = blended.Scale(minSkinWeightSum);
+        skinnedBounds.Expand(blended.Scale(maxSkinWeightSum));
+        if (!blended.IsValid())
+        {
+            // ȿ  ϳ  Ű  0 Ǿ  
+            skinnedBounds.Expand(glm::vec3(0.0f));
+        }
+    }
+    return true;
+}
+
 void Mesh::CreatePlane()
 {
+    geometryKey = MakeGeometryKey(ProceduralShape::Plane);
     vertices.clear();
     indices.clear();
+    lods.clear();
+    lodIndices.clear();
+    boundsDirty = true;
 
     vertices = {
         // ġ,                   (  ),   (),         ؽó ǥ
@@ -58,8 +379,12 @@ void Mesh::CreatePlane()
 
 void Mesh::CreateCube()
 {
+    geometryKey = MakeGeometryKey(ProceduralShape::Cube);
     vertices.clear();
     indices.clear();
+    lods.clear();
+    lodIndices.clear();
+    boundsDirty = true;
 
     vertices = {
         // ġ,                   ,                 ,             ؽó ǥ
@@ -108,6 +433,7 @@ void Mesh::CreateCube()
 
 void Mesh::CreateSphere(int stacks, int slices)
 {
+    geometryKey = MakeGeometryKey(ProceduralShape::Sphere, stacks, slices);
     // ⺻ 
     const float radius = 0.5f;
     const int sectorCount = slices;
@@ -115,6 +441,9 @@ void Mesh::CreateSphere(int stacks, int slices)
 
     vertices.clear();
     indices.clear();
+    lods.clear();
+    lodIndices.clear();
+    boundsDirty = true;
 
     float x, y, z, xy;                             
     float u, v;                                    
@@ -180,10 +509,14 @@ void Mesh::CreateSphere(int stacks, int slices)
 
 void Mesh::CreateDiamond()
 {
+    geometryKey = MakeGeometryKey(ProceduralShape::Diamond);
     const float size = 1.0f;
 
     vertices.clear();
     indices.clear();
+    lods.clear();
+    lodIndices.clear();
+    boundsDirty = true;
 
     float halfSize = size * 0.5f;
 
@@ -226,12 +559,16 @@ void Mesh::CreateDiamond()
 
 void Mesh::CreateCylinder(int segments_)
 {
+    geometryKey = MakeGeometryKey(ProceduralShape::Cylinder, segments_);
     const float radius = 0.5f;
     const float height = 1.0f;
     const int segments = segments_;
 
     vertices.clear();
     indices.clear();
+    lods.clear();
+    lodIndices.clear();
+    boundsDirty = true;
 
     float halfHeight = height / 2.0f;
 
@@ -295,6 +632,7 @@ void Mesh::CreateCylinder(int segments_)
 
 void Mesh::CreateCapsule()
 {
+    geometryKey = MakeGeometryKey(ProceduralShape::Capsule);
     const float radius = 0.5f;
     const float height = 1.0f;
     const int segments = 24;  
@@ -302,6 +640,9 @@ void Mesh::CreateCapsule()
 
     vertices.clear();
     indices.clear();
+    lods.clear();
+    lodIndices.clear();
+    boundsDirty = true;
 
     float cylinderHeight = height - 2.f * radius;
     if (cylinderHeight < 0) cylinderHeight = 0;
@@ -365,6 +706,7 @@ void Mesh::CreateCapsule()
 
 void Mesh::CreateCone()
 {
+    geometryKey = MakeGeometryKey(ProceduralShape::Cone);
     // ⺻ ũ 
     const float radius = 1.0f;
     const float height = 1.0f;
@@ -372,6 +714,9 @@ void Mesh::CreateCone()
 
     vertices.clear();
     indices.clear();
+    lods.clear();
+    lodIndices.clear();
+    boundsDirty = true;
 
     // ظ ߽
     vertices.push_back({ {0.0f, 0.0f, 0.0f}, {0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}, {0.5f, 0.5f} });
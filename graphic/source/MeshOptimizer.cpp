@@ -0,0 +1,348 @@
+﻿#include "MeshOptimizer.hpp"
+#include <glm.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    constexpr int FORSYTH_CACHE_SIZE = 32;
+    // 클러스터를 나눌 때 시뮬레이션하는 캐시 (AnalyzeVertexCache 기본값과 같은 FIFO 16)
+    constexpr unsigned int OVERDRAW_CACHE_SIZE = 16;
+
+    float ForsythVertexScore(int cachePosition, unsigned int remainingTriangles)
+    {
+        if (remainingTriangles == 0)
+        {
+            return -1.0f;
+        }
+        float score = 0.0f;
+        if (cachePosition >= 0)
+        {
+            // 방금 쓴 삼각형의 세 정점은 같은 점수 (어느 것부터 쓰든 미스가 없음)
+            if (cachePosition < 3)
+            {
+                score = 0.75f;
+            }
+            else
+            {
+                score = std::pow(1.0f - static_cast<float>(cachePosition - 3) / static_cast<float>(FORSYTH_CACHE_SIZE - 3), 1.5f);
+            }
+        }
+        // 남은 삼각형이 적은 정점을 먼저 끝내 나중에 혼자 남아 다시 읽히지 않게 함
+        score += 2.0f * std::pow(static_cast<float>(remainingTriangles), -0.5f);
+        return score;
+    }
+
+    // 타임스탬프 방식 FIFO 캐시: 마지막으로 들어온 시점이 cacheSize 이내면 캐시에 있음
+    unsigned int UpdateFifoCache(const unsigned int* triangle, unsigned int cacheSize, std::vector<unsigned int>& timestamps, unsigned int& timestamp)
+    {
+        unsigned int misses = 0;
+        for (int corner = 0; corner < 3; ++corner)
+        {
+            unsigned int vertex = triangle[corner];
+            if (timestamp - timestamps[vertex] > cacheSize)
+            {
+                timestamps[vertex] = timestamp++;
+                ++misses;
+            }
+        }
+        return misses;
+    }
+
+    glm::vec3 LoadPosition(const float* positions, size_t stride, unsigned int index)
+    {
+        const float* position = reinterpret_cast<const float*>(reinterpret_cast<const unsigned char*>(positions) + stride * index);
+        return glm::vec3(position[0], position[1], position[2]);
+    }
+}
+
+VertexCacheStats AnalyzeVertexCache(const std::vector<unsigned int>& indices, size_t vertexCount, int cacheSize)
+{
+    VertexCacheStats stats;
+    size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0 || vertexCount == 0 || cacheSize <= 0)
+    {
+        return stats;
+    }
+
+    std::vector<unsigned int> timestamps(vertexCount, 0);
+    std::vector<char> used(vertexCount, 0);
+    unsigned int timestamp = static_cast<unsigned int>(cacheSize) + 1;
+    size_t misses = 0;
+    size_t usedVertices = 0;
+    for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+    {
+        misses += UpdateFifoCache(&indices[triangle * 3], static_cast<unsigned int>(cacheSize), timestamps, timestamp);
+        for (int corner = 0; corner < 3; ++corner)
+        {
+            unsigned int vertex = indices[triangle * 3 + corner];
+            usedVertices += used[vertex] ? 0 : 1;
+            used[vertex] = 1;
+        }
+    }
+    stats.acmr = static_cast<float>(misses) / static_cast<float>(triangleCount);
+    stats.atvr = static_cast<float>(misses) / static_cast<float>(usedVertices);
+    return stats;
+}
+
+void OptimizeVertexCache(std::vector<unsigned int>& indices, size_t vertexCount)
+{
+    size_t triangleCount = indices.size() / 3;
+    if (triangleCount < 2 || vertexCount == 0)
+    {
+        return;
+    }
+
+    // 정점마다 아직 쓰지 않은 삼각형 목록 (adjacency[offset[v] .. offset[v] + remaining[v]])
+    std::vector<unsigned int> remaining(vertexCount, 0);
+    for (size_t i = 0; i < triangleCount * 3; ++i)
+    {
+        ++remaining[indices[i]];
+    }
+    std::vector<unsigned int> adjacencyOffset(vertexCount + 1, 0);
+    for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        adjacencyOffset[vertex + 1] = adjacencyOffset[vertex] + remaining[vertex];
+    }
+    std::vector<unsigned int> adjacency(triangleCount * 3);
+    {
+        std::vector<unsigned int> fill(adjacencyOffset.begin(), adjacencyOffset.end() - 1);
+        for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+        {
+            for (int corner = 0; corner < 3; ++corner)
+            {
+                adjacency[fill[indices[triangle * 3 + corner]]++] = static_cast<unsigned int>(triangle);
+            }
+        }
+    }
+
+    std::vector<int> cachePosition(vertexCount, -1);
+    std::vector<float> vertexScore(vertexCount);
+    for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        vertexScore[vertex] = ForsythVertexScore(-1, remaining[vertex]);
+    }
+    std::vector<float> triangleScore(triangleCount);
+    for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+    {
+        triangleScore[triangle] = vertexScore[indices[triangle * 3]] + vertexScore[indices[triangle * 3 + 1]] + vertexScore[indices[triangle * 3 + 2]];
+    }
+    std::vector<char> emitted(triangleCount, 0);
+
+    std::vector<unsigned int> result;
+    result.reserve(triangleCount * 3);
+    std::vector<unsigned int> cache;
+    std::vector<unsigned int> newCache;
+    cache.reserve(FORSYTH_CACHE_SIZE + 3);
+    newCache.reserve(FORSYTH_CACHE_SIZE + 3);
+
+    size_t scanCursor = 0;
+    size_t bestTriangle = static_cast<size_t>(std::max_element(triangleScore.begin(), triangleScore.end()) - triangleScore.begin());
+    for (size_t written = 0; written < triangleCount; ++written)
+    {
+        if (bestTriangle == triangleCount)
+        {
+            // 캐시에 이어지는 삼각형이 없으면 아직 쓰지 않은 다음 삼각형부터 새로 시작
+            while (emitted[scanCursor])
+            {
+                ++scanCursor;
+            }
+            bestTriangle = scanCursor;
+        }
+
+        const unsigned int* triangle = &indices[bestTriangle * 3];
+        result.insert(result.end(), triangle, triangle + 3);
+        emitted[bestTriangle] = 1;
+
+        // 쓴 삼각형을 각 정점의 남은 목록에서 뺌
+        for (int corner = 0; corner < 3; ++corner)
+        {
+            unsigned int vertex = triangle[corner];
+            unsigned int* begin = &adjacency[adjacencyOffset[vertex]];
+            unsigned int* end = begin + remaining[vertex];
+            unsigned int* found = std::find(begin, end, static_cast<unsigned int>(bestTriangle));
+            if (found != end)
+            {
+                *found = *(end - 1);
+                --remaining[vertex];
+            }
+        }
+
+        // LRU 캐시 갱신: 방금 쓴 세 정점을 앞에 두고 나머지를 뒤로 밀어냄
+        newCache.assign(triangle, triangle + 3);
+        for (unsigned int vertex : cache)
+        {
+            if (vertex != triangle[0] && vertex != triangle[1] && vertex != triangle[2])
+            {
+                newCache.push_back(vertex);
+            }
+        }
+        for (size_t i = 0; i < newCache.size(); ++i)
+        {
+            cachePosition[newCache[i]] = i < FORSYTH_CACHE_SIZE ? static_cast<int>(i) : -1;
+        }
+
+        // 캐시에 있던(또는 방금 빠진) 정점의 점수가 바뀌었으므로 이웃 삼각형 점수에 반영
+        for (unsigned int vertex : newCache)
+        {
+            float score = ForsythVertexScore(cachePosition[vertex], remaining[vertex]);
+            float delta = score - vertexScore[vertex];
+            vertexScore[vertex] = score;
+            for (unsigned int i = 0; i < remaining[vertex]; ++i)
+            {
+                triangleScore[adjacency[adjacencyOffset[vertex] + i]] += delta;
+            }
+        }
+        if (newCache.size() > FORSYTH_CACHE_SIZE)
+        {
+            newCache.resize(FORSYTH_CACHE_SIZE);
+        }
+        cache.swap(newCache);
+
+        // 다음 삼각형은 캐시에 있는 정점에 붙은 삼각형 중 점수가 가장 높은 것
+        bestTriangle = triangleCount;
+        float bestScore = -1.0f;
+        for (unsigned int vertex : cache)
+        {
+            for (unsigned int i = 0; i < remaining[vertex]; ++i)
+            {
+                unsigned int candidate = adjacency[adjacencyOffset[vertex] + i];
+                if (triangleScore[candidate] > bestScore)
+                {
+                    bestScore = triangleScore[candidate];
+                    bestTriangle = candidate;
+                }
+            }
+        }
+    }
+    indices.swap(result);
+}
+
+size_t OptimizeOverdraw(std::vector<unsigned int>& indices, const float* positions, size_t stride, size_t vertexCount, float threshold)
+{
+    size_t triangleCount = indices.size() / 3;
+    if (triangleCount < 2 || vertexCount == 0)
+    {
+        return triangleCount;
+    }
+
+    // 1. 캐시가 완전히 비워진 것처럼 세 정점이 모두 미스인 삼각형에서 클러스터를 나눔 (나눠도 캐시 효율이 거의 그대로)
+    std::vector<unsigned int> timestamps(vertexCount, 0);
+    unsigned int timestamp = OVERDRAW_CACHE_SIZE + 1;
+    std::vector<unsigned int> triangleMisses(triangleCount);
+    std::vector<size_t> hardClusters;
+    for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+    {
+        triangleMisses[triangle] = UpdateFifoCache(&indices[triangle * 3], OVERDRAW_CACHE_SIZE, timestamps, timestamp);
+        if (triangle == 0 || triangleMisses[triangle] == 3)
+        {
+            hardClusters.push_back(triangle);
+        }
+    }
+    hardClusters.push_back(triangleCount);
+
+    // 2. 클러스터 안에서 처음부터 센 ACMR이 클러스터 전체 ACMR * threshold 이하로 내려오는 지점마다 더 나눔
+    std::vector<size_t> clusters;
+    for (size_t hard = 0; hard + 1 < hardClusters.size(); ++hard)
+    {
+        size_t start = hardClusters[hard];
+        size_t end = hardClusters[hard + 1];
+        unsigned int clusterMisses = 0;
+        for (size_t triangle = start; triangle < end; ++triangle)
+        {
+            clusterMisses += triangleMisses[triangle];
+        }
+        float clusterThreshold = threshold * static_cast<float>(clusterMisses) / static_cast<float>(end - start);
+
+        clusters.push_back(start);
+        timestamp += OVERDRAW_CACHE_SIZE + 1; // 캐시 비움
+        unsigned int runningMisses = 0;
+        unsigned int runningTriangles = 0;
+        for (size_t triangle = start; triangle < end; ++triangle)
+        {
+            runningMisses += UpdateFifoCache(&indices[triangle * 3], OVERDRAW_CACHE_SIZE, timestamps, timestamp);
+            ++runningTriangles;
+            if (static_cast<float>(runningMisses) / static_cast<float>(runningTriangles) <= clusterThreshold && triangle + 1 < end)
+            {
+                clusters.push_back(triangle + 1);
+                timestamp += OVERDRAW_CACHE_SIZE + 1;
+                runningMisses = 0;
+                runningTriangles = 0;
+            }
+        }
+    }
+    clusters.push_back(triangleCount);
+
+    // 3. 클러스터의 면적 가중 중심이 메시 중심에서 클러스터 평균 법선 방향으로 멀수록(바깥을 향할수록) 먼저 그림
+    glm::vec3 meshCentroid(0.0f);
+    float meshArea = 0.0f;
+    size_t clusterCount = clusters.size() - 1;
+    std::vector<glm::vec3> clusterCentroids(clusterCount, glm::vec3(0.0f));
+    std::vector<glm::vec3> clusterNormals(clusterCount, glm::vec3(0.0f));
+    for (size_t cluster = 0; cluster < clusterCount; ++cluster)
+    {
+        float clusterArea = 0.0f;
+        for (size_t triangle = clusters[cluster]; triangle < clusters[cluster + 1]; ++triangle)
+        {
+            glm::vec3 a = LoadPosition(positions, stride, indices[triangle * 3]);
+            glm::vec3 b = LoadPosition(positions, stride, indices[triangle * 3 + 1]);
+            glm::vec3 c = LoadPosition(positions, stride, indices[triangle * 3 + 2]);
+            glm::vec3 normal = glm::cross(b - a, c - a);
+            float area = glm::length(normal);
+            glm::vec3 center = (a + b + c) / 3.0f;
+            clusterCentroids[cluster] += center * area;
+            clusterNormals[cluster] += normal;
+            clusterArea += area;
+            meshCentroid += center * area;
+            meshArea += area;
+        }
+        clusterCentroids[cluster] = clusterArea > 0.0f ? clusterCentroids[cluster] / clusterArea : glm::vec3(0.0f);
+    }
+    meshCentroid = meshArea > 0.0f ? meshCentroid / meshArea : glm::vec3(0.0f);
+
+    std::vector<float> sortKeys(clusterCount, 0.0f);
+    std::vector<size_t> order(clusterCount);
+    for (size_t cluster = 0; cluster < clusterCount; ++cluster)
+    {
+        order[cluster] = cluster;
+        float normalLength = glm::length(clusterNormals[cluster]);
+        if (normalLength > 0.0f)
+        {
+            sortKeys[cluster] = glm::dot(clusterCentroids[cluster] - meshCentroid, clusterNormals[cluster] / normalLength);
+        }
+    }
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return sortKeys[a] > sortKeys[b]; });
+
+    std::vector<unsigned int> result;
+    result.reserve(triangleCount * 3);
+    for (size_t cluster : order)
+    {
+        result.insert(result.end(), indices.begin() + clusters[cluster] * 3, indices.begin() + clusters[cluster + 1] * 3);
+    }
+    // 삼각형 목록이 아닌 나머지 인덱스(3의 배수가 아닌 꼬리)는 그대로 둠
+    result.insert(result.end(), indices.begin() + triangleCount * 3, indices.end());
+    indices.swap(result);
+    return clusterCount;
+}
+
+std::vector<unsigned int> BuildVertexFetchRemap(const std::vector<unsigned int>& indices, size_t vertexCount)
+{
+    constexpr unsigned int UNUSED = ~0u;
+    std::vector<unsigned int> remap(vertexCount, UNUSED);
+    unsigned int next = 0;
+    for (unsigned int index : indices)
+    {
+        if (remap[index] == UNUSED)
+        {
+            remap[index] = next++;
+        }
+    }
+    for (unsigned int& target : remap)
+    {
+        if (target == UNUSED)
+        {
+            target = next++;
+        }
+    }
+    return remap;
+}
@@ -0,0 +1,466 @@
+﻿#include "MeshSimplifier.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+
+namespace
+{
+    // 평면까지 거리 제곱의 합을 나타내는 대칭 4x4 행렬 (Garland-Heckbert), weight는 더해진 면적
+    struct Quadric
+    {
+        double a00 = 0.0, a11 = 0.0, a22 = 0.0, a10 = 0.0, a20 = 0.0, a21 = 0.0;
+        double b0 = 0.0, b1 = 0.0, b2 = 0.0;
+        double c = 0.0;
+        double weight = 0.0;
+
+        void AddPlane(double nx, double ny, double nz, double d, double w)
+        {
+            a00 += w * nx * nx; a11 += w * ny * ny; a22 += w * nz * nz;
+            a10 += w * ny * nx; a20 += w * nz * nx; a21 += w * nz * ny;
+            b0 += w * nx * d; b1 += w * ny * d; b2 += w * nz * d;
+            c += w * d * d;
+            weight += w;
+        }
+
+        void Add(const Quadric& other)
+        {
+            a00 += other.a00; a11 += other.a11; a22 += other.a22;
+            a10 += other.a10; a20 += other.a20; a21 += other.a21;
+            b0 += other.b0; b1 += other.b1; b2 += other.b2;
+            c += other.c;
+            weight += other.weight;
+        }
+
+        // 점 p에서의 면적 가중 평균 거리 제곱
+        double Evaluate(const float* p) const
+        {
+            const double x = p[0], y = p[1], z = p[2];
+            const double r = a00 * x * x + a11 * y * y + a22 * z * z
+                + 2.0 * (a10 * x * y + a20 * x * z + a21 * y * z)
+                + 2.0 * (b0 * x + b1 * y + b2 * z) + c;
+            return weight > 0.0 ? std::fabs(r) / weight : std::fabs(r);
+        }
+    };
+
+    struct Collapse
+    {
+        unsigned int from; // 위치 대표 정점
+        unsigned int to;
+        float cost;
+    };
+
+    void Cross(const float* a, const float* b, const float* c, float* out)
+    {
+        const float e0[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+        const float e1[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+        out[0] = e0[1] * e1[2] - e0[2] * e1[1];
+        out[1] = e0[2] * e1[0] - e0[0] * e1[2];
+        out[2] = e0[0] * e1[1] - e0[1] * e1[0];
+    }
+
+    uint64_t EdgeKey(unsigned int a, unsigned int b)
+    {
+        return a < b ? (uint64_t(a) << 32) | b : (uint64_t(b) << 32) | a;
+    }
+}
+
+std::vector<unsigned int> SimplifyMesh(const float* positions, size_t stride, size_t vertexCount,
+    const std::vector<unsigned int>& indices, size_t targetIndexCount, float maxError,
+    const std::function<bool(unsigned int, unsigned int)>& canCollapse, float* resultError)
+{
+    if (resultError)
+    {
+        *resultError = 0.0f;
+    }
+    const size_t triangleCount = indices.size() / 3;
+    if (positions == nullptr || vertexCount == 0 || triangleCount == 0 || indices.size() <= targetIndexCount)
+    {
+        return indices;
+    }
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(positions);
+    auto sourcePosition = [&](unsigned int v) { return reinterpret_cast<const float*>(bytes + v * stride); };
+
+    // 1. 정점 데이터(stride 바이트 전체)가 같은 정점을 하나로 합침 (임포트 시 면마다 정점이 따로 만들어진 경우)
+    std::vector<unsigned int> unique(vertexCount);
+    {
+        std::unordered_map<std::string_view, unsigned int> table;
+        table.reserve(vertexCount);
+        for (unsigned int v = 0; v < vertexCount; ++v)
+        {
+            const std::string_view key(reinterpret_cast<const char*>(bytes + v * stride), stride);
+            unique[v] = table.try_emplace(key, v).first->second;
+        }
+    }
+
+    // 2. 위치를 경계 상자 대각선 기준으로 정규화하고 위치가 같은 정점을 같은 위상 정점(대표 정점)으로 묶음
+    float boundsMin[3] = { sourcePosition(0)[0], sourcePosition(0)[1], sourcePosition(0)[2] };
+    float boundsMax[3] = { boundsMin[0], boundsMin[1], boundsMin[2] };
+    for (unsigned int v = 1; v < vertexCount; ++v)
+    {
+        const float* p = sourcePosition(v);
+        for (int k = 0; k < 3; ++k)
+        {
+            boundsMin[k] = std::min(boundsMin[k], p[k]);
+            boundsMax[k] = std::max(boundsMax[k], p[k]);
+        }
+    }
+    const float extent[3] = { boundsMax[0] - boundsMin[0], boundsMax[1] - boundsMin[1], boundsMax[2] - boundsMin[2] };
+    const float diagonal = std::sqrt(extent[0] * extent[0] + extent[1] * extent[1] + extent[2] * extent[2]);
+    const float scale = diagonal > 0.0f ? 1.0f / diagonal : 1.0f;
+
+    std::vector<float> points(vertexCount * 3);
+    std::vector<unsigned int> remap(vertexCount);
+    {
+        std::unordered_map<std::string_view, unsigned int> table;
+        table.reserve(vertexCount);
+        for (unsigned int v = 0; v < vertexCount; ++v)
+        {
+            const float* p = sourcePosition(v);
+            for (int k = 0; k < 3; ++k)
+            {
+                points[v * 3 + k] = (p[k] - boundsMin[k]) * scale;
+            }
+            const std::string_view key(reinterpret_cast<const char*>(p), sizeof(float) * 3);
+            remap[v] = table.try_emplace(key, v).first->second;
+        }
+    }
+
+    // 같은 위치에 서로 다른 정점이 둘 이상이면 UV/법선 솔기
+    std::vector<unsigned int> wedge(vertexCount, UINT32_MAX);
+    std::vector<unsigned char> locked(vertexCount, 0);
+
+    // 삼각형은 원래 정점 번호로 저장하고 위상 비교는 remap으로 함 (같은 위치로 겹친 삼각형은 버림)
+    std::vector<unsigned int> corners;
+    corners.reserve(indices.size());
+    for (size_t t = 0; t < triangleCount; ++t)
+    {
+        unsigned int tri[3];
+        for (int k = 0; k < 3; ++k)
+        {
+            const unsigned int v = indices[t * 3 + k];
+            if (v >= vertexCount)
+            {
+                return indices;
+            }
+            tri[k] = unique[v];
+        }
+        if (remap[tri[0]] == remap[tri[1]] || remap[tri[1]] == remap[tri[2]] || remap[tri[0]] == remap[tri[2]])
+        {
+            continue;
+        }
+        for (int k = 0; k < 3; ++k)
+        {
+            const unsigned int v = tri[k];
+            unsigned int& w = wedge[remap[v]];
+            if (w == UINT32_MAX)
+            {
+                w = v;
+            }
+            else if (w != v)
+            {
+                locked[remap[v]] = 1;
+            }
+            corners.push_back(v);
+        }
+    }
+    const size_t liveCount = corners.size() / 3;
+    if (liveCount == 0)
+    {
+        return indices;
+    }
+
+    // 3. 열린 경계(삼각형 하나만 쓰는 간선)와 비다양체 간선(셋 이상)의 끝점은 고정
+    {
+        std::unordered_map<uint64_t, int> edgeUse;
+        edgeUse.reserve(corners.size());
+        for (size_t t = 0; t < liveCount; ++t)
+        {
+            for (int k = 0; k < 3; ++k)
+            {
+                ++edgeUse[EdgeKey(remap[corners[t * 3 + k]], remap[corners[t * 3 + (k + 1) % 3]])];
+            }
+        }
+        for (const auto& [key, count] : edgeUse)
+        {
+            if (count != 2)
+            {
+                locked[static_cast<unsigned int>(key >> 32)] = 1;
+                locked[static_cast<unsigned int>(key & 0xffffffffu)] = 1;
+            }
+        }
+    }
+
+    // 4. 면적 가중 평면 이차식을 각 대표 정점에 누적하고 대표 정점별 인접 삼각형 목록을 만듦
+    std::vector<Quadric> quadrics(vertexCount);
+    std::vector<std::vector<unsigned int>> adjacency(vertexCount);
+    for (unsigned int t = 0; t < liveCount; ++t)
+    {
+        const unsigned int a = remap[corners[t * 3 + 0]];
+        const unsigned int b = remap[corners[t * 3 + 1]];
+        const unsigned int c = remap[corners[t * 3 + 2]];
+        float n[3];
+        Cross(&points[a * 3], &points[b * 3], &points[c * 3], n);
+        const double length = std::sqrt(double(n[0]) * n[0] + double(n[1]) * n[1] + double(n[2]) * n[2]);
+        if (length > 0.0)
+        {
+            const double nx = n[0] / length, ny = n[1] / length, nz = n[2] / length;
+            const double d = -(nx * points[a * 3] + ny * points[a * 3 + 1] + nz * points[a * 3 + 2]);
+            const double area = length * 0.5;
+            quadrics[a].AddPlane(nx, ny, nz, d, area);
+            quadrics[b].AddPlane(nx, ny, nz, d, area);
+            quadrics[c].AddPlane(nx, ny, nz, d, area);
+        }
+        adjacency[a].push_back(t);
+        adjacency[b].push_back(t);
+        adjacency[c].push_back(t);
+    }
+
+    std::vector<unsigned char> alive(liveCount, 1);
+    size_t indexCount = corners.size();
+    const double errorLimit = double(maxError) * double(maxError);
+    double appliedError = 0.0;
+
+    std::vector<Collapse> candidates;
+    std::vector<unsigned char> touched(vertexCount, 0);
+    std::vector<unsigned int> neighborsFrom, neighborsTo;
+
+    auto collectNeighbors = [&](unsigned int v, std::vector<unsigned int>& out)
+        {
+            out.clear();
+            for (unsigned int t : adjacency[v])
+            {
+                if (!alive[t])
+                {
+                    continue;
+                }
+                for (int k = 0; k < 3; ++k)
+                {
+                    const unsigned int n = remap[corners[t * 3 + k]];
+                    if (n != v)
+                    {
+                        out.push_back(n);
+                    }
+                }
+            }
+            std::sort(out.begin(), out.end());
+            out.erase(std::unique(out.begin(), out.end()), out.end());
+        };
+
+    // 5. 한 번에 비용이 낮은 붕괴부터 서로 겹치지 않게 적용하고, 목표에 닿거나 더 줄일 수 없을 때까지 반복
+    while (indexCount > targetIndexCount)
+    {
+        candidates.clear();
+        for (unsigned int t = 0; t < liveCount; ++t)
+        {
+            if (!alive[t])
+            {
+                continue;
+            }
+            for (int k = 0; k < 3; ++k)
+            {
+                const unsigned int a = remap[corners[t * 3 + k]];
+                const unsigned int b = remap[corners[t * 3 + (k + 1) % 3]];
+                // 간선은 양쪽 삼각형에서 한 번씩 나오므로 a < b 방향에서만 두 방향 후보를 넣음
+                if (a > b)
+                {
+                    continue;
+                }
+                Quadric sum = quadrics[a];
+                sum.Add(quadrics[b]);
+                if (!locked[a])
+                {
+                    candidates.push_back({ a, b, float(sum.Evaluate(&points[b * 3])) });
+                }
+                if (!locked[b])
+                {
+                    candidates.push_back({ b, a, float(sum.Evaluate(&points[a * 3])) });
+                }
+            }
+        }
+        if (candidates.empty())
+        {
+            break;
+        }
+        std::sort(candidates.begin(), candidates.end(), [](const Collapse& l, const Collapse& r) { return l.cost < r.cost; });
+        std::fill(touched.begin(), touched.end(), 0);
+
+        size_t collapsed = 0;
+        for (const Collapse& candidate : candidates)
+        {
+            if (indexCount <= targetIndexCount)
+            {
+                break;
+            }
+            if (candidate.cost > errorLimit)
+            {
+                break;
+            }
+            const unsigned int from = candidate.from;
+            const unsigned int to = candidate.to;
+            if (touched[from] || touched[to])
+            {
+                continue;
+            }
+
+            // 공유 삼각형에서 to 쪽 정점을 고름 (to가 솔기 위에 있으면 공유 삼각형들이 같은 정점을 써야 함)
+            unsigned int sharedCount = 0;
+            unsigned int toWedge = UINT32_MAX;
+            unsigned int fromWedge = UINT32_MAX;
+            bool consistent = true;
+            for (unsigned int t : adjacency[from])
+            {
+                if (!alive[t])
+                {
+                    continue;
+                }
+                for (int k = 0; k < 3; ++k)
+                {
+                    const unsigned int v = corners[t * 3 + k];
+                    if (remap[v] == from)
+                    {
+                        fromWedge = v;
+                    }
+                    else if (remap[v] == to)
+                    {
+                        ++sharedCount;
+                        if (toWedge != UINT32_MAX && toWedge != v)
+                        {
+                            consistent = false;
+                        }
+                        toWedge = v;
+                    }
+                }
+            }
+            if (sharedCount != 2 || !consistent || fromWedge == UINT32_MAX)
+            {
+                continue;
+            }
+            if (canCollapse && !canCollapse(fromWedge, toWedge))
+            {
+                continue;
+            }
+
+            // 링크 조건: 두 끝점의 공통 이웃은 공유 삼각형의 나머지 꼭짓점 둘뿐이어야 위상이 유지됨
+            collectNeighbors(from, neighborsFrom);
+            collectNeighbors(to, neighborsTo);
+            size_t common = 0;
+            for (size_t i = 0, j = 0; i < neighborsFrom.size() && j < neighborsTo.size();)
+            {
+                if (neighborsFrom[i] < neighborsTo[j]) ++i;
+                else if (neighborsFrom[i] > neighborsTo[j]) ++j;
+                else { ++common; ++i; ++j; }
+            }
+            if (common != 2)
+            {
+                continue;
+            }
+
+            // 남는 삼각형이 뒤집히거나 퇴화하지 않는지 확인
+            bool flips = false;
+            for (unsigned int t : adjacency[from])
+            {
+                if (!alive[t])
+                {
+                    continue;
+                }
+                unsigned int tri[3];
+                bool hasTo = false;
+                for (int k = 0; k < 3; ++k)
+                {
+                    tri[k] = remap[corners[t * 3 + k]];
+                    hasTo = hasTo || tri[k] == to;
+                }
+                if (hasTo)
+                {
+                    continue;
+                }
+                float before[3];
+                Cross(&points[tri[0] * 3], &points[tri[1] * 3], &points[tri[2] * 3], before);
+                for (int k = 0; k < 3; ++k)
+                {
+                    tri[k] = tri[k] == from ? to : tri[k];
+                }
+                float after[3];
+                Cross(&points[tri[0] * 3], &points[tri[1] * 3], &points[tri[2] * 3], after);
+                const float dot = before[0] * after[0] + before[1] * after[1] + before[2] * after[2];
+                const float lengths = std::sqrt((before[0] * before[0] + before[1] * before[1] + before[2] * before[2])
+                    * (after[0] * after[0] + after[1] * after[1] + after[2] * after[2]));
+                if (lengths <= 0.0f || dot < 0.25f * lengths)
+                {
+                    flips = true;
+                    break;
+                }
+            }
+            if (flips)
+            {
+                continue;
+            }
+
+            // 적용: 공유 삼각형은 지우고 나머지는 from 자리에 to 정점을 씀
+            for (unsigned int t : adjacency[from])
+            {
+                if (!alive[t])
+                {
+                    continue;
+                }
+                bool hasTo = false;
+                for (int k = 0; k < 3; ++k)
+                {
+                    hasTo = hasTo || remap[corners[t * 3 + k]] == to;
+                }
+                if (hasTo)
+                {
+                    alive[t] = 0;
+                    indexCount -= 3;
+                    continue;
+                }
+                for (int k = 0; k < 3; ++k)
+                {
+                    if (remap[corners[t * 3 + k]] == from)
+                    {
+                        corners[t * 3 + k] = toWedge;
+                    }
+                }
+                adjacency[to].push_back(t);
+            }
+            adjacency[from].clear();
+            quadrics[to].Add(quadrics[from]);
+            appliedError = std::max(appliedError, double(candidate.cost));
+
+            touched[from] = 1;
+            touched[to] = 1;
+            for (unsigned int n : neighborsFrom) touched[n] = 1;
+            for (unsigned int n : neighborsTo) touched[n] = 1;
+            ++collapsed;
+        }
+
+        // 오차 한도 아래 후보가 이번 패스에서 겹쳐 건너뛰어졌을 수 있으므로 아무것도 못 합칠 때까지 반복
+        if (collapsed == 0)
+        {
+            break;
+        }
+        // 지워진 삼각형을 인접 목록에서 정리
+        for (auto& list : adjacency)
+        {
+            list.erase(std::remove_if(list.begin(), list.end(), [&](unsigned int t) { return !alive[t]; }), list.end());
+        }
+    }
+
+    std::vector<unsigned int> result;
+    result.reserve(indexCount);
+    for (size_t t = 0; t < liveCount; ++t)
+    {
+        if (alive[t])
+        {
+            result.insert(result.end(), corners.begin() + t * 3, corners.begin() + t * 3 + 3);
+        }
+    }
+    if (resultError)
+    {
+        *resultError = float(std::sqrt(appliedError));
+    }
+    return result;
+}
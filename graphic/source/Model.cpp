@@ -5,6 +5,7 @@
 #include "gtc/type_ptr.hpp"
 #include "gtx/quaternion.hpp"
 #include <iostream>
+#include <algorithm>
 
 Model::Model(const std::string& path)
 {
@@ -22,6 +23,25 @@ void Model::LoadModel(const std::string& path)
     }
     directory = path.substr(0, path.find_last_of('/'));
     ProcessNode(scene->mRootNode, scene);
+
+    // ޽  ڿ ǹǷ ġ⸸ 
+    for (const auto& mesh : meshes)
+    {
+        bounds.Expand(mesh->GetBounds());
+    }
+    if (bounds.IsValid())
+    {
+        boundingSphere.center = bounds.GetCenter();
+        boundingSphere.radius = 0.0f;
+        for (const auto& mesh : meshes)
+        {
+            const BoundingSphere& meshSphere = mesh->GetBoundingSphere();
+            if (meshSphere.IsValid())
+            {
+                boundingSphere.radius = std::max(boundingSphere.radius, glm::length(meshSphere.center - boundingSphere.center) + meshSphere.radius);
+            }
+        }
+    }
 }
 
 void Model::ProcessNode(aiNode* node, const aiScene* scene)
@@ -69,6 +89,9 @@ std::shared_ptr<Mesh> Model::ProcessMesh(aiMesh* mesh, const aiScene* /*scene*/)
     ExtractBoneWeightForVertices(vertices, mesh, nullptr);
 
     auto newMesh = std::make_shared<Mesh>(vertices, indices, PrimitivePattern::Triangles);
+    // Ʈ    ﰢ/  ȭϰ LOD ε  θ  ȭ ũ⿡  
+    newMesh->OptimizeForGpu();
+    newMesh->GenerateLods();
     return newMesh;
 }
 
@@ -3,10 +3,25 @@
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <unordered_map>
+#include <SDL3/SDL.h>
 #include <gtc/type_ptr.hpp>
 
-Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath)
-    : rendererID(0)
+namespace
+{
+    std::atomic<uint32_t> nextShaderSerial{ 1 };
+
+    float TicksToMs(Uint64 ticks)
+    {
+        return static_cast<float>(ticks) * 1000.0f / static_cast<float>(SDL_GetPerformanceFrequency());
+    }
+}
+
+Shader::Shader(const std::string& vertexPath_, const std::string& fragmentPath_, const std::vector<std::string>& defines_)
+    : rendererID(0), serial(nextShaderSerial.fetch_add(1)), vertexPath(vertexPath_), fragmentPath(fragmentPath_), defines(defines_)
 {
     std::string vertexSource = ReadFile(vertexPath);
     std::string fragmentSource = ReadFile(fragmentPath);
@@ -22,6 +37,14 @@ Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath)
         return;
     }
 
+    CollectOptionalDefines(vertexSource, optionalDefines);
+    CollectOptionalDefines(fragmentSource, optionalDefines);
+    if (!defines.empty())
+    {
+        vertexSource = InjectDefines(vertexSource, defines);
+        fragmentSource = InjectDefines(fragmentSource, defines);
+    }
+
     rendererID = CreateProgram(vertexSource, fragmentSource);
     
     if (rendererID == 0)
@@ -30,7 +53,12 @@ Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath)
         return;
     }
 
-    // ̴ ÷:  Ȱ     
+    BuildUniformTable();
+}
+
+void Shader::BuildUniformTable()
+{
+    // ̴ ÷:  Ȱ   ġ ̸ ؽÿ Բ 
     GLint numActiveUniforms = 0;
     glGetProgramiv(rendererID, GL_ACTIVE_UNIFORMS, &numActiveUniforms);
 
@@ -41,8 +69,41 @@ Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath)
         GLint size;
         GLenum type;
         glGetActiveUniform(rendererID, i, sizeof(uniformName), &length, &size, &type, uniformName);
-        activeUniforms.insert(uniformName);
+
+        //  (UBO)  glUniform*   Ƿ 
+        GLuint index = static_cast<GLuint>(i);
+        GLint blockIndex = -1;
+        glGetActiveUniformsiv(rendererID, 1, &index, GL_UNIFORM_BLOCK_INDEX, &blockIndex);
+        if (blockIndex != -1)
+        {
+            continue;
+        }
+
+        std::string_view name(uniformName, static_cast<size_t>(length));
+        int location = glGetUniformLocation(rendererID, uniformName);
+        uniformSlots.push_back({ HashString(name), location });
+
+        // 迭 "̸[0]" ǹǷ "̸"ε ã  ְ ߰
+        if (name.size() > 3 && name.substr(name.size() - 3) == "[0]")
+        {
+            uniformSlots.push_back({ HashString(name.substr(0, name.size() - 3)), location });
+        }
     }
+
+    std::sort(uniformSlots.begin(), uniformSlots.end(), [](const UniformSlot& a, const UniformSlot& b) { return a.hash < b.hash; });
+
+    //   ̸ ؽÿ  ũ⸦  (ε ȣ ̴ layout(binding) )
+    GLint numActiveBlocks = 0;
+    glGetProgramiv(rendererID, GL_ACTIVE_UNIFORM_BLOCKS, &numActiveBlocks);
+    for (GLint i = 0; i < numActiveBlocks; i++)
+    {
+        GLsizei length = 0;
+        glGetActiveUniformBlockName(rendererID, static_cast<GLuint>(i), sizeof(uniformName), &length, uniformName);
+        GLint dataSize = 0;
+        glGetActiveUniformBlockiv(rendererID, static_cast<GLuint>(i), GL_UNIFORM_BLOCK_DATA_SIZE, &dataSize);
+        uniformBlockSlots.push_back({ HashString(std::string_view(uniformName, static_cast<size_t>(length))), dataSize });
+    }
+    std::sort(uniformBlockSlots.begin(), uniformBlockSlots.end(), [](const UniformSlot& a, const UniformSlot& b) { return a.hash < b.hash; });
 }
 
 Shader::~Shader()
@@ -51,7 +112,8 @@ Shader::~Shader()
 }
 
 Shader::Shader(Shader&& other) noexcept
-    : rendererID(other.rendererID), uniformLocationCache(std::move(other.uniformLocationCache))
+    : rendererID(other.rendererID), serial(other.serial), uniformSlots(std::move(other.uniformSlots)), uniformBlockSlots(std::move(other.uniformBlockSlots)), reportedMissingUniforms(std::move(other.reportedMissingUniforms)),
+    vertexPath(std::move(other.vertexPath)), fragmentPath(std::move(other.fragmentPath)), defines(std::move(other.defines)), optionalDefines(std::move(other.optionalDefines))
 {
     other.rendererID = 0;
 }
@@ -62,23 +124,51 @@ Shader& Shader::operator=(Shader&& other) noexcept
     {
         glDeleteProgram(rendererID);
         rendererID = other.rendererID;
-        uniformLocationCache = std::move(other.uniformLocationCache);
+        serial = other.serial;
+        uniformSlots = std::move(other.uniformSlots);
+        uniformBlockSlots = std::move(other.uniformBlockSlots);
+        reportedMissingUniforms = std::move(other.reportedMissingUniforms);
+        vertexPath = std::move(other.vertexPath);
+        fragmentPath = std::move(other.fragmentPath);
+        defines = std::move(other.defines);
+        optionalDefines = std::move(other.optionalDefines);
         other.rendererID = 0;
     }
     return *this;
 }
 
-bool Shader::HasUniform(const std::string& name) const
+int Shader::GetUniformLocation(UniformHandle handle) const
 {
-    if (activeUniforms.count(name)) {
-        return true;
+    auto it = std::lower_bound(uniformSlots.begin(), uniformSlots.end(), handle.hash,
+        [](const UniformSlot& slot, uint64_t hash) { return slot.hash < hash; });
+    if (it != uniformSlots.end() && it->hash == handle.hash)
+    {
+        return it->location;
     }
+    return -1;
+}
 
-    if (activeUniforms.count(name + "[0]")) {
-        return true;
+int Shader::GetUniformBlockSize(UniformHandle handle) const
+{
+    auto it = std::lower_bound(uniformBlockSlots.begin(), uniformBlockSlots.end(), handle.hash,
+        [](const UniformSlot& slot, uint64_t hash) { return slot.hash < hash; });
+    if (it != uniformBlockSlots.end() && it->hash == handle.hash)
+    {
+        return it->location;
     }
+    return 0;
+}
 
-    return false;
+int Shader::FindUniformLocation(std::string_view name)
+{
+    UniformHandle handle(name);
+    int location = GetUniformLocation(handle);
+    if (location == -1 && std::find(reportedMissingUniforms.begin(), reportedMissingUniforms.end(), handle.hash) == reportedMissingUniforms.end())
+    {
+        std::cout << "Uniform '" << name << "'() ã  ϴ." << std::endl;
+        reportedMissingUniforms.push_back(handle.hash);
+    }
+    return location;
 }
 
 std::string Shader::ReadFile(const std::string& filepath)
@@ -93,6 +183,41 @@ std::string Shader::ReadFile(const std::string& filepath)
     return ss.str();
 }
 
+std::string Shader::InjectDefines(const std::string& source, const std::vector<std::string>& defines)
+{
+    // #version ׻ ù ù̾ ϹǷ   ٿ 
+    std::string defineBlock;
+    for (const std::string& define : defines)
+    {
+        defineBlock += "#define " + define + "\n";
+    }
+
+    size_t versionPos = source.find("#version");
+    if (versionPos == std::string::npos)
+    {
+        return defineBlock + source;
+    }
+    size_t lineEnd = source.find('\n', versionPos);
+    if (lineEnd == std::string::npos)
+    {
+        return source + "\n" + defineBlock;
+    }
+    return source.substr(0, lineEnd + 1) + defineBlock + source.substr(lineEnd + 1);
+}
+
+void Shader::CollectOptionalDefines(const std::string& source, std::unordered_set<std::string>& outDefines)
+{
+    const std::string directive = "#ifdef ";
+    size_t pos = source.find(directive);
+    while (pos != std::string::npos)
+    {
+        size_t begin = pos + directive.size();
+        size_t end = source.find_first_of(" \t\r\n", begin);
+        outDefines.insert(source.substr(begin, end == std::string::npos ? std::string::npos : end - begin));
+        pos = source.find(directive, begin);
+    }
+}
+
 unsigned int Shader::CompileShader(unsigned int type, const std::string& source)
 {
     unsigned int id = glCreateShader(type);
@@ -204,57 +329,127 @@ void Shader::Unbind() const
     glUseProgram(0);
 }
 
-int Shader::GetUniformLocation(const std::string& name)
+void Shader::SetUniform1i(int location, int value) const
 {
-    if (uniformLocationCache.find(name) != uniformLocationCache.end())
-        return uniformLocationCache[name];
-
-    int location = glGetUniformLocation(rendererID, name.c_str());
-    if (location == -1)
-    {
-        std::cout << "Uniform '" << name << "'() ã  ϴ." << std::endl;
-    }
-
-    uniformLocationCache[name] = location;
-    return location;
+    glUniform1i(location, value);
 }
 
-void Shader::SetUniform1i(const std::string& name, int value)
+void Shader::SetUniform1f(int location, float value) const
 {
-    glUniform1i(GetUniformLocation(name), value);
+    glUniform1f(location, value);
 }
 
-void Shader::SetUniform1f(const std::string& name, float value)
+void Shader::SetUniform3f(int location, float v0, float v1, float v2) const
 {
-    glUniform1f(GetUniformLocation(name), value);
+    glUniform3f(location, v0, v1, v2);
 }
 
-void Shader::SetUniform3f(const std::string& name, float v0, float v1, float v2)
+void Shader::SetUniform4f(int location, float v0, float v1, float v2, float v3) const
 {
-    glUniform3f(GetUniformLocation(name), v0, v1, v2);
+    glUniform4f(location, v0, v1, v2, v3);
 }
 
-void Shader::SetUniform4f(const std::string& name, float v0, float v1, float v2, float v3)
+void Shader::SetUniformVec3(int location, const glm::vec3& vector) const
 {
-    glUniform4f(GetUniformLocation(name), v0, v1, v2, v3);
+    glUniform3fv(location, 1, &vector[0]);
 }
 
-void Shader::SetUniformVec3(const std::string& name, const glm::vec3& vector)
+void Shader::SetUniformVec4(int location, const glm::vec4& vector) const
 {
-    glUniform3fv(GetUniformLocation(name), 1, &vector[0]);
+    glUniform4fv(location, 1, &vector[0]);
 }
 
-void Shader::SetUniformVec4(const std::string& name, const glm::vec4& vector)
+void Shader::SetUniformMat4f(int location, const glm::mat4& matrix) const
 {
-    glUniform4fv(GetUniformLocation(name), 1, &vector[0]);
+    glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
 }
 
-void Shader::SetUniformMat4f(const std::string& name, const glm::mat4& matrix)
+void Shader::SetUniformMat4fv(int location, int count, const glm::mat4& matrix) const
 {
-    glUniformMatrix4fv(GetUniformLocation(name), 1, GL_FALSE, glm::value_ptr(matrix));
+    glUniformMatrix4fv(location, count, GL_FALSE, glm::value_ptr(matrix));
 }
 
-void Shader::SetUniformMat4fv(const std::string& name, int count, const glm::mat4& matrix)
+UniformBenchmarkResult RunUniformBenchmark(Shader& shader, int iterations)
 {
-    glUniformMatrix4fv(GetUniformLocation(name), count, GL_FALSE, glm::value_ptr(matrix));
+    // ο ϳ ϴ  (MeshRenderer::ApplyDrawUniforms  )
+    const char* names[] = { "model", "useTexture", "color", "metallic", "roughness" };
+    constexpr int NAME_COUNT = static_cast<int>(sizeof(names) / sizeof(names[0]));
+    constexpr UniformHandle handles[] = { UniformHandle("model"), UniformHandle("useTexture"), UniformHandle("color"),
+        UniformHandle("metallic"), UniformHandle("roughness") };
+
+    UniformBenchmarkResult result;
+    result.iterations = iterations;
+    shader.Bind();
+
+    //   : ̸ std::string  Ȱ (̸, ̸[0]) ġ ĳø ڿ ȸ
+    std::unordered_set<std::string> legacyActive;
+    std::unordered_map<std::string, int> legacyLocations;
+    for (const char* name : names)
+    {
+        int location = glGetUniformLocation(shader.GetShaderID(), name);
+        if (location != -1)
+        {
+            legacyActive.insert(name);
+        }
+        legacyLocations[name] = location;
+    }
+    auto legacyLookup = [&](const std::string& name)
+    {
+        bool active = legacyActive.count(name) > 0 || legacyActive.count(name + "[0]") > 0;
+        return active ? legacyLocations.find(name)->second : -1;
+    };
+
+    glm::mat4 matrix(1.0f);
+    glm::vec4 vector(1.0f);
+    auto setAll = [&](const int* locations)
+    {
+        shader.SetUniformMat4f(locations[0], matrix);
+        shader.SetUniform1i(locations[1], 0);
+        shader.SetUniformVec4(locations[2], vector);
+        shader.SetUniform1f(locations[3], 0.5f);
+        shader.SetUniform1f(locations[4], 0.5f);
+    };
+
+    int locations[NAME_COUNT] = {};
+    volatile int sink = 0;
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < iterations; ++i)
+    {
+        for (int n = 0; n < NAME_COUNT; ++n) locations[n] = legacyLookup(names[n]);
+        setAll(locations);
+    }
+    result.legacyMs = TicksToMs(SDL_GetPerformanceCounter() - start);
+
+    start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < iterations; ++i)
+    {
+        for (int n = 0; n < NAME_COUNT; ++n) locations[n] = shader.GetUniformLocation(handles[n]);
+        setAll(locations);
+    }
+    result.hashedMs = TicksToMs(SDL_GetPerformanceCounter() - start);
+
+    for (int n = 0; n < NAME_COUNT; ++n) locations[n] = shader.GetUniformLocation(handles[n]);
+    start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < iterations; ++i)
+    {
+        setAll(locations);
+    }
+    result.cachedMs = TicksToMs(SDL_GetPerformanceCounter() - start);
+
+    start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < iterations; ++i)
+    {
+        for (int n = 0; n < NAME_COUNT; ++n) sink = sink + legacyLookup(names[n]);
+    }
+    result.legacyLookupMs = TicksToMs(SDL_GetPerformanceCounter() - start);
+
+    start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < iterations; ++i)
+    {
+        for (int n = 0; n < NAME_COUNT; ++n) sink = sink + shader.GetUniformLocation(handles[n]);
+    }
+    result.hashedLookupMs = TicksToMs(SDL_GetPerformanceCounter() - start);
+
+    return result;
 }
@@ -0,0 +1,146 @@
+﻿#include "StreamRingBuffer.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <cstring>
+
+StreamRingBuffer::StreamRingBuffer(size_t segmentSize_)
+{
+    GLint alignment = 0;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    uniformAlignment = std::max<size_t>(static_cast<size_t>(alignment), 16);
+    glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    storageAlignment = std::max<size_t>(static_cast<size_t>(alignment), 16);
+
+    CreateBuffer(segmentSize_);
+}
+
+StreamRingBuffer::~StreamRingBuffer()
+{
+    DeleteFences();
+    if (!retiredBuffers.empty())
+    {
+        glDeleteBuffers(static_cast<GLsizei>(retiredBuffers.size()), retiredBuffers.data());
+    }
+    if (buffer != 0)
+    {
+        glUnmapNamedBuffer(buffer);
+        glDeleteBuffers(1, &buffer);
+    }
+}
+
+void StreamRingBuffer::CreateBuffer(size_t newSegmentSize)
+{
+    // 정렬 단위의 배수로 맞춰 구간 시작 위치가 어떤 용도로든 정렬되게 함
+    size_t unit = std::max(uniformAlignment, storageAlignment);
+    segmentSize = (newSegmentSize + unit - 1) / unit * unit;
+
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glCreateBuffers(1, &buffer);
+    glNamedBufferStorage(buffer, static_cast<GLsizeiptr>(segmentSize * FRAME_COUNT), nullptr, flags);
+    mappedData = static_cast<unsigned char*>(glMapNamedBufferRange(buffer, 0, static_cast<GLsizeiptr>(segmentSize * FRAME_COUNT), flags));
+    stats.segmentSize = segmentSize;
+}
+
+void StreamRingBuffer::DeleteFences()
+{
+    for (GLsync& fence : fences)
+    {
+        if (fence)
+        {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+}
+
+void StreamRingBuffer::BeginFrame()
+{
+    // 지난 프레임에 교체된 버퍼는 바인딩이 모두 끝났으므로 삭제 (GPU가 아직 읽는 중이면 GL이 실제 해제를 미룸)
+    if (!retiredBuffers.empty())
+    {
+        glDeleteBuffers(static_cast<GLsizei>(retiredBuffers.size()), retiredBuffers.data());
+        retiredBuffers.clear();
+    }
+
+    stats.frameBytes = currentFrameBytes;
+    stats.peakFrameBytes = std::max(stats.peakFrameBytes, currentFrameBytes);
+    stats.frameAllocations = currentFrameAllocations;
+    stats.frameFenceWaits = 0;
+    stats.fenceWaitMs = 0.0f;
+    currentFrameBytes = 0;
+    currentFrameAllocations = 0;
+
+    segmentIndex = (segmentIndex + 1) % FRAME_COUNT;
+    head = 0;
+
+    GLsync& fence = fences[segmentIndex];
+    if (fence)
+    {
+        // 먼저 기다리지 않고 확인하고, 아직이면 명령을 내보낸 뒤 끝날 때까지 기다림
+        GLenum result = glClientWaitSync(fence, 0, 0);
+        if (result == GL_TIMEOUT_EXPIRED)
+        {
+            Uint64 startTicks = SDL_GetPerformanceCounter();
+            do
+            {
+                result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+            } while (result == GL_TIMEOUT_EXPIRED);
+            stats.fenceWaitMs = static_cast<float>(SDL_GetPerformanceCounter() - startTicks) * 1000.0f / static_cast<float>(SDL_GetPerformanceFrequency());
+            stats.frameFenceWaits = 1;
+            ++stats.totalFenceWaits;
+        }
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+}
+
+void StreamRingBuffer::EndFrame()
+{
+    GLsync& fence = fences[segmentIndex];
+    if (fence)
+    {
+        glDeleteSync(fence);
+    }
+    fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+StreamAllocation StreamRingBuffer::Allocate(size_t bytes, size_t alignment)
+{
+    if (buffer == 0 || mappedData == nullptr)
+    {
+        return {};
+    }
+
+    size_t offset = (head + alignment - 1) & ~(alignment - 1);
+    if (offset + bytes > segmentSize)
+    {
+        // 이번 프레임 구간이 모자람: 이전 버퍼의 할당은 이번 프레임 동안 그대로 유효하고, 새 버퍼의 구간은 아직 GPU가 쓰지 않음
+        glUnmapNamedBuffer(buffer);
+        retiredBuffers.push_back(buffer);
+        DeleteFences();
+        CreateBuffer(std::max(segmentSize * 2, bytes + alignment));
+        ++stats.growCount;
+        head = 0;
+        offset = 0;
+    }
+
+    currentFrameBytes += offset + bytes - head;
+    ++currentFrameAllocations;
+    head = offset + bytes;
+
+    StreamAllocation allocation;
+    allocation.buffer = buffer;
+    allocation.offset = static_cast<size_t>(segmentIndex) * segmentSize + offset;
+    allocation.data = mappedData + allocation.offset;
+    return allocation;
+}
+
+StreamAllocation StreamRingBuffer::Write(const void* data, size_t bytes, size_t alignment)
+{
+    StreamAllocation allocation = Allocate(bytes, alignment);
+    if (allocation.IsValid() && bytes > 0)
+    {
+        std::memcpy(allocation.data, data, bytes);
+    }
+    return allocation;
+}
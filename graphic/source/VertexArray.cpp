@@ -21,6 +21,11 @@ void VertexArray::UnBind()
 }
 
 void VertexArray::AddVertexBuffer(VertexBuffer&& buffer, std::initializer_list<GLVertexArrayAttribFormat> bufferLayout)
+{
+	AddVertexBuffer(std::move(buffer), std::vector<GLVertexArrayAttribFormat>(bufferLayout));
+}
+
+void VertexArray::AddVertexBuffer(VertexBuffer&& buffer, const std::vector<GLVertexArrayAttribFormat>& bufferLayout)
 {
 	GLuint vb_handle = buffer.GetHandle();
 	//  Ӽ(ġ, , ؽó ǥ )  ݺ
@@ -52,4 +57,20 @@ void VertexArray::AddIndexBuffer(IndexBuffer&& buffer)
 	numIndices = buffer.GetCount();
 	indexBuffer = std::move(buffer);
 	glVertexArrayElementBuffer(arrayHandle, indexBuffer.GetIndicesHandle());
+}
+
+void VertexArray::BindInstanceBuffer(GLuint bufferHandle, GLintptr offset, GLsizei stride, std::initializer_list<GLVertexArrayAttribFormat> instanceLayout)
+{
+	if (!instanceAttributesEnabled)
+	{
+		for (const GLVertexArrayAttribFormat& attribute : instanceLayout)
+		{
+			glEnableVertexArrayAttrib(arrayHandle, attribute.layoutLocation);
+			glVertexArrayAttribFormat(arrayHandle, attribute.layoutLocation, attribute.dimension, attribute.type, attribute.normalized, attribute.relativeOffset);
+			glVertexArrayAttribBinding(arrayHandle, attribute.layoutLocation, INSTANCE_BINDING_INDEX);
+		}
+		glVertexArrayBindingDivisor(arrayHandle, INSTANCE_BINDING_INDEX, 1);
+		instanceAttributesEnabled = true;
+	}
+	glVertexArrayVertexBuffer(arrayHandle, INSTANCE_BINDING_INDEX, bufferHandle, offset, stride);
 }
\ No newline at end of file
@@ -1,5 +1,12 @@
 #include "VertexBuffer.hpp"
 
+VertexBuffer::VertexBuffer(size_t size_)
+    : size(size_)
+{
+    glCreateBuffers(1, &bufferHandle);
+    glNamedBufferStorage(bufferHandle, size_, nullptr, GL_DYNAMIC_STORAGE_BIT);
+}
+
 VertexBuffer::~VertexBuffer()
 {
     glDeleteBuffers(1, &bufferHandle);
@@ -0,0 +1,174 @@
+﻿#include "VertexFormat.hpp"
+#include "Mesh.hpp"
+#include <gtc/packing.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace
+{
+    // 셰이더의 MAX_BONES 중 큰 값(256)까지 uint8로 표현
+    constexpr int MAX_PACKED_BONE_ID = 255;
+
+    GLVertexArrayAttribFormat MakeAttribute(GLuint location, GLint dimension, GLenum type, bool normalized, bool isInteger,
+        size_t offset, GLsizei stride)
+    {
+        GLVertexArrayAttribFormat attribute;
+        attribute.dimension = dimension;
+        attribute.layoutLocation = location;
+        attribute.normalized = normalized ? GL_TRUE : GL_FALSE;
+        attribute.type = type;
+        attribute.offset = static_cast<GLintptr>(offset);
+        attribute.stride = stride;
+        attribute.isIntegerType = isInteger;
+        return attribute;
+    }
+
+    VertexStreamFormat MakeBaseStream()
+    {
+        constexpr GLsizei stride = sizeof(PackedVertex);
+        VertexStreamFormat stream;
+        stream.stride = stride;
+        stream.attributes = {
+            MakeAttribute(0, 3, GL_FLOAT, false, false, offsetof(PackedVertex, position), stride),
+            MakeAttribute(1, 2, GL_SHORT, true, false, offsetof(PackedVertex, normal), stride),
+            MakeAttribute(2, 4, GL_UNSIGNED_BYTE, true, false, offsetof(PackedVertex, color), stride),
+            MakeAttribute(3, 2, GL_HALF_FLOAT, false, false, offsetof(PackedVertex, texCoord), stride),
+        };
+        return stream;
+    }
+
+    VertexStreamFormat MakeSkinStream()
+    {
+        constexpr GLsizei stride = sizeof(PackedSkin);
+        VertexStreamFormat stream;
+        stream.stride = stride;
+        stream.attributes = {
+            // 정수 속성이므로 셰이더의 ivec4로 그대로 읽힘
+            MakeAttribute(4, 4, GL_UNSIGNED_BYTE, false, true, offsetof(PackedSkin, boneIDs), stride),
+            MakeAttribute(5, 4, GL_UNSIGNED_BYTE, true, false, offsetof(PackedSkin, weights), stride),
+        };
+        return stream;
+    }
+
+    void PackSkin(const Vertex& vertex, PackedSkin& skin)
+    {
+        int quantized[MAX_BONE_INFLUENCE] = {};
+        float weightSum = 0.0f;
+        int quantizedSum = 0;
+        int largest = 0;
+        for (int i = 0; i < MAX_BONE_INFLUENCE; ++i)
+        {
+            skin.boneIDs[i] = 0;
+            int boneID = vertex.boneIDs[i];
+            float weight = vertex.weights[i];
+            if (boneID < 0 || boneID > MAX_PACKED_BONE_ID || weight <= 0.0f)
+            {
+                continue;
+            }
+            skin.boneIDs[i] = static_cast<uint8_t>(boneID);
+            // 0보다 큰 가중치는 최소 1로 남겨 셰이더의 weight > 0 조건(스키닝 여부, 사용하는 칸)이 바뀌지 않게 함
+            quantized[i] = std::clamp(static_cast<int>(std::lround(weight * 255.0f)), 1, 255);
+            weightSum += weight;
+            quantizedSum += quantized[i];
+            if (quantized[i] > quantized[largest])
+            {
+                largest = i;
+            }
+        }
+
+        // 합이 1이던 정점은 반올림 오차를 가장 큰 가중치에 몰아 합을 정확히 1로 유지 (합이 1이 아닌 데이터는 그대로 둠)
+        if (quantizedSum > 0 && std::abs(weightSum - 1.0f) < 0.01f)
+        {
+            quantized[largest] = std::clamp(quantized[largest] + 255 - quantizedSum, 1, 255);
+        }
+        for (int i = 0; i < MAX_BONE_INFLUENCE; ++i)
+        {
+            skin.weights[i] = static_cast<uint8_t>(quantized[i]);
+        }
+    }
+}
+
+GLsizei VertexFormat::GetVertexSize() const
+{
+    GLsizei size = 0;
+    for (const VertexStreamFormat& stream : streams)
+    {
+        size += stream.stride;
+    }
+    return size;
+}
+
+const VertexFormat& GetStaticVertexFormat()
+{
+    static const VertexFormat format{ { MakeBaseStream() } };
+    return format;
+}
+
+const VertexFormat& GetSkinnedVertexFormat()
+{
+    static const VertexFormat format{ { MakeBaseStream(), MakeSkinStream() } };
+    return format;
+}
+
+void EncodeOctahedralNormal(const glm::vec3& normal, int16_t encoded[2])
+{
+    // 법선을 |x|+|y|+|z| = 1인 팔면체에 사상하고, 아래쪽 반구(z < 0)는 바깥 삼각형으로 접어 2차원으로 만듦
+    float length = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+    glm::vec2 octahedral(0.0f);
+    if (length > 0.0f)
+    {
+        octahedral = glm::vec2(normal.x, normal.y) / length;
+        if (normal.z < 0.0f)
+        {
+            glm::vec2 folded(1.0f - std::abs(octahedral.y), 1.0f - std::abs(octahedral.x));
+            octahedral.x = octahedral.x >= 0.0f ? folded.x : -folded.x;
+            octahedral.y = octahedral.y >= 0.0f ? folded.y : -folded.y;
+        }
+    }
+    encoded[0] = static_cast<int16_t>(glm::packSnorm1x16(octahedral.x));
+    encoded[1] = static_cast<int16_t>(glm::packSnorm1x16(octahedral.y));
+}
+
+glm::vec3 DecodeOctahedralNormal(const int16_t encoded[2])
+{
+    // 셰이더의 DecodeOctahedralNormal과 같은 계산
+    glm::vec3 normal(glm::unpackSnorm1x16(static_cast<uint16_t>(encoded[0])), glm::unpackSnorm1x16(static_cast<uint16_t>(encoded[1])), 0.0f);
+    normal.z = 1.0f - std::abs(normal.x) - std::abs(normal.y);
+    float fold = std::max(-normal.z, 0.0f);
+    normal.x += normal.x >= 0.0f ? -fold : fold;
+    normal.y += normal.y >= 0.0f ? -fold : fold;
+    return glm::normalize(normal);
+}
+
+void PackVertices(const std::vector<Vertex>& vertices, std::vector<PackedVertex>& packed, std::vector<PackedSkin>* skin)
+{
+    packed.resize(vertices.size());
+    if (skin)
+    {
+        skin->resize(vertices.size());
+    }
+    for (size_t i = 0; i < vertices.size(); ++i)
+    {
+        const Vertex& vertex = vertices[i];
+        PackedVertex& target = packed[i];
+        target.position = vertex.position;
+        EncodeOctahedralNormal(vertex.normal, target.normal);
+        target.color[0] = glm::packUnorm1x8(vertex.color.r);
+        target.color[1] = glm::packUnorm1x8(vertex.color.g);
+        target.color[2] = glm::packUnorm1x8(vertex.color.b);
+        target.color[3] = 255;
+        target.texCoord[0] = glm::packHalf1x16(vertex.texCoord.x);
+        target.texCoord[1] = glm::packHalf1x16(vertex.texCoord.y);
+        if (skin)
+        {
+            PackSkin(vertex, (*skin)[i]);
+        }
+    }
+}
+
+void ResetSkinAttributeDefaults()
+{
+    glVertexAttribI4i(4, 0, 0, 0, 0);
+    glVertexAttrib4f(5, 0.0f, 0.0f, 0.0f, 0.0f);
+}
@@ -5,6 +5,7 @@
 #include "PBRScene.hpp"
 #include "GameScene.hpp"
 #include "MoCapScene.hpp"
+#include "LightStressScene.hpp"
 
 #pragma comment(lib, "opengl32.lib")
 
@@ -19,6 +20,7 @@ int main(int argc, char* argv[])
     sceneManager->AddScene(SceneTag::PBR, new PBRScene());
     sceneManager->AddScene(SceneTag::GAME, new GameScene()); 
     sceneManager->AddScene(SceneTag::MOCAP, new MoCapScene());
+    sceneManager->AddScene(SceneTag::LIGHT_STRESS, new LightStressScene());
     // 시작 씬 설정
     sceneManager->Init(SceneTag::MESHES);
 